@@ -171,6 +171,7 @@ public:
         {
             time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             lowtime = (time < lowtime) ? time : lowtime;
             if(iters > 1 && i > 0)
                 avgtime += time;
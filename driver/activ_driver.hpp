@@ -329,6 +329,7 @@ int ActivationDriver<Tgpu, Tref>::RunForwardGPU()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             lowtime = (time < lowtime) ? time : lowtime;
             if(iters > 1 && i > 0)
                 avgtime += time;
@@ -415,6 +416,7 @@ int ActivationDriver<Tgpu, Tref>::RunBackwardGPU()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             lowtime = (time < lowtime) ? time : lowtime;
             if(iters > 1 && i > 0)
                 avgtime += time;
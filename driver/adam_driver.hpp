@@ -490,6 +490,7 @@ int AdamDriver<Tgpu, Tref, Tgrad>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -822,6 +822,7 @@ int BatchNormDriver<Tgpu, Tref, Tmix>::RunForwardGPU()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             lowtime = (time < lowtime) ? time : lowtime;
             if(iters > 1 && i > 0)
                 avgtime += time;
@@ -1099,6 +1100,7 @@ int BatchNormDriver<Tgpu, Tref, Tmix>::RunBackwardGPU()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             lowtime = (time < lowtime) ? time : lowtime;
             if(iters > 1 && i > 0)
                 avgtime += time;
@@ -1300,6 +1302,7 @@ int BatchNormDriver<Tgpu, Tref, Tmix>::VerifyForward()
 
     maxval        = static_cast<Tref>(0.0);
     auto errorOut = miopen::rms_range(out_ref.data, out.GetVector());
+    RecordVerification("fwd", errorOut, maxrms);
     if(!std::isfinite(errorOut) || errorOut > maxrms)
     {
         std::cout << "Forward batch norm verification FAILED on output: " << errorOut << std::endl;
@@ -1461,6 +1464,7 @@ int BatchNormDriver<Tgpu, Tref, Tmix>::VerifyBackward()
 #endif
     maxval          = static_cast<Tref>(0.0);
     auto errordxout = miopen::rms_range(out_ref.data, out_bwd.GetVector());
+    RecordVerification("bwd", errordxout, maxrms);
     if(!std::isfinite(errordxout) || errordxout > maxrms)
     {
         std::cout << "Backwards prop batch norm verification FAILED on dx: " << errordxout
@@ -272,6 +272,7 @@ int CatDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -425,7 +425,7 @@ private:
         return total_time;
     }
 
-    void PrintForwardTime(float kernel_total_time, float kernel_first_time) const;
+    void PrintForwardTime(float kernel_total_time, float kernel_first_time);
     int RunForwardGpuImmed(bool is_transform);
     int RunForwardGpuFind(bool is_transform);
     void PrintBackwardDataTime(float kernel_total_time, float kernel_first_time);
@@ -501,6 +501,21 @@ private:
         return oss.str();
     }
 
+    void ReportRun(const char* direction,
+                   const char* path,
+                   const miopenConvSolution_t& s,
+                   std::size_t workspace,
+                   float kernel_total_time,
+                   float kernel_first_time)
+    {
+        AddRunReport({direction,
+                      path,
+                      (s.solution_id != 0) ? miopen::solver::Id(s.solution_id).ToString()
+                                           : std::string("UNKNOWN"),
+                      workspace,
+                      ComputeAverageTime(kernel_total_time, kernel_first_time)});
+    }
+
     /// Find() updates find-db with the most recent information (unless find-db is disabled).
     /// Therefore, after Find(), Immediate mode returns the "best" found solution
     /// as the 1st solution in the list, and we can use Immediate mode to find out
@@ -1662,7 +1677,7 @@ int ConvDriver<Tgpu, Tref>::FindForward(int& ret_algo_count,
 
 template <typename Tgpu, typename Tref>
 void ConvDriver<Tgpu, Tref>::PrintForwardTime(const float kernel_total_time,
-                                              const float kernel_first_time) const
+                                              const float kernel_first_time)
 {
     float kernel_average_time = ComputeAverageTime(kernel_total_time, kernel_first_time);
     printf("GPU Kernel Time Forward Conv. Elapsed: %f ms (average)\n", kernel_average_time);
@@ -1698,6 +1713,8 @@ void ConvDriver<Tgpu, Tref>::PrintForwardTime(const float kernel_total_time,
         size_t outputBytes = 1.0 * out_n * out_c * out_h * out_w *
                              miopen::GetTypeSize(miopen::deref(outputTensor).GetType());
 
+        SetWorkload(flopCnt, readBytes + outputBytes);
+
         printf("stats: name, n, c, ho, wo, x, y, k, flopCnt, bytesRead, bytesWritten, GFLOPs, "
                "GB/s, timeMs\n");
         printf("stats: %s%dx%du%d, %d, %d, %d, %d, %d, %d, %d,  %zu, %zu, %zu, %.0f, %.0f, %f\n",
@@ -1742,6 +1759,8 @@ void ConvDriver<Tgpu, Tref>::PrintForwardTime(const float kernel_total_time,
         size_t outputBytes = 1.0 * out_n * out_c * out_d * out_h * out_w *
                              miopen::GetTypeSize(miopen::deref(outputTensor).GetType());
 
+        SetWorkload(flopCnt, readBytes + outputBytes);
+
         printf("stats: name  , n, c, do, ho, wo, z, y, x, k, flopCnt, bytesRead, bytesWritten, "
                "GFLOPs, "
                "GB/s, timeMs\n");
@@ -2074,6 +2093,7 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuFind(const bool is_transform)
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             kernel_total_time += time;
             if(i == 0)
                 kernel_first_time = time;
@@ -2090,13 +2110,18 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuFind(const bool is_transform)
                   << ", Auxiliary API calls: " << fwd_auxiliary.gettime_ms() << " ms"
                   << " (GWSS: " << fwd_auxiliary_gwss.gettime_ms() << ')' << std::endl;
     }
-    if(time_enabled)
+    if(time_enabled || collect_reports)
     {
         miopenConvSolution_t solution;
         GetSolutionAfterFind(
             perf_results[0], Direction::Fwd, in_tens, wei_tens, outputTensor, solution);
-        std::cout << "MIOpen Forward Conv. " << AlgorithmSolutionToString(solution) << std::endl;
-        PrintForwardTime(kernel_total_time, kernel_first_time);
+        if(time_enabled)
+        {
+            std::cout << "MIOpen Forward Conv. " << AlgorithmSolutionToString(solution)
+                      << std::endl;
+            PrintForwardTime(kernel_total_time, kernel_first_time);
+        }
+        ReportRun("fwd", "find", solution, ws_size, kernel_total_time, kernel_first_time);
     }
 
     return rc;
@@ -2228,6 +2253,7 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuImmed(const bool is_transform)
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             kernel_total_time += time;
             if(i == 0)
                 kernel_first_time = time;
@@ -2249,6 +2275,7 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuImmed(const bool is_transform)
         std::cout << "MIOpen Forward Conv. " << AlgorithmSolutionToString(*selected) << std::endl;
         PrintForwardTime(kernel_total_time, kernel_first_time);
     }
+    ReportRun("fwd", "immediate", *selected, ws_size, kernel_total_time, kernel_first_time);
 
     is_fwd_igemm = (selected->algorithm == miopenConvolutionAlgoImplicitGEMM);
     return miopenStatusSuccess;
@@ -2437,6 +2464,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardGPU()
 
     if(is_wrw)
     {
+        BeginSamples("wrw");
         auto rc           = immediate_solution ? RunBackwardWrwGpuImmed() : RunBackwardWrwGpuFind();
         is_wrw_run_failed = (rc != 0);
         ret |= (rc << 16); // Differentiate WrW and Bwd error codes.
@@ -2545,6 +2573,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuFind()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             kernel_total_time += time;
             if(i == 0)
                 kernel_first_time = time;
@@ -2561,7 +2590,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuFind()
                   << ", Auxiliary API calls: " << bwd_auxiliary.gettime_ms() << " ms"
                   << " (GWSS: " << bwd_auxiliary_gwss.gettime_ms() << ')' << std::endl;
     }
-    if(time_enabled)
+    if(time_enabled || collect_reports)
     {
         miopenConvSolution_t solution;
         GetSolutionAfterFind(perf_results_data[0],
@@ -2570,9 +2599,13 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuFind()
                              weightTensor,
                              outputTensor,
                              solution);
-        std::cout << "MIOpen Backward Data Conv. " << AlgorithmSolutionToString(solution)
-                  << std::endl;
-        PrintBackwardDataTime(kernel_total_time, kernel_first_time);
+        if(time_enabled)
+        {
+            std::cout << "MIOpen Backward Data Conv. " << AlgorithmSolutionToString(solution)
+                      << std::endl;
+            PrintBackwardDataTime(kernel_total_time, kernel_first_time);
+        }
+        ReportRun("bwd", "find", solution, ws_size, kernel_total_time, kernel_first_time);
     }
 
     din.CopyFromDeviceToHost(GetStream());
@@ -2616,6 +2649,8 @@ void ConvDriver<Tgpu, Tref>::PrintBackwardDataTime(float kernel_total_time, floa
         size_t outputBytes = 1.0 * out_n * out_c * out_h * out_w *
                              miopen::GetTypeSize(miopen::deref(outputTensor).GetType());
 
+        SetWorkload(flopCnt, readBytes + outputBytes);
+
         printf("stats: name, n, c, ho, wo, x, y, k, flopCnt, bytesRead, bytesWritten, GFLOPs, "
                "GB/s, timeMs\n");
         printf("stats: %s%dx%du%d, %d, %d, %d, %d, %d, %d, %d,  %zu, %zu, %zu, %.0f, %.0f, %f\n",
@@ -2755,6 +2790,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuFind()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             kernel_total_time += time;
             if(i == 0)
                 kernel_first_time = time;
@@ -2771,7 +2807,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuFind()
                   << ", Auxiliary API calls: " << wrw_auxiliary.gettime_ms() << " ms"
                   << " (GWSS: " << wrw_auxiliary_gwss.gettime_ms() << ')' << std::endl;
     }
-    if(time_enabled)
+    if(time_enabled || collect_reports)
     {
         miopenConvSolution_t solution;
         GetSolutionAfterFind(perf_results_weights[0],
@@ -2780,9 +2816,13 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuFind()
                              weightTensor,
                              outputTensor,
                              solution);
-        std::cout << "MIOpen Backward Weights Conv. " << AlgorithmSolutionToString(solution)
-                  << std::endl;
-        PrintBackwardWrwTime(kernel_total_time, kernel_first_time);
+        if(time_enabled)
+        {
+            std::cout << "MIOpen Backward Weights Conv. " << AlgorithmSolutionToString(solution)
+                      << std::endl;
+            PrintBackwardWrwTime(kernel_total_time, kernel_first_time);
+        }
+        ReportRun("wrw", "find", solution, ws_size, kernel_total_time, kernel_first_time);
     }
 
     dwei.CopyFromDeviceToHost(GetStream());
@@ -2821,6 +2861,8 @@ void ConvDriver<Tgpu, Tref>::PrintBackwardWrwTime(float kernel_total_time, float
         size_t readBytes   = 0;
         size_t outputBytes = 0;
 
+        SetWorkload(flopCnt, readBytes + outputBytes);
+
         printf("stats: name, n, c, ho, wo, x, y, k, flopCnt, bytesRead, bytesWritten, GFLOPs, "
                "GB/s, timeMs\n");
         printf("stats: %s%dx%du%d, %d, %d, %d, %d, %d, %d, %d,  %zu, %zu, %zu, %.0f, %.0f, %f\n",
@@ -2989,6 +3031,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuImmed()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             kernel_total_time += time;
             if(i == 0)
                 kernel_first_time = time;
@@ -3011,6 +3054,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuImmed()
                   << std::endl;
         PrintBackwardDataTime(kernel_total_time, kernel_first_time);
     }
+    ReportRun("bwd", "immediate", *selected, ws_size, kernel_total_time, kernel_first_time);
 
     is_bwd_igemm = (selected->algorithm == miopenConvolutionAlgoImplicitGEMM);
     din.CopyFromDeviceToHost(GetStream());
@@ -3118,6 +3162,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuImmed()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             kernel_total_time += time;
             if(i == 0)
                 kernel_first_time = time;
@@ -3140,6 +3185,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuImmed()
                   << std::endl;
         PrintBackwardWrwTime(kernel_total_time, kernel_first_time);
     }
+    ReportRun("wrw", "immediate", *selected, ws_size, kernel_total_time, kernel_first_time);
 
     is_wrw_winograd = (selected->algorithm == miopenConvolutionAlgoWinograd);
     is_wrw_igemm    = (selected->algorithm == miopenConvolutionAlgoImplicitGEMM);
@@ -3484,6 +3530,7 @@ int ConvDriver<Tgpu, Tref>::VerifyForward()
     if(is_fwd_igemm)
         tolerance = tolerance * 10;
 
+    RecordVerification("fwd", error, tolerance);
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << "Forward Convolution FAILED: " << error << " > " << tolerance << std::endl;
@@ -3531,6 +3578,7 @@ int ConvDriver<Tgpu, Tref>::VerifyBackward()
         if(is_bwd_igemm)
             tolerance = tolerance * 10;
 
+        RecordVerification("bwd", error_data, tolerance);
         if(!std::isfinite(error_data) || error_data > tolerance)
         {
             std::cout << "Backward Convolution Data FAILED: " << error_data << " > " << tolerance
@@ -3588,6 +3636,7 @@ int ConvDriver<Tgpu, Tref>::VerifyBackward()
                                  ? std::numeric_limits<double>::max()
                                  : miopen::rms_range(dwei_host.data, dwei.GetVector());
 
+        RecordVerification("wrw", error_weights, tolerance);
         if(!std::isfinite(error_weights) || error_weights > tolerance)
         {
             std::cout << "Backward Convolution Weights FAILED: " << error_weights << " > "
@@ -370,6 +370,7 @@ int CTCDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -34,6 +34,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cfloat>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <memory>
 #include <miopen/logger.hpp>
 #include <miopen/miopen.h>
@@ -72,6 +75,8 @@ typedef enum
     EC_VerifyBwd     = 0x200,
     EC_VerifyWrw     = 0x400,
     EC_VerifyBwdBias = 0x800,
+    // Reported by --compare when the kernels became significantly slower.
+    EC_PerfRegression = 0x1000,
 } errorCode_t;
 
 struct GPUMem
@@ -315,6 +320,7 @@ inline void PadBufferSize(size_t& sz, int datatype_sz)
            "getitem[bfp16|fp16], reducecalculation[bfp16|fp16], rope[bfp16|fp16], "
            "prelu[bfp16|fp16], kthvalue[bfp16|fp16], glu[bfp16|fp16], softmarginloss[bfp16|fp16], "
            "multimarginloss[bfp16|fp16]\n");
+    printf("       ./driver --replay *commands_file* [--replay-output *file.csv|file.json*]\n");
     exit(0); // NOLINT (concurrency-mt-unsafe)
 }
 
@@ -351,7 +357,7 @@ inline std::string ParseBaseArg(int argc, char* argv[])
        arg != "kthvaluebfp16" && arg != "glu" && arg != "glufp16" && arg != "glubfp16" &&
        arg != "softmarginloss" && arg != "softmarginlossfp16" && arg != "softmarginlossbfp16" &&
        arg != "multimarginloss" && arg != "multimarginlossfp16" && arg != "multimarginlossbfp16" &&
-       arg != "--version")
+       arg != "--version" && arg != "--replay")
     {
         printf("FAILED: Invalid Base Input Argument\n");
         Usage();
@@ -362,23 +368,81 @@ inline std::string ParseBaseArg(int argc, char* argv[])
         return arg;
 }
 
+/// Summary of one timed GPU run, collected by the replay mode and for JSON results.
+struct RunReport
+{
+    std::string direction;
+    std::string path; // "find" or "immediate"
+    std::string solution;
+    std::size_t workspace = 0;
+    float kernel_time_ms  = 0.f;
+};
+
+/// Per-iteration kernel times of one direction, as reported by miopenGetKernelTime().
+struct KernelSamples
+{
+    std::string direction;
+    std::vector<float> times_ms;
+    double flops = 0.0; // Work of one iteration, 0 if unknown.
+    double bytes = 0.0; // Memory traffic of one iteration, 0 if unknown.
+};
+
+/// Result of verifying one direction against the reference.
+struct Verification
+{
+    bool passed      = true;
+    double error     = std::numeric_limits<double>::quiet_NaN();
+    double tolerance = std::numeric_limits<double>::quiet_NaN();
+};
+
 class Driver
 {
 public:
     Driver()
     {
         data_type = miopenFloat;
+        if(shared_handle != nullptr)
+        {
+            handle       = shared_handle;
+            owns_handle_ = false;
+        }
+        else
+        {
 #if MIOPEN_BACKEND_OPENCL
-        miopenCreate(&handle);
+            miopenCreate(&handle);
 #elif MIOPEN_BACKEND_HIP
-        hipStream_t s;
-        hipStreamCreate(&s);
-        miopenCreateWithStream(&handle, s);
+            hipStream_t s;
+            hipStreamCreate(&s);
+            miopenCreateWithStream(&handle, s);
 #endif
+        }
 
         miopenGetStream(handle, &q);
     }
 
+    /// When set, new drivers reuse this handle instead of creating their own,
+    /// so that databases and compiled kernels survive across layers.
+    static inline miopenHandle_t shared_handle = nullptr;
+    /// When set, drivers record a RunReport for each timed GPU run.
+    static inline bool collect_reports = false;
+
+    const std::vector<RunReport>& GetRunReports() const { return run_reports; }
+    const std::vector<KernelSamples>& GetKernelSamples() const { return kernel_samples; }
+    const std::map<std::string, Verification>& GetVerifications() const { return verifications; }
+
+    /// Starts a new series of kernel samples; subsequent samples are attributed to \p direction.
+    void BeginSamples(const std::string& direction)
+    {
+        kernel_samples.push_back({direction, {}});
+    }
+    /// Records the outcome of a Verify call unless the driver has already reported the error.
+    void SetVerified(const std::string& direction, bool passed)
+    {
+        Verification v;
+        v.passed = passed;
+        verifications.emplace(direction, v);
+    }
+
     miopenHandle_t GetHandle() { return handle; }
     miopenDataType_t GetDataType() { return data_type; }
 
@@ -387,7 +451,11 @@ public:
 #elif MIOPEN_BACKEND_HIP
     hipStream_t& GetStream() { return q; }
 #endif
-    virtual ~Driver() { miopenDestroy(handle); }
+    virtual ~Driver()
+    {
+        if(owns_handle_)
+            miopenDestroy(handle);
+    }
 
     // TODO: add timing APIs
     virtual int AddCmdLineArgs()                         = 0;
@@ -403,6 +471,31 @@ public:
 protected:
     template <typename Tgpu>
     void InitDataType();
+    void AddRunReport(RunReport report)
+    {
+        if(collect_reports)
+            run_reports.push_back(std::move(report));
+    }
+    void AddKernelSample(float time)
+    {
+        if(kernel_samples.empty())
+            BeginSamples("fwd");
+        kernel_samples.back().times_ms.push_back(time);
+    }
+    void SetWorkload(double flops, double bytes)
+    {
+        if(kernel_samples.empty())
+            return;
+        kernel_samples.back().flops = flops;
+        kernel_samples.back().bytes = bytes;
+    }
+    void RecordVerification(const std::string& direction, double error, double tolerance)
+    {
+        auto& v     = verifications[direction];
+        v.passed    = std::isfinite(error) && error <= tolerance;
+        v.error     = error;
+        v.tolerance = tolerance;
+    }
     miopenHandle_t handle;
     miopenDataType_t data_type;
 
@@ -411,6 +504,12 @@ protected:
 #elif MIOPEN_BACKEND_HIP
     hipStream_t q;
 #endif
+
+private:
+    bool owns_handle_ = true;
+    std::vector<RunReport> run_reports;
+    std::vector<KernelSamples> kernel_samples;
+    std::map<std::string, Verification> verifications;
 };
 
 template <>
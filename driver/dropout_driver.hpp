@@ -334,6 +334,7 @@ int DropoutDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -402,6 +403,7 @@ int DropoutDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -364,6 +364,7 @@ int GemmDriver<T>::RunForwardGPU()
     {
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         printf("GPU Kernel Time Gemm Elapsed: %f ms\n", time);
     }
 
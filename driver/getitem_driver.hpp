@@ -434,6 +434,7 @@ int GetitemDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -300,6 +300,7 @@ int KthvalueDriver<TIO>::RunForwardGPU()
                               keepDim);
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -331,6 +331,7 @@ int LRNDriver<Tgpu, Tref>::RunForwardGPU()
     {
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
 
         STOP_TIME
         if(WALL_CLOCK)
@@ -398,6 +399,7 @@ int LRNDriver<Tgpu, Tref>::RunBackwardGPU()
     {
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
 
         STOP_TIME
         if(WALL_CLOCK)
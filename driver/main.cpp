@@ -25,6 +25,8 @@
  *******************************************************************************/
 #include "driver.hpp"
 #include "registry_driver_maker.hpp"
+#include "replay.hpp"
+#include "results.hpp"
 
 #include <miopen/config.h>
 #include <miopen/stringutils.hpp>
@@ -32,26 +34,8 @@
 #include <cstdio>
 #include <iostream>
 
-int main(int argc, char* argv[])
+std::shared_ptr<Driver> MakeDriver(const std::string& base_arg)
 {
-
-    std::string base_arg = ParseBaseArg(argc, argv);
-
-    if(base_arg == "--version")
-    {
-        size_t major, minor, patch;
-        miopenGetVersion(&major, &minor, &patch);
-        std::cout << "MIOpen (version: " << major << "." << minor << "." << patch << ")"
-                  << std::endl;
-        exit(0); // NOLINT (concurrency-mt-unsafe)
-    }
-
-    // show command
-    std::cout << "MIOpenDriver";
-    for(int i = 1; i < argc; i++)
-        std::cout << " " << argv[i];
-    std::cout << std::endl;
-
     std::shared_ptr<Driver> drv;
     for(auto f : rdm::GetRegistry())
     {
@@ -59,21 +43,20 @@ int main(int argc, char* argv[])
         if(drv != nullptr)
             break;
     }
-    if(drv == nullptr)
-    {
-        printf("Incorrect BaseArg\n");
-        exit(0); // NOLINT (concurrency-mt-unsafe)
-    }
+    return drv;
+}
 
-    drv->AddCmdLineArgs();
-    int rc = drv->ParseCmdLineArgs(argc, argv);
+int RunDriver(Driver& drv, const std::string& base_arg, int argc, char* argv[])
+{
+    drv.AddCmdLineArgs();
+    int rc = drv.ParseCmdLineArgs(argc, argv);
     if(rc != 0)
     {
         std::cout << "ParseCmdLineArgs() FAILED, rc = " << rc << std::endl;
         return rc;
     }
-    drv->GetandSetData();
-    rc = drv->AllocateBuffersAndCopy();
+    drv.GetandSetData();
+    rc = drv.AllocateBuffersAndCopy();
     if(rc != 0)
     {
         std::cout << "AllocateBuffersAndCopy() FAILED, rc = " << rc << std::endl;
@@ -81,32 +64,83 @@ int main(int argc, char* argv[])
     }
 
     int fargval =
-        !miopen::StartsWith(base_arg, "CBAInfer") ? drv->GetInputFlags().GetValueInt("forw") : 1;
+        !miopen::StartsWith(base_arg, "CBAInfer") ? drv.GetInputFlags().GetValueInt("forw") : 1;
     bool bnFwdInVer   = (fargval == 2 && miopen::StartsWith(base_arg, "bnorm"));
-    bool verifyarg    = (drv->GetInputFlags().GetValueInt("verify") == 1);
+    bool verifyarg    = (drv.GetInputFlags().GetValueInt("verify") == 1);
     int cumulative_rc = 0; // Do not stop running tests in case of errors.
 
     if(fargval & 1 || fargval == 0 || bnFwdInVer)
     {
-        rc = drv->RunForwardGPU();
+        drv.BeginSamples("fwd");
+        rc = drv.RunForwardGPU();
         cumulative_rc |= rc;
         if(rc != 0)
             std::cout << "RunForwardGPU() FAILED, rc = "
                       << "0x" << std::hex << rc << std::dec << std::endl;
         if(verifyarg) // Verify even if Run() failed.
-            cumulative_rc |= drv->VerifyForward();
+        {
+            rc = drv.VerifyForward();
+            drv.SetVerified("fwd", rc == 0);
+            cumulative_rc |= rc;
+        }
     }
 
     if(fargval != 1)
     {
-        rc = drv->RunBackwardGPU();
+        drv.BeginSamples("bwd");
+        rc = drv.RunBackwardGPU();
         cumulative_rc |= rc;
         if(rc != 0)
             std::cout << "RunBackwardGPU() FAILED, rc = "
                       << "0x" << std::hex << rc << std::dec << std::endl;
         if(verifyarg) // Verify even if Run() failed.
-            cumulative_rc |= drv->VerifyBackward();
+        {
+            rc = drv.VerifyBackward();
+            // Drivers that verify several backward passes report each of them on their own.
+            if(drv.GetVerifications().count("wrw") == 0)
+                drv.SetVerified("bwd", rc == 0);
+            cumulative_rc |= rc;
+        }
     }
 
     return cumulative_rc;
 }
+
+int main(int argc, char* argv[])
+{
+    const auto options = results::ExtractOptions(argc, argv);
+
+    std::string base_arg = ParseBaseArg(argc, argv);
+
+    if(base_arg == "--version")
+    {
+        size_t major, minor, patch;
+        miopenGetVersion(&major, &minor, &patch);
+        std::cout << "MIOpen (version: " << major << "." << minor << "." << patch << ")"
+                  << std::endl;
+        exit(0); // NOLINT (concurrency-mt-unsafe)
+    }
+
+    if(base_arg == "--replay")
+        return replay::Run(argc, argv);
+
+    // show command
+    std::string command = base_arg;
+    for(int i = 2; i < argc; i++)
+        command += std::string(" ") + argv[i];
+    std::cout << "MIOpenDriver " << command << std::endl;
+
+    std::shared_ptr<Driver> drv = MakeDriver(base_arg);
+    if(drv == nullptr)
+    {
+        printf("Incorrect BaseArg\n");
+        exit(0); // NOLINT (concurrency-mt-unsafe)
+    }
+
+    if(!options.Enabled())
+        return RunDriver(*drv, base_arg, argc, argv);
+
+    Driver::collect_reports = true;
+    const int rc            = RunDriver(*drv, base_arg, argc, argv);
+    return rc | results::Report(*drv, command, rc, options);
+}
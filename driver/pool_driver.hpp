@@ -475,6 +475,7 @@ int PoolDriver_impl<Tgpu, Tref, Index>::RunForwardGPU()
         float time = 0.0;
         if(rc == 0)
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
 
         STOP_TIME
         if(WALL_CLOCK)
@@ -547,6 +548,7 @@ int PoolDriver_impl<Tgpu, Tref, Index>::RunBackwardGPU()
         float time = 0.0;
         if(rc == 0)
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
 
         STOP_TIME
         if(WALL_CLOCK)
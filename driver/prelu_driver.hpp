@@ -290,6 +290,7 @@ int PReLUDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
@@ -437,6 +437,7 @@ int ReduceDriver<Tgpu, Tref>::RunForwardGPU()
     {
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
 
         STOP_TIME
         if(WALL_CLOCK)
@@ -491,6 +492,7 @@ int ReduceDriver<Tgpu, Tref>::VerifyForward()
     if(std::is_same<Tgpu, float>::value && reduceOp == MIOPEN_REDUCE_TENSOR_NORM2)
         tolerance *= 12.0;
 
+    RecordVerification("fwd", error, tolerance);
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << "ReduceTensor() FAILED with error = " << error
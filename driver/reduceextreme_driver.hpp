@@ -327,6 +327,7 @@ int ReduceExtremeDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
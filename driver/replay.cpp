@@ -0,0 +1,312 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "replay.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+namespace replay {
+
+namespace {
+
+struct LayerResult
+{
+    std::size_t index = 0;
+    std::size_t count = 0;
+    std::string command;
+    int status = 0;
+    std::string error;
+    double wall_ms = 0.0;
+    std::vector<RunReport> runs;
+};
+
+std::string Join(const std::vector<std::string>& args)
+{
+    std::string joined;
+    for(const auto& arg : args)
+    {
+        if(!joined.empty())
+            joined += ' ';
+        joined += arg;
+    }
+    return joined;
+}
+
+float KernelTime(const LayerResult& layer)
+{
+    float time = 0.f;
+    for(const auto& run : layer.runs)
+        time += run.kernel_time_ms;
+    return time;
+}
+
+LayerResult RunCommand(const Command& command, std::size_t index)
+{
+    LayerResult result;
+    result.index   = index;
+    result.count   = command.count;
+    result.command = Join(command.args);
+
+    std::cout << "MIOpenDriver " << result.command << std::endl;
+
+    // argv[0] is the program name, like for a regular launch.
+    std::vector<std::string> storage{"MIOpenDriver"};
+    storage.insert(storage.end(), command.args.begin(), command.args.end());
+    std::vector<char*> argv;
+    for(auto& arg : storage)
+        argv.push_back(arg.data());
+    argv.push_back(nullptr);
+
+    const auto start = std::chrono::steady_clock::now();
+    try
+    {
+        const auto drv = MakeDriver(command.args.front());
+        if(drv == nullptr)
+        {
+            result.status = -1;
+            result.error  = "Incorrect BaseArg";
+        }
+        else
+        {
+            const auto argc = static_cast<int>(storage.size());
+            result.status   = RunDriver(*drv, command.args.front(), argc, argv.data());
+            result.runs = drv->GetRunReports();
+        }
+    }
+    catch(const std::exception& ex)
+    {
+        result.status = -1;
+        result.error  = ex.what();
+    }
+    result.wall_ms = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+    if(!result.error.empty())
+        std::cout << "Replay of layer " << index << " FAILED: " << result.error << std::endl;
+    return result;
+}
+
+void WriteCsv(std::ostream& out, const std::vector<LayerResult>& layers)
+{
+    out << "index,count,command,status,wall_ms,direction,path,solution,workspace,kernel_ms\n";
+    for(const auto& layer : layers)
+    {
+        const auto prefix = [&]() -> std::ostream& {
+            return out << layer.index << ',' << layer.count << ",\"" << layer.command << "\","
+                       << layer.status << ',' << layer.wall_ms << ',';
+        };
+        if(layer.runs.empty())
+            prefix() << ",,,,\n";
+        for(const auto& run : layer.runs)
+        {
+            prefix() << run.direction << ',' << run.path << ',' << run.solution << ','
+                     << run.workspace << ',' << run.kernel_time_ms << '\n';
+        }
+    }
+}
+
+void WriteJson(std::ostream& out,
+               const std::vector<LayerResult>& layers,
+               const nlohmann::json& summary)
+{
+    auto json_layers = nlohmann::json::array();
+    for(const auto& layer : layers)
+    {
+        auto runs = nlohmann::json::array();
+        for(const auto& run : layer.runs)
+        {
+            runs.push_back({{"direction", run.direction},
+                            {"path", run.path},
+                            {"solution", run.solution},
+                            {"workspace", run.workspace},
+                            {"kernel_ms", run.kernel_time_ms}});
+        }
+        auto json_layer = nlohmann::json{{"index", layer.index},
+                                         {"count", layer.count},
+                                         {"command", layer.command},
+                                         {"status", layer.status},
+                                         {"wall_ms", layer.wall_ms},
+                                         {"runs", runs}};
+        if(!layer.error.empty())
+            json_layer["error"] = layer.error;
+        json_layers.push_back(std::move(json_layer));
+    }
+    out << nlohmann::json{{"layers", json_layers}, {"summary", summary}}.dump(2) << std::endl;
+}
+
+bool EndsWith(const std::string& str, const std::string& suffix)
+{
+    return str.size() >= suffix.size() &&
+           str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+std::vector<std::string> ParseLine(const std::string& line)
+{
+    const auto first = line.find_first_not_of(" \t");
+    if(first == std::string::npos || line[first] == '#')
+        return {};
+
+    auto text            = line.substr(first);
+    const auto driver_at = text.find("MIOpenDriver");
+    if(driver_at != std::string::npos)
+    {
+        text = text.substr(driver_at + std::string("MIOpenDriver").size());
+        if(text.compare(0, 4, ".exe") == 0)
+            text = text.substr(4);
+    }
+
+    std::vector<std::string> args;
+    std::istringstream tokens(text);
+    std::string token;
+    while(tokens >> token)
+        args.push_back(token);
+    return args;
+}
+
+std::vector<Command> ReadCommands(std::istream& stream)
+{
+    std::vector<Command> commands;
+    std::unordered_map<std::string, std::size_t> positions;
+    std::string line;
+    while(std::getline(stream, line))
+    {
+        auto args = ParseLine(line);
+        if(args.empty())
+            continue;
+        const auto inserted = positions.emplace(Join(args), commands.size());
+        if(inserted.second)
+            commands.push_back({std::move(args), 0});
+        ++commands[inserted.first->second].count;
+    }
+    return commands;
+}
+
+int Run(int argc, char* argv[])
+{
+    std::string input;
+    std::string output;
+    for(int i = 2; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if(arg == "--replay-output" && i + 1 < argc)
+            output = argv[++i];
+        else if(input.empty())
+            input = arg;
+        else
+            Usage();
+    }
+    if(input.empty())
+    {
+        printf("FAILED: --replay requires a file with driver commands\n");
+        Usage();
+    }
+
+    std::ifstream file(input);
+    if(!file)
+    {
+        std::cout << "FAILED: Cannot open " << input << std::endl;
+        return -1;
+    }
+    const auto commands = ReadCommands(file);
+
+    // All layers share one handle, so databases and compiled kernels are loaded once.
+    miopenHandle_t handle;
+#if MIOPEN_BACKEND_OPENCL
+    miopenCreate(&handle);
+#elif MIOPEN_BACKEND_HIP
+    hipStream_t s;
+    hipStreamCreate(&s);
+    miopenCreateWithStream(&handle, s);
+#endif
+    Driver::shared_handle   = handle;
+    Driver::collect_reports = true;
+
+    std::vector<LayerResult> layers;
+    layers.reserve(commands.size());
+    for(std::size_t i = 0; i < commands.size(); ++i)
+        layers.push_back(RunCommand(commands[i], i));
+
+    Driver::shared_handle   = nullptr;
+    Driver::collect_reports = false;
+    miopenDestroy(handle);
+
+    std::size_t total_count = 0;
+    std::size_t failed      = 0;
+    double wall_ms          = 0.0;
+    double kernel_ms        = 0.0;
+    double weighted_ms      = 0.0;
+    for(const auto& layer : layers)
+    {
+        const auto time = KernelTime(layer);
+        total_count += layer.count;
+        failed += (layer.status != 0) ? 1 : 0;
+        wall_ms += layer.wall_ms;
+        kernel_ms += time;
+        weighted_ms += time * layer.count;
+    }
+
+    std::cout << "Replayed " << layers.size() << " unique layers (" << total_count
+              << " commands), failed: " << failed << ", wall-clock: " << wall_ms
+              << " ms, kernels: " << kernel_ms << " ms, kernels weighted by count: "
+              << weighted_ms << " ms" << std::endl;
+
+    const auto summary = nlohmann::json{{"layers", layers.size()},
+                                        {"commands", total_count},
+                                        {"failed", failed},
+                                        {"wall_ms", wall_ms},
+                                        {"kernel_ms", kernel_ms},
+                                        {"weighted_kernel_ms", weighted_ms}};
+    if(output.empty())
+    {
+        WriteCsv(std::cout, layers);
+    }
+    else
+    {
+        std::ofstream out(output);
+        if(!out)
+        {
+            std::cout << "FAILED: Cannot write " << output << std::endl;
+            return -1;
+        }
+        if(EndsWith(output, ".json"))
+            WriteJson(out, layers, summary);
+        else
+            WriteCsv(out, layers);
+    }
+    return failed == 0 ? 0 : -1;
+}
+
+} // namespace replay
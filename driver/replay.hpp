@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_DRIVER_REPLAY_HPP
+#define GUARD_DRIVER_REPLAY_HPP
+
+#include "driver.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// Instantiates the registered driver for \p base_arg, or returns nullptr.
+/// Defined in main.cpp.
+std::shared_ptr<Driver> MakeDriver(const std::string& base_arg);
+
+/// Parses the command line and runs the GPU passes requested by it.
+/// Defined in main.cpp.
+int RunDriver(Driver& drv, const std::string& base_arg, int argc, char* argv[]);
+
+namespace replay {
+
+/// One unique command line of a replay file.
+struct Command
+{
+    std::vector<std::string> args; // Base argument first, without the program name.
+    std::size_t count = 0;         // Number of occurrences in the replay file.
+};
+
+/// Extracts the driver arguments from a line of the replay file. Accepts both bare
+/// driver command lines and MIOpen log lines containing "MIOpenDriver ...".
+/// Returns an empty vector for blank lines and comments starting with '#'.
+std::vector<std::string> ParseLine(const std::string& line);
+
+/// Reads a replay file and merges identical commands, keeping the order of first occurrence.
+std::vector<Command> ReadCommands(std::istream& stream);
+
+/// Entry point of "MIOpenDriver --replay <file> [--replay-output <file.csv|file.json>]".
+int Run(int argc, char* argv[]);
+
+} // namespace replay
+
+#endif // GUARD_DRIVER_REPLAY_HPP
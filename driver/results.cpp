@@ -0,0 +1,340 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "results.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+namespace results {
+
+namespace {
+
+/// Slowdowns below this fraction of the baseline median are not reported as regressions.
+constexpr double min_slowdown = 0.02;
+/// Significance level of the regression test.
+constexpr double alpha = 0.01;
+/// Fewer samples do not make a meaningful comparison.
+constexpr std::size_t min_compare_samples = 5;
+
+nlohmann::json ToJson(const Stats& stats)
+{
+    return {{"count", stats.count},
+            {"rejected", stats.rejected},
+            {"min", stats.min},
+            {"median", stats.median},
+            {"p90", stats.p90},
+            {"p99", stats.p99},
+            {"mean", stats.mean},
+            {"stddev", stats.stddev}};
+}
+
+nlohmann::json ToJson(const Verification& v)
+{
+    auto json = nlohmann::json{{"passed", v.passed}};
+    if(!std::isnan(v.error))
+    {
+        json["error"]     = v.error;
+        json["tolerance"] = v.tolerance;
+    }
+    return json;
+}
+
+nlohmann::json& RunOf(nlohmann::json& runs, const std::string& direction)
+{
+    for(auto& run : runs)
+    {
+        if(run["direction"] == direction)
+            return run;
+    }
+    runs.push_back({{"direction", direction}});
+    return runs.back();
+}
+
+nlohmann::json CollectRuns(const Driver& drv, const Options& options)
+{
+    auto runs = nlohmann::json::array();
+    for(const auto& series : drv.GetKernelSamples())
+    {
+        if(series.times_ms.empty())
+            continue;
+
+        const auto stats = Summarize(series.times_ms, options.warmup, options.outlier_z);
+        auto& run        = RunOf(runs, series.direction);
+        run["samples"]   = series.times_ms;
+        run["warmup"]    = std::min(options.warmup, series.times_ms.size());
+        run["stats"]     = ToJson(stats);
+        if(stats.count > 0 && stats.median > 0.0)
+        {
+            if(series.flops > 0.0)
+                run["gflops"] = series.flops / stats.median / 1e6;
+            if(series.bytes > 0.0)
+                run["bandwidth_gbs"] = series.bytes / stats.median / 1e6;
+        }
+    }
+    for(const auto& report : drv.GetRunReports())
+    {
+        auto& run        = RunOf(runs, report.direction);
+        run["path"]      = report.path;
+        run["solver"]    = report.solution;
+        run["workspace"] = report.workspace;
+    }
+    for(const auto& verification : drv.GetVerifications())
+        RunOf(runs, verification.first)["verification"] = ToJson(verification.second);
+    return runs;
+}
+
+std::vector<float> SamplesOf(const nlohmann::json& run)
+{
+    if(!run.contains("samples"))
+        return {};
+    return run["samples"].get<std::vector<float>>();
+}
+
+int Compare(nlohmann::json& results, const Options& options)
+{
+    std::ifstream file(options.compare);
+    if(!file)
+    {
+        std::cout << "FAILED: Cannot open " << options.compare << std::endl;
+        return 0;
+    }
+    const auto baseline = nlohmann::json::parse(file);
+    if(baseline.value("command", "") != results["command"])
+    {
+        std::cout << "Warning: The baseline was measured for a different command: "
+                  << baseline.value("command", "") << std::endl;
+    }
+
+    int rc          = 0;
+    auto comparison = nlohmann::json::array();
+    for(const auto& run : results["runs"])
+    {
+        if(!run.contains("samples"))
+            continue;
+        const auto direction = run["direction"].get<std::string>();
+        const auto baseline_run =
+            std::find_if(baseline["runs"].begin(), baseline["runs"].end(), [&](const auto& r) {
+                return r["direction"] == direction;
+            });
+        if(baseline_run == baseline["runs"].end())
+            continue;
+
+        std::vector<double> before;
+        std::vector<double> after;
+        const auto before_stats =
+            Summarize(SamplesOf(*baseline_run), options.warmup, options.outlier_z, &before);
+        const auto after_stats =
+            Summarize(SamplesOf(run), options.warmup, options.outlier_z, &after);
+        if(before.size() < min_compare_samples || after.size() < min_compare_samples)
+        {
+            std::cout << "Comparison of " << direction << " skipped: too few samples"
+                      << std::endl;
+            continue;
+        }
+
+        const auto change     = after_stats.median / before_stats.median - 1.0;
+        const auto p_value    = SlowdownPValue(before, after);
+        const auto regression = p_value < alpha && change > min_slowdown;
+        rc |= regression ? EC_PerfRegression : 0;
+
+        std::cout << (regression ? "REGRESSION " : "Compared ") << direction
+                  << ": median " << before_stats.median << " -> " << after_stats.median
+                  << " ms (" << change * 100.0 << "%), p = " << p_value << std::endl;
+        comparison.push_back({{"direction", direction},
+                              {"baseline_median", before_stats.median},
+                              {"median", after_stats.median},
+                              {"change", change},
+                              {"p_value", p_value},
+                              {"regression", regression}});
+    }
+    results["comparison"] = comparison;
+    return rc;
+}
+
+} // namespace
+
+Options ExtractOptions(int& argc, char* argv[])
+{
+    Options options;
+    int kept = 1;
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool has_value  = i + 1 < argc;
+        if(arg == "--output-json" && has_value)
+            options.output_json = argv[++i];
+        else if(arg == "--compare" && has_value)
+            options.compare = argv[++i];
+        else if(arg == "--warmup" && has_value)
+            options.warmup = std::strtoull(argv[++i], nullptr, 10);
+        else if(arg == "--outlier-z" && has_value)
+            options.outlier_z = std::strtod(argv[++i], nullptr);
+        else
+            argv[kept++] = argv[i];
+    }
+    argc = kept;
+    return options;
+}
+
+double Percentile(const std::vector<double>& sorted, double p)
+{
+    if(sorted.empty())
+        return 0.0;
+    const auto pos   = p * static_cast<double>(sorted.size() - 1);
+    const auto lower = static_cast<std::size_t>(pos);
+    if(lower + 1 >= sorted.size())
+        return sorted.back();
+    return sorted[lower] + (pos - static_cast<double>(lower)) * (sorted[lower + 1] - sorted[lower]);
+}
+
+Stats Summarize(const std::vector<float>& samples,
+                std::size_t warmup,
+                double outlier_z,
+                std::vector<double>* kept)
+{
+    Stats stats;
+    std::vector<double> values;
+    if(warmup < samples.size())
+        values.assign(samples.begin() + warmup, samples.end());
+    std::sort(values.begin(), values.end());
+
+    if(outlier_z > 0.0 && values.size() > 2)
+    {
+        const auto median = Percentile(values, 0.5);
+        std::vector<double> deviations;
+        for(const auto value : values)
+            deviations.push_back(std::abs(value - median));
+        std::sort(deviations.begin(), deviations.end());
+        const auto mad = Percentile(deviations, 0.5);
+        if(mad > 0.0)
+        {
+            // Iglewicz and Hoaglin: modified z-score = 0.6745 * (x - median) / MAD.
+            const auto is_outlier = [&](double value) {
+                return 0.6745 * std::abs(value - median) / mad > outlier_z;
+            };
+            const auto size = values.size();
+            values.erase(std::remove_if(values.begin(), values.end(), is_outlier), values.end());
+            stats.rejected = size - values.size();
+        }
+    }
+
+    stats.count = values.size();
+    if(!values.empty())
+    {
+        stats.min    = values.front();
+        stats.median = Percentile(values, 0.5);
+        stats.p90    = Percentile(values, 0.9);
+        stats.p99    = Percentile(values, 0.99);
+        stats.mean   = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+        double sum   = 0.0;
+        for(const auto value : values)
+            sum += (value - stats.mean) * (value - stats.mean);
+        stats.stddev = values.size() > 1 ? std::sqrt(sum / (values.size() - 1)) : 0.0;
+    }
+
+    if(kept != nullptr)
+        *kept = std::move(values);
+    return stats;
+}
+
+double SlowdownPValue(const std::vector<double>& baseline, const std::vector<double>& current)
+{
+    const auto n1 = static_cast<double>(baseline.size());
+    const auto n2 = static_cast<double>(current.size());
+    if(baseline.empty() || current.empty())
+        return 1.0;
+
+    // Rank the pooled samples, averaging the ranks of ties.
+    std::vector<std::pair<double, bool>> pooled; // (value, is_current)
+    for(const auto value : baseline)
+        pooled.emplace_back(value, false);
+    for(const auto value : current)
+        pooled.emplace_back(value, true);
+    std::sort(pooled.begin(), pooled.end());
+
+    double rank_sum = 0.0;
+    double tie_term = 0.0;
+    for(std::size_t i = 0; i < pooled.size();)
+    {
+        auto j = i;
+        while(j < pooled.size() && pooled[j].first == pooled[i].first)
+            ++j;
+        const auto ties = static_cast<double>(j - i);
+        const auto rank = (static_cast<double>(i + j) + 1.0) / 2.0;
+        for(auto k = i; k < j; ++k)
+            rank_sum += pooled[k].second ? rank : 0.0;
+        tie_term += ties * ties * ties - ties;
+        i = j;
+    }
+
+    const auto n        = n1 + n2;
+    const auto u        = rank_sum - n2 * (n2 + 1.0) / 2.0;
+    const auto mean     = n1 * n2 / 2.0;
+    const auto variance = n1 * n2 / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0)));
+    if(variance <= 0.0)
+        return 1.0;
+    // Normal approximation with continuity correction.
+    const auto z = (u - mean - 0.5) / std::sqrt(variance);
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+int Report(const Driver& drv, const std::string& command, int status, const Options& options)
+{
+    auto results = nlohmann::json{{"command", command},
+                                  {"status", status},
+                                  {"warmup", options.warmup},
+                                  {"outlier_z", options.outlier_z},
+                                  {"runs", CollectRuns(drv, options)}};
+
+    if(drv.GetKernelSamples().empty() ||
+       std::all_of(drv.GetKernelSamples().begin(),
+                   drv.GetKernelSamples().end(),
+                   [](const auto& series) { return series.times_ms.empty(); }))
+    {
+        std::cout << "Warning: No kernel times were collected, run the driver with -t 1"
+                  << std::endl;
+    }
+
+    const auto rc = options.compare.empty() ? 0 : Compare(results, options);
+
+    if(!options.output_json.empty())
+    {
+        std::ofstream out(options.output_json);
+        if(!out)
+            std::cout << "FAILED: Cannot write " << options.output_json << std::endl;
+        else
+            out << results.dump(2) << std::endl;
+    }
+    return rc;
+}
+
+} // namespace results
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_DRIVER_RESULTS_HPP
+#define GUARD_DRIVER_RESULTS_HPP
+
+#include "driver.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace results {
+
+/// Driver-independent options, removed from the command line before the driver parses it.
+struct Options
+{
+    /// --output-json <file>
+    std::string output_json;
+    /// --compare <baseline.json>
+    std::string compare;
+    /// --warmup <n>: leading samples excluded from the statistics.
+    std::size_t warmup = 1;
+    /// --outlier-z <z>: modified z-score limit for the samples, 0 keeps all of them.
+    double outlier_z = 3.5;
+
+    bool Enabled() const { return !output_json.empty() || !compare.empty(); }
+};
+
+/// Extracts the options above from \p argv and shifts the remaining arguments down.
+Options ExtractOptions(int& argc, char* argv[]);
+
+struct Stats
+{
+    std::size_t count    = 0; // Samples used for the statistics.
+    std::size_t rejected = 0; // Outliers dropped after the warmup.
+    double min           = 0.0;
+    double median        = 0.0;
+    double p90           = 0.0;
+    double p99           = 0.0;
+    double mean          = 0.0;
+    double stddev        = 0.0;
+};
+
+/// Linear interpolation between the closest ranks of an ascending sequence, \p p in [0, 1].
+double Percentile(const std::vector<double>& sorted, double p);
+
+/// Drops the first \p warmup samples and those with a modified z-score above \p outlier_z,
+/// and describes the rest. The remaining samples are stored to \p kept unless it is null.
+Stats Summarize(const std::vector<float>& samples,
+                std::size_t warmup,
+                double outlier_z,
+                std::vector<double>* kept = nullptr);
+
+/// One-sided Mann-Whitney U test. Returns the probability of \p current being at least this
+/// much slower than \p baseline if both come from the same distribution.
+double SlowdownPValue(const std::vector<double>& baseline, const std::vector<double>& current);
+
+/// Writes the results of \p drv as JSON and compares them with the baseline, as requested by
+/// \p options. Returns EC_PerfRegression if any direction became significantly slower.
+int Report(const Driver& drv, const std::string& command, int status, const Options& options);
+
+} // namespace results
+
+#endif // GUARD_DRIVER_RESULTS_HPP
@@ -862,6 +862,8 @@ int RNNDriver<Tgpu, Tref>::RunForwardGPU()
     {
         printf("Forward RNN time results:\n");
         t.Print();
+        for(const auto time : t.GetGpuTimes())
+            AddKernelSample(time);
     }
 
     out_dev->FromGPU(GetStream(), out.data());
@@ -1134,6 +1136,8 @@ int RNNDriver<Tgpu, Tref>::RunBackwardGPU()
         {
             printf("Backward Data RNN time results:\n");
             t.Print();
+            for(const auto time : t.GetGpuTimes())
+                AddKernelSample(time);
         }
 
         din_dev->FromGPU(GetStream(), din.data());
@@ -1144,6 +1148,7 @@ int RNNDriver<Tgpu, Tref>::RunBackwardGPU()
 
     if((inflags.GetValueInt("forw") & 4) || (inflags.GetValueInt("forw") == 0))
     {
+        BeginSamples("wrw");
         RNNCombTimeLoger t(GetStream(), inflags.GetValueInt("iter"), inflags.GetValueInt("wall"));
 
         for(int i = 0; i < inflags.GetValueInt("iter"); i++)
@@ -1172,6 +1177,8 @@ int RNNDriver<Tgpu, Tref>::RunBackwardGPU()
         {
             printf("Backward Weights RNN time results:\n");
             t.Print();
+            for(const auto time : t.GetGpuTimes())
+                AddKernelSample(time);
         }
 
         dwei_dev->FromGPU(GetStream(), dwei.data());
@@ -1619,6 +1626,7 @@ int RNNDriver<Tgpu, Tref>::VerifyForward()
 
     Tref tolerance = (sizeof(Tgpu) == 4 ? static_cast<Tref>(1e-6) : static_cast<Tref>(5e-2));
 
+    RecordVerification("fwd", error, tolerance);
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << std::string("Forward RNN FAILED: ") << error << std::endl;
@@ -1716,6 +1724,7 @@ int RNNDriver<Tgpu, Tref>::VerifyBackward()
 
         auto error_data = miopen::rms_range(din_host, din);
 
+        RecordVerification("bwd", error_data, tolerance);
         if(!std::isfinite(error_data) || error_data > tolerance)
         {
             std::cout << std::string("Backward RNN Data FAILED: ") << error_data << std::endl;
@@ -1761,6 +1770,7 @@ int RNNDriver<Tgpu, Tref>::VerifyBackward()
         }
 
         auto error_weights = miopen::rms_range(dwei_host, dwei);
+        RecordVerification("wrw", error_weights, tolerance);
         if(!std::isfinite(error_weights) || error_weights > tolerance)
         {
             std::cout << std::string("Backward RNN Weights FAILED: ") << error_weights << std::endl;
@@ -1114,6 +1114,8 @@ int RNNSeqDriver<Tgpu, Tref>::RunForwardGPU()
     {
         printf("Forward RNN time results:\n");
         t.Print();
+        for(const auto time : t.GetGpuTimes())
+            AddKernelSample(time);
     }
 
     if(io_layout != miopenRNNDataSeqMajorNotPadded)
@@ -1209,6 +1211,8 @@ int RNNSeqDriver<Tgpu, Tref>::RunBackwardGPU()
         {
             printf("Backward Data RNN time results:\n");
             t.Print();
+            for(const auto time : t.GetGpuTimes())
+                AddKernelSample(time);
         }
 
         if(io_layout != miopenRNNDataSeqMajorNotPadded)
@@ -1251,6 +1255,7 @@ int RNNSeqDriver<Tgpu, Tref>::RunBackwardGPU()
 
     if((inflags.GetValueInt("forw") & 4) || (inflags.GetValueInt("forw") == 0))
     {
+        BeginSamples("wrw");
         RNNCombTimeLoger t(GetStream(), inflags.GetValueInt("iter"), inflags.GetValueInt("wall"));
 
         for(int i = 0; i < inflags.GetValueInt("iter"); i++)
@@ -1279,6 +1284,8 @@ int RNNSeqDriver<Tgpu, Tref>::RunBackwardGPU()
         {
             printf("Backward Weights RNN time results:\n");
             t.Print();
+            for(const auto time : t.GetGpuTimes())
+                AddKernelSample(time);
         }
         dwei_dev->FromGPU(GetStream(), dwei.data());
     }
@@ -1716,6 +1723,7 @@ int RNNSeqDriver<Tgpu, Tref>::VerifyForward()
 
     Tref tolerance = (sizeof(Tgpu) == 4 ? static_cast<Tref>(1e-6) : static_cast<Tref>(5e-2));
 
+    RecordVerification("fwd", error, tolerance);
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << std::string("Forward RNN FAILED: ") << error << std::endl;
@@ -1773,6 +1781,7 @@ int RNNSeqDriver<Tgpu, Tref>::VerifyBackward()
 
         auto error_data = miopen::rms_range(din_host, din);
 
+        RecordVerification("bwd", error_data, tolerance);
         if(!std::isfinite(error_data) || error_data > tolerance)
         {
             std::cout << std::string("Backward RNN Data FAILED: ") << error_data << std::endl;
@@ -1818,6 +1827,7 @@ int RNNSeqDriver<Tgpu, Tref>::VerifyBackward()
         }
 
         auto error_weights = miopen::rms_range(dwei_host, dwei);
+        RecordVerification("wrw", error_weights, tolerance);
         if(!std::isfinite(error_weights) || error_weights > tolerance)
         {
             std::cout << std::string("Backward RNN Weights FAILED: ") << error_weights << std::endl;
@@ -257,6 +257,7 @@ int SoftmaxDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
         {
@@ -328,6 +329,7 @@ int SoftmaxDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
         {
@@ -375,6 +377,7 @@ int SoftmaxDriver<Tgpu, Tref>::VerifyForward()
 
     auto error           = miopen::rms_range(outhost, out);
     const Tref tolerance = data_type == miopenHalf ? 5e-2 : 1e-3; // 1e-6;
+    RecordVerification("fwd", error, tolerance);
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << "Forward Softmax FAILED: " << error << std::endl;
@@ -410,6 +413,7 @@ int SoftmaxDriver<Tgpu, Tref>::VerifyBackward()
     auto error           = miopen::rms_range(dinhost, din);
     const Tref tolerance = data_type == miopenHalf ? 5e-2 : 1e-3; // 1e-6;
 
+    RecordVerification("bwd", error, tolerance);
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << "Backward Softmax FAILED: " << error << std::endl;
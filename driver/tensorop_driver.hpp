@@ -295,6 +295,7 @@ int TensorOpDriver<Tgpu, Tref>::RunForwardGPU()
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
+            AddKernelSample(time);
             min_time = (time < min_time) ? time : min_time;
             if(iters > 1)
                 avgtime += time;
@@ -257,6 +257,24 @@ public:
                n_iter > 1 ? host_avg / (n_iter - 1) : hostTimePerLaunch[0]);
     }
 
+    /// GPU time of every launch, in milliseconds.
+    std::vector<float> GetGpuTimes() const
+    {
+        std::vector<float> times;
+        auto n_iter = hostTimePerLaunch.size();
+        if(clockMode == ClockMode::Disabled || n_iter == 0)
+            return times;
+
+        hipEventSynchronize(endEvent[n_iter - 1].get());
+        for(auto i = 0ull; i < n_iter; ++i)
+        {
+            float gpu_time = 0.0f;
+            hipEventElapsedTime(&gpu_time, startEvent[i].get(), endEvent[i].get());
+            times.push_back(gpu_time);
+        }
+        return times;
+    }
+
     enum class ClockMode
     {
         Disabled                = 0,
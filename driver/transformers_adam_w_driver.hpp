@@ -369,6 +369,7 @@ int TransformersAdamWDriver<Tgpu, Tref, Tgrad>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
+        AddKernelSample(time);
         kernel_total_time += time;
         if(i == 0)
             kernel_first_time = time;
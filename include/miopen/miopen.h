@@ -266,6 +266,100 @@ MIOPEN_EXPORT miopenStatus_t miopenGetKernelTime(miopenHandle_t handle, float* t
  * @return           miopenStatus_t
  */
 MIOPEN_EXPORT miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enable);
+
+#ifdef MIOPEN_BETA_API
+/*! @brief Reads a counter of the process-wide metrics registry
+ *
+ * Available counters are "find_db.hits", "find_db.misses", "perf_db.hits", "perf_db.misses",
+ * "kernel_cache.hits", "kernel_cache.misses", "invoker_cache.hits", "invoker_cache.misses",
+ * "binary_cache.hits", "binary_cache.misses" and "immediate.fallbacks". A counter which has not
+ * been updated yet reads as zero.
+ *
+ * @param name       Name of the counter (input)
+ * @param value      Pointer to the value of the counter (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetMetricCounter(const char* name, size_t* value);
+
+/*! @brief Reads a percentile of a latency histogram of the process-wide metrics registry
+ *
+ * Histograms are kept for the convolution entry points under their function names, e.g.
+ * "miopenConvolutionForward", for "miopenFindSolutions" and "miopenRunSolution", and for the
+ * "LoadBinary" kernel cache lookups and "Compile" kernel builds. The latency is accurate to
+ * 12.5%. An unknown or empty histogram reports a zero latency and count.
+ *
+ * @param name       Name of the histogram (input)
+ * @param percentile Percentile in the [0, 100] range (input)
+ * @param latency    Pointer to the latency in milliseconds (output)
+ * @param count      Pointer to the number of recorded calls. Ignored if null (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetMetricLatency(const char* name,
+                                                    float percentile,
+                                                    float* latency,
+                                                    size_t* count);
+
+/*! @brief Writes all counters and latency histograms as JSON
+ *
+ * The same data is written at exit to the file set by the MIOPEN_METRICS_FILE environment
+ * variable.
+ *
+ * @param path       Path to the output file (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDumpMetrics(const char* path);
+
+/*! @brief Resets all counters and latency histograms to zero
+ *
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenResetMetrics();
+
+/*! @brief Reads back the deferred numerics checks of a handle
+ *
+ * With the 0x20 bit of MIOPEN_CHECK_NUMERICS set, the checks of the inputs and outputs do not
+ * synchronize. Their results are kept on the device and read back once
+ * MIOPEN_CHECK_NUMERICS_INTERVAL tensors have been checked. This call reads back the pending
+ * results immediately, reports them according to MIOPEN_CHECK_NUMERICS and returns the totals
+ * since the handle was created.
+ *
+ * @param handle     MIOpen handle (input)
+ * @param checked    Pointer to the number of checked tensors. Ignored if null (output)
+ * @param abnormal   Pointer to the number of tensors with a NaN or an Inf. Ignored if null (output)
+ * @param absMax     Pointer to the largest absolute value seen. Ignored if null (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFlushNumericsChecks(miopenHandle_t handle,
+                                                       size_t* checked,
+                                                       size_t* abnormal,
+                                                       float* absMax);
+
+/*! @brief Statistics of the pool that caches the internal scratch buffers of a handle
+ */
+typedef struct
+{
+    size_t hits;          /*!< Requests served from the cache */
+    size_t misses;        /*!< Requests that went to the allocator */
+    size_t releases;      /*!< Cached buffers given back to the allocator */
+    size_t bytesInUse;    /*!< Bytes of the buffers currently in use */
+    size_t bytesCached;   /*!< Bytes of the buffers kept for reuse */
+    size_t peakBytes;     /*!< Largest sum of bytesInUse and bytesCached so far */
+    size_t buffersInUse;  /*!< Number of the buffers currently in use */
+    size_t buffersCached; /*!< Number of the buffers kept for reuse */
+} miopenBufferPoolStats_t;
+
+/*! @brief Reads the statistics of the internal scratch buffer pool of a handle
+ *
+ * The size of the cache is limited by the MIOPEN_BUFFER_POOL_HIGH_WATERMARK environment variable,
+ * in MiB.
+ *
+ * @param handle     MIOpen handle (input)
+ * @param stats      Pointer to the statistics (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetBufferPoolStats(miopenHandle_t handle,
+                                                      miopenBufferPoolStats_t* stats);
+#endif
 /** @} */
 // CLOSEOUT HANDLE DOXYGEN GROUP
 
@@ -1169,6 +1263,38 @@ MIOPEN_EXPORT miopenStatus_t miopenGetConvolutionAttribute(miopenConvolutionDesc
                                                            const miopenConvolutionAttrib_t attr,
                                                            int* value);
 
+#ifdef MIOPEN_BETA_API
+/*! @brief User-supplied cost of a solution used to choose among solutions that trade execution time
+ * for workspace size or determinism. Lower cost is better.
+ *
+ * @param time          Execution time of the solution, ms
+ * @param workspaceSize Workspace required by the solution, bytes
+ * @param deterministic 1 if the solution produces deterministic results, 0 otherwise
+ * @param userData      Pointer passed along with the function
+ * @return              Cost of the solution
+ */
+typedef double (*miopenSolutionCostFunction_t)(float time,
+                                               size_t workspaceSize,
+                                               int deterministic,
+                                               void* userData);
+
+/*! @brief Sets the selection policy used by immediate mode and Find for the convolution.
+ *
+ * Only Pareto-optimal solutions are returned, i.e. those that no other solution beats in all of
+ * execution time, workspace size and determinism. They are ordered by the cost function, the
+ * cheapest first.
+ *
+ * @param convDesc  Convolution layer descriptor (input)
+ * @param cost      Cost function. Null restores the default ordering by time
+ * @param userData  Pointer passed to the cost function
+ * @return          miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenSetConvolutionSelectionPolicy(miopenConvolutionDescriptor_t convDesc,
+                                    miopenSolutionCostFunction_t cost,
+                                    void* userData);
+#endif
+
 /*! @enum miopenConvFwdAlgorithm_t
  * Convolutional algorithm mode for forward propagation. MIOpen use cross-correlation for its
  * convolution implementation.
@@ -5877,6 +6003,21 @@ MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionPreallocatedTensor(miopenFindOpt
 MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionAttachBinaries(miopenFindOptions_t options,
                                                                unsigned attach);
 
+#ifdef MIOPEN_BETA_API
+/*! @brief Sets the selection policy for the find call. Only Pareto-optimal solutions over
+ * execution time, workspace size and determinism are returned, ordered by the cost function. The
+ * results order option is ignored while the policy is set.
+ *
+ * @param options    Options object to update
+ * @param cost       Cost function. Null restores the default ordering
+ * @param userData   Pointer passed to the cost function
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionSelectionPolicy(miopenFindOptions_t options,
+                                                                miopenSolutionCostFunction_t cost,
+                                                                void* userData);
+#endif
+
 /*! @brief The miopenSolution object describes a prepared solution.
  */
 MIOPEN_DECLARE_OBJECT(miopenSolution);
@@ -5899,6 +6040,21 @@ MIOPEN_EXPORT miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
                                                  size_t* numSolutions,
                                                  size_t maxSolutions);
 
+#ifdef MIOPEN_BETA_API
+/*! @brief Tunes the convolution problems queued for background tuning.
+ *
+ * With MIOPEN_BACKGROUND_TUNING enabled, immediate mode queues the problems it has no FindDb record
+ * for in a file in the user database directory. This function runs exhaustive search for each of
+ * them and removes them from the queue, so the results land in the user FindDb and PerfDb. It is
+ * intended for a separate process that tunes while the application is not running.
+ *
+ * @param handle   Handle to execute the kernels
+ * @param numTuned Pointer to the amount of tuned problems. Ignored if null
+ * @return         miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenTuneQueuedProblems(miopenHandle_t handle, size_t* numTuned);
+#endif
+
 /*! @brief Values of a tensor or scalar argument for the miopenRunSolution function.
  */
 struct miopenTensorArgument_t
@@ -5944,6 +6100,8 @@ MIOPEN_EXPORT miopenStatus_t miopenRunSolution(miopenHandle_t handle,
 MIOPEN_EXPORT miopenStatus_t miopenDestroySolution(miopenSolution_t solution);
 
 /*! @brief Loads solution object from binary data.
+ *
+ * Solution archives holding a single solution are accepted as well.
  *
  * @param solution   Pointer to the solution to load
  * @param data       Data to load the solution from
@@ -5970,6 +6128,63 @@ MIOPEN_EXPORT miopenStatus_t miopenSaveSolution(miopenSolution_t solution, char*
  */
 MIOPEN_EXPORT miopenStatus_t miopenGetSolutionSize(miopenSolution_t solution, size_t* size);
 
+#ifdef MIOPEN_BETA_API
+/*! @brief Saves several solutions to a single archive file.
+ *
+ * Kernel binaries shared by the solutions are stored once. Loading the archive maps the file and
+ * creates the kernel modules straight from the mapping.
+ *
+ * @param solutions  Array of the solutions to save
+ * @param count      Number of the solutions
+ * @param path       Path to the archive file
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSaveSolutions(const miopenSolution_t* solutions,
+                                                 size_t count,
+                                                 const char* path);
+
+/*! @brief Loads all the solutions of an archive file.
+ *
+ * The loaded solutions have to be destroyed with miopenDestroySolution.
+ *
+ * @param path       Path to the archive file
+ * @param solutions  Array to store the loaded solutions in. If it is null, only the number of
+ * the solutions in the archive is returned
+ * @param count      Capacity of the solutions array on input, number of the loaded solutions on
+ * output
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenLoadSolutions(const char* path,
+                                                 miopenSolution_t* solutions,
+                                                 size_t* count);
+
+/*! @brief Saves the convolution invokers prepared so far on the device of the handle, along with
+ * their kernel binaries, to a single snapshot file.
+ *
+ * Only invokers prepared while MIOPEN_INVOKER_SNAPSHOT is enabled are recorded.
+ *
+ * @param handle    MIOpen handle
+ * @param path      Path to the snapshot file
+ * @param numSaved  Pointer to the amount of saved solutions. Ignored if null
+ * @return          miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSaveInvokerSnapshot(miopenHandle_t handle,
+                                                       const char* path,
+                                                       size_t* numSaved);
+
+/*! @brief Loads a snapshot saved by miopenSaveInvokerSnapshot and registers all of its invokers
+ * with the handle, so subsequent convolution calls do not compile or load kernels.
+ *
+ * @param handle    MIOpen handle
+ * @param path      Path to the snapshot file
+ * @param numLoaded Pointer to the amount of loaded invokers. Ignored if null
+ * @return          miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenLoadInvokerSnapshot(miopenHandle_t handle,
+                                                       const char* path,
+                                                       size_t* numLoaded);
+#endif
+
 /*! @brief Reads the amount of workspace required to exectute the solution.
  *
  * @param solution      Solution to get required workspace size
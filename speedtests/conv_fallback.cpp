@@ -0,0 +1,202 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/applicability_index.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/tensor.hpp>
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace conv_fallback {
+
+struct Layer
+{
+    std::string name;
+    std::vector<int> in;  // N, C, spatial...
+    std::vector<int> wei; // K, C/G, spatial...
+    std::vector<int> pads;
+    std::vector<int> strides;
+    int groups;
+};
+
+// Layers of ResNet-50, MobileNet-V2 and a 3D U-Net
+static const std::vector<Layer>& Corpus()
+{
+    static const std::vector<Layer> layers = {
+        {"resnet50.conv1", {32, 3, 224, 224}, {64, 3, 7, 7}, {3, 3}, {2, 2}, 1},
+        {"resnet50.res2a_1x1", {32, 64, 56, 56}, {64, 64, 1, 1}, {0, 0}, {1, 1}, 1},
+        {"resnet50.res2a_3x3", {32, 64, 56, 56}, {64, 64, 3, 3}, {1, 1}, {1, 1}, 1},
+        {"resnet50.res2a_expand", {32, 64, 56, 56}, {256, 64, 1, 1}, {0, 0}, {1, 1}, 1},
+        {"resnet50.res3a_3x3", {32, 128, 56, 56}, {128, 128, 3, 3}, {1, 1}, {2, 2}, 1},
+        {"resnet50.res4a_3x3", {32, 256, 28, 28}, {256, 256, 3, 3}, {1, 1}, {2, 2}, 1},
+        {"resnet50.res5a_3x3", {32, 512, 14, 14}, {512, 512, 3, 3}, {1, 1}, {2, 2}, 1},
+        {"resnet50.res5c_1x1", {32, 512, 7, 7}, {2048, 512, 1, 1}, {0, 0}, {1, 1}, 1},
+        {"mobilenetv2.dw_112", {32, 96, 112, 112}, {96, 1, 3, 3}, {1, 1}, {2, 2}, 96},
+        {"mobilenetv2.dw_14", {32, 384, 14, 14}, {384, 1, 3, 3}, {1, 1}, {1, 1}, 384},
+        {"mobilenetv2.project", {32, 384, 14, 14}, {64, 384, 1, 1}, {0, 0}, {1, 1}, 1},
+        {"unet3d.enc1", {1, 32, 64, 64, 64}, {32, 32, 3, 3, 3}, {1, 1, 1}, {1, 1, 1}, 1},
+        {"unet3d.down2", {1, 64, 32, 32, 32}, {128, 64, 3, 3, 3}, {1, 1, 1}, {2, 2, 2}, 1},
+        {"unet3d.bottleneck", {1, 256, 8, 8, 8}, {256, 256, 3, 3, 3}, {1, 1, 1}, {1, 1, 1}, 1},
+    };
+    return layers;
+}
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(layout, "layout");
+    }
+
+    void run()
+    {
+        const auto nhwc = layout == "nhwc";
+
+        Handle handle;
+        ExecutionContext ctx{&handle};
+        auto& index    = conv::ApplicabilityIndex::Instance();
+        const auto max = solver::GetSolversByPrimitive(solver::Primitive::Convolution).size();
+
+        std::cout << std::left << std::setw(26) << "layer" << std::setw(6) << "dir" << std::right
+                  << std::setw(12) << "cold, us" << std::setw(12) << "warm, us" << std::setw(8)
+                  << "found" << std::endl;
+
+        double total_cold = 0;
+        double total_warm = 0;
+
+        for(const auto& layer : Corpus())
+        {
+            for(const auto direction : {conv::Direction::Forward,
+                                        conv::Direction::BackwardData,
+                                        conv::Direction::BackwardWeights})
+            {
+                const auto conv    = MakeConvolution(layer);
+                const auto problem = MakeProblem(layer, conv, direction, type, nhwc);
+
+                std::size_t found = 0;
+                const auto cold   = Time([&] {
+                    index.Clear();
+                    found = conv.GetSolutionsFallback(ctx, problem, max).size();
+                });
+                const auto warm = Time([&] { conv.GetSolutionsFallback(ctx, problem, max); });
+
+                total_cold += cold;
+                total_warm += warm;
+
+                std::cout << std::left << std::setw(26) << layer.name << std::setw(6)
+                          << DirectionName(direction) << std::right << std::fixed
+                          << std::setprecision(1) << std::setw(12) << cold << std::setw(12)
+                          << warm << std::setw(8) << found << std::endl;
+            }
+        }
+
+        const auto stats = index.GetStats();
+        std::cout << "total: cold " << total_cold << " us, warm " << total_warm << " us, "
+                  << stats.hits << " hits, " << stats.misses << " misses, " << stats.entries
+                  << " entries" << std::endl;
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Permitted layouts: nchw, nhwc" << std::endl;
+        std::cout << "Times ConvolutionDescriptor::GetSolutionsFallback with an empty (cold) "
+                     "and a populated (warm) applicability index"
+                  << std::endl;
+    }
+
+private:
+    int iterations     = 20;
+    std::string layout = "nchw";
+
+    template <class F>
+    double Time(F f) const
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; i++)
+            f();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+    }
+
+    static const char* DirectionName(conv::Direction direction)
+    {
+        switch(direction)
+        {
+        case conv::Direction::Forward: return "fwd";
+        case conv::Direction::BackwardData: return "bwd";
+        case conv::Direction::BackwardWeights: return "wrw";
+        }
+        return "";
+    }
+
+    static ConvolutionDescriptor MakeConvolution(const Layer& layer)
+    {
+        const auto dilations = std::vector<int>(layer.pads.size(), 1);
+        const auto zeros     = std::vector<int>(layer.pads.size(), 0);
+        return {layer.pads, layer.strides, dilations, zeros, layer.groups};
+    }
+
+    static conv::ProblemDescription MakeProblem(const Layer& layer,
+                                                const ConvolutionDescriptor& conv,
+                                                conv::Direction direction,
+                                                miopenDataType_t data_type,
+                                                bool nhwc)
+    {
+        const auto is_3d  = layer.in.size() == 5;
+        const auto layout = nhwc ? (is_3d ? miopenTensorNDHWC : miopenTensorNHWC)
+                                 : (is_3d ? miopenTensorNCDHW : miopenTensorNCHW);
+
+        const auto in  = TensorDescriptor{data_type, layout, layer.in};
+        const auto wei = TensorDescriptor{data_type, layout, layer.wei};
+        const auto out = conv.GetForwardOutputTensor(in, wei, data_type);
+
+        if(direction == conv::Direction::Forward)
+            return {in, wei, out, conv, direction};
+        return {out, wei, in, conv, direction};
+    }
+};
+
+} // namespace conv_fallback
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv_fallback::SpeedTestDriver>(argc, argv);
+    return 0;
+}
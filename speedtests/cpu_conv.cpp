@@ -0,0 +1,283 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cpu_conv.hpp>
+#include <driver.hpp>
+#include <random.hpp>
+#include <tensor_holder.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace cpu_conv {
+
+struct ConvCase
+{
+    std::string name;
+    std::vector<int> in;
+    std::vector<int> wei;
+    std::vector<int> pads;
+    std::vector<int> strides;
+    std::vector<int> dilations;
+    int groups;
+};
+
+// Representative layers of ResNet-50 (batch 4) and of a 3D U-Net (batch 1)
+static const std::vector<ConvCase>& ResNetCases()
+{
+    static const std::vector<ConvCase> cases = {
+        {"resnet.conv1", {4, 3, 224, 224}, {64, 3, 7, 7}, {3, 3}, {2, 2}, {1, 1}, 1},
+        {"resnet.res2.3x3", {4, 64, 56, 56}, {64, 64, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        {"resnet.res2.1x1", {4, 64, 56, 56}, {256, 64, 1, 1}, {0, 0}, {1, 1}, {1, 1}, 1},
+        {"resnet.res3.3x3", {4, 128, 28, 28}, {128, 128, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        {"resnet.res4.3x3", {4, 256, 14, 14}, {256, 256, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        {"resnext.res3.g32", {4, 256, 28, 28}, {256, 8, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 32},
+    };
+    return cases;
+}
+
+static const std::vector<ConvCase>& UNet3dCases()
+{
+    static const std::vector<ConvCase> cases = {
+        {"unet3d.enc1", {1, 32, 64, 64, 64}, {32, 32, 3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, 1},
+        {"unet3d.enc2", {1, 64, 32, 32, 32}, {64, 64, 3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, 1},
+        {"unet3d.down",
+         {1, 64, 32, 32, 32},
+         {128, 64, 3, 3, 3},
+         {1, 1, 1},
+         {2, 2, 2},
+         {1, 1, 1},
+         1},
+        {"unet3d.enc4", {1, 256, 8, 8, 8}, {256, 256, 3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, 1},
+    };
+    return cases;
+}
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(set, "set");
+        add(direction, "direction");
+        add(iterations, "iterations");
+        add(naive, "naive", flag());
+    }
+
+    void run()
+    {
+        std::vector<ConvCase> cases;
+        if(set == "resnet" || set == "all")
+            cases = ResNetCases();
+        if(set == "unet3d" || set == "all")
+            cases.insert(cases.end(), UNet3dCases().begin(), UNet3dCases().end());
+        if(cases.empty())
+        {
+            std::cerr << "Unknown set." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        for(const auto& c : cases)
+            RunCase(c);
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Permitted sets: resnet, unet3d, all" << std::endl;
+        std::cout << "Permitted directions: fwd, bwd, wrw, all" << std::endl;
+        std::cout << "--naive also times the direct loops (slow) and reports the max difference"
+                  << std::endl;
+    }
+
+private:
+    std::string set       = "resnet";
+    std::string direction = "all";
+    int iterations        = 1;
+    bool naive            = false;
+
+    template <class F>
+    double Time(F f) const
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; i++)
+            f();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - start).count() / iterations;
+    }
+
+    template <class T>
+    static double MaxDiff(const tensor<T>& a, const tensor<T>& b)
+    {
+        double diff = 0;
+        for(std::size_t i = 0; i < a.data.size(); ++i)
+            diff = std::max(diff, std::abs(double(a.data[i]) - double(b.data[i])));
+        return diff;
+    }
+
+    void Report(const ConvCase& c,
+                const std::string& dir,
+                double flops,
+                double gemm_time,
+                double naive_time,
+                double diff) const
+    {
+        std::cout << std::left << std::setw(20) << c.name << std::setw(5) << dir << std::right
+                  << std::fixed << std::setprecision(4) << std::setw(10) << gemm_time << " s "
+                  << std::setprecision(2) << std::setw(8) << flops / gemm_time * 1e-9 << " GFLOP/s";
+        if(naive)
+        {
+            std::cout << "  naive " << std::setprecision(4) << naive_time << " s, speedup "
+                      << std::setprecision(1) << naive_time / gemm_time << "x, max diff "
+                      << std::scientific << std::setprecision(2) << diff;
+        }
+        std::cout << std::defaultfloat << std::endl;
+    }
+
+    template <std::size_t ConvDim>
+    void RunCaseImpl(const ConvCase& c) const
+    {
+        std::vector<int> out_len = {c.in[0], c.wei[0]};
+        for(std::size_t i = 0; i < ConvDim; ++i)
+        {
+            const auto extent = c.dilations[i] * (c.wei[i + 2] - 1) + 1;
+            out_len.push_back((c.in[i + 2] + 2 * c.pads[i] - extent) / c.strides[i] + 1);
+        }
+
+        auto gen = [](auto...) { return prng::gen_A_to_B(-1.0f, 1.0f); };
+
+        tensor<float> in{c.in};
+        tensor<float> wei{c.wei};
+        tensor<float> out{out_len};
+        in.generate(gen);
+        wei.generate(gen);
+        out.generate(gen);
+
+        const double flops = 2.0 * out.desc.GetElementSize() * wei.desc.GetElementSize() /
+                       static_cast<double>(c.wei[0]);
+
+        const auto run_fwd = direction == "fwd" || direction == "all";
+        const auto run_bwd = direction == "bwd" || direction == "all";
+        const auto run_wrw = direction == "wrw" || direction == "all";
+
+        if(run_fwd)
+        {
+            auto ref        = out;
+            double naive_t  = 0;
+            const auto gemm = Time([&] {
+                cpu_convolution_forward(
+                    ConvDim, in, wei, out, c.pads, c.strides, c.dilations, c.groups);
+            });
+            if(naive)
+            {
+                naive_t = Time([&] {
+                    cpu_convolution_forward_impl<ConvDim, double>(in,
+                                                                  wei,
+                                                                  ref,
+                                                                  c.pads,
+                                                                  c.strides,
+                                                                  c.dilations,
+                                                                  c.groups,
+                                                                  PassThru<float>{},
+                                                                  PassThru<float>{});
+                });
+            }
+            Report(c, "fwd", flops, gemm, naive_t, naive ? MaxDiff(out, ref) : 0.0);
+        }
+
+        if(run_bwd)
+        {
+            auto ref        = in;
+            double naive_t  = 0;
+            const auto gemm = Time([&] {
+                cpu_convolution_backward_data(
+                    ConvDim, in, wei, out, c.pads, c.strides, c.dilations, c.groups);
+            });
+            if(naive)
+            {
+                naive_t = Time([&] {
+                    cpu_convolution_backward_data_impl<ConvDim, double>(ref,
+                                                                        wei,
+                                                                        out,
+                                                                        c.pads,
+                                                                        c.strides,
+                                                                        c.dilations,
+                                                                        c.groups,
+                                                                        PassThru<float>{},
+                                                                        PassThru<float>{});
+                });
+            }
+            Report(c, "bwd", flops, gemm, naive_t, naive ? MaxDiff(in, ref) : 0.0);
+        }
+
+        if(run_wrw)
+        {
+            auto ref        = wei;
+            double naive_t  = 0;
+            const auto gemm = Time([&] {
+                cpu_convolution_backward_weight(
+                    ConvDim, in, wei, out, c.pads, c.strides, c.dilations, c.groups);
+            });
+            if(naive)
+            {
+                naive_t = Time([&] {
+                    cpu_convolution_backward_weight_impl<ConvDim, double>(in,
+                                                                          ref,
+                                                                          out,
+                                                                          c.pads,
+                                                                          c.strides,
+                                                                          c.dilations,
+                                                                          c.groups,
+                                                                          PassThru<float>{},
+                                                                          PassThru<float>{});
+                });
+            }
+            Report(c, "wrw", flops, gemm, naive_t, naive ? MaxDiff(wei, ref) : 0.0);
+        }
+    }
+
+    void RunCase(const ConvCase& c) const
+    {
+        switch(c.in.size())
+        {
+        case 4: RunCaseImpl<2>(c); break;
+        case 5: RunCaseImpl<3>(c); break;
+        default: MIOPEN_THROW("Unsupported case " + c.name);
+        }
+    }
+};
+} // namespace cpu_conv
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::cpu_conv::SpeedTestDriver>(argc, argv);
+    return 0;
+}
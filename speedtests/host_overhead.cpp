@@ -0,0 +1,422 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/db.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/graphapi/convolution.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/util.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/miopen.h>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace host_overhead {
+
+// A body runs one operation; a benchmark prepares the state once and returns its body.
+using Body      = std::function<void()>;
+using Benchmark = std::pair<std::string, std::function<Body()>>;
+
+struct Result
+{
+    std::string name;
+    std::size_t iterations = 0;
+    double real_ns         = 0.0;
+    double cpu_ns          = 0.0;
+    std::string skipped; // The reason, when the benchmark could not be prepared.
+};
+
+// ResNet-50 res2a 3x3
+const std::vector<int> in_lens  = {32, 64, 56, 56};
+const std::vector<int> wei_lens = {64, 64, 3, 3};
+
+void Check(miopenStatus_t status, const char* call)
+{
+    if(status != miopenStatusSuccess)
+        MIOPEN_THROW(status, std::string(call) + " failed");
+}
+
+struct ConvLayer
+{
+    TensorDescriptor x{miopenFloat, in_lens};
+    TensorDescriptor w{miopenFloat, wei_lens};
+    ConvolutionDescriptor conv{{1, 1}, {1, 1}, {1, 1}};
+    TensorDescriptor y = conv.GetForwardOutputTensor(x, w, miopenFloat);
+
+    conv::ProblemDescription Problem() const
+    {
+        return {x, w, y, conv, conv::Direction::Forward};
+    }
+};
+
+constexpr const char* BackendName()
+{
+#if MIOPEN_BACKEND_OPENCL
+    return "OpenCL";
+#elif MIOPEN_MODE_NOGPU
+    return "HIPNOGPU";
+#else
+    return "HIP";
+#endif
+}
+
+/// Writes the results in the JSON format of Google Benchmark, so that the existing tooling
+/// for that format can trend them.
+void WriteJson(const std::string& path, const std::vector<Result>& results)
+{
+    std::ofstream out(path);
+    if(!out)
+        MIOPEN_THROW("Unable to write " + path);
+
+    std::size_t major = 0, minor = 0, patch = 0;
+    miopenGetVersion(&major, &minor, &patch);
+
+    out << "{\n  \"context\": {\n"
+        << "    \"executable\": \"speedtest_host_overhead\",\n"
+        << "    \"library_version\": \"" << major << '.' << minor << '.' << patch << "\",\n"
+        << "    \"backend\": \"" << BackendName() << "\"\n"
+        << "  },\n  \"benchmarks\": [";
+    auto first = true;
+    for(const auto& result : results)
+    {
+        out << (first ? "\n" : ",\n") << "    {\"name\": \"" << result.name
+            << "\", \"run_type\": \"iteration\"";
+        if(!result.skipped.empty())
+        {
+            out << ", \"error_occurred\": true, \"error_message\": \"skipped\"}";
+        }
+        else
+        {
+            out << ", \"iterations\": " << result.iterations << ", \"real_time\": " << std::fixed
+                << std::setprecision(1) << result.real_ns << ", \"cpu_time\": " << result.cpu_ns
+                << ", \"time_unit\": \"ns\"}";
+        }
+        first = false;
+    }
+    out << "\n  ]\n}\n";
+}
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(min_time_ms, "min-time-ms");
+        add(filter, "filter");
+        add(output, "output");
+    }
+
+    void run()
+    {
+        std::vector<Result> results;
+
+        std::cout << std::left << std::setw(36) << "benchmark" << std::right << std::setw(12)
+                  << "iterations" << std::setw(14) << "real, ns" << std::setw(14) << "cpu, ns"
+                  << std::endl;
+
+        for(const auto& benchmark : Benchmarks())
+        {
+            if(!filter.empty() && benchmark.first.find(filter) == std::string::npos)
+                continue;
+
+            const auto result = Run(benchmark);
+            std::cout << std::left << std::setw(36) << result.name << std::right;
+            if(result.skipped.empty())
+            {
+                std::cout << std::setw(12) << result.iterations << std::fixed
+                          << std::setprecision(1) << std::setw(14) << result.real_ns
+                          << std::setw(14) << result.cpu_ns << std::endl;
+            }
+            else
+            {
+                std::cout << "  skipped: " << result.skipped << std::endl;
+            }
+            results.push_back(result);
+        }
+
+        if(!output.empty())
+            WriteJson(output, results);
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Times the host side of MIOpen API calls. Kernel launches are replaced by "
+                     "no-op invokers where the call would reach the GPU, so the suite also runs "
+                     "on the HIPNOGPU backend. --output writes Google Benchmark JSON."
+                  << std::endl;
+    }
+
+private:
+    int min_time_ms = 200;
+    std::string filter;
+    std::string output;
+
+    Result Run(const Benchmark& benchmark) const
+    {
+        Result result;
+        result.name = benchmark.first;
+
+        Body body;
+        try
+        {
+            body = benchmark.second();
+            body(); // warm-up
+        }
+        catch(const std::exception& ex)
+        {
+            result.skipped = ex.what();
+            return result;
+        }
+
+        // Double the batch until it runs for the minimal time.
+        using clock = std::chrono::steady_clock;
+        const auto min_time = std::chrono::milliseconds{min_time_ms};
+        for(std::size_t batch = 1;; batch *= 2)
+        {
+            const auto cpu_start = std::clock();
+            const auto start     = clock::now();
+            for(std::size_t i = 0; i < batch; ++i)
+                body();
+            const auto elapsed = clock::now() - start;
+            const auto cpu_end = std::clock();
+
+            if(elapsed >= min_time || batch >= (std::size_t{1} << 30))
+            {
+                result.iterations = batch;
+                result.real_ns =
+                    std::chrono::duration<double, std::nano>(elapsed).count() / batch;
+                result.cpu_ns = 1e9 * static_cast<double>(cpu_end - cpu_start) /
+                                CLOCKS_PER_SEC / static_cast<double>(batch);
+                return result;
+            }
+        }
+    }
+
+    static std::vector<Benchmark> Benchmarks()
+    {
+        return {
+            {"tensor_descriptor.construct",
+             [] {
+                 return [] {
+                     const auto desc = TensorDescriptor{miopenFloat, in_lens};
+                     (void)desc;
+                 };
+             }},
+            {"tensor_descriptor.c_api",
+             [] {
+                 return [] {
+                     miopenTensorDescriptor_t desc;
+                     miopenCreateTensorDescriptor(&desc);
+                     miopenSet4dTensorDescriptor(desc, miopenFloat, 32, 64, 56, 56);
+                     miopenDestroyTensorDescriptor(desc);
+                 };
+             }},
+            {"conv.make_network_config",
+             [] {
+                 auto layer = std::make_shared<ConvLayer>();
+                 return [layer] {
+                     const auto config = layer->Problem().MakeNetworkConfig();
+                     (void)config;
+                 };
+             }},
+            {"find_db.find_record", [] { return DbLookup(DbKinds::FindDb); }},
+            {"perf_db.find_record", [] { return DbLookup(DbKinds::PerfDb); }},
+            {"conv.forward_immediate", ConvForwardImmediate},
+            {"fusion.compile_warm", FusionCompile},
+            {"graph.finalize", [] { return GraphFinalize; }},
+        };
+    }
+
+    /// Looks up a record among a thousand in a database file, as Find and tuning do.
+    static Body DbLookup(DbKinds kind)
+    {
+        struct State
+        {
+            TmpDir dir{"host_overhead"};
+            ConvLayer layer;
+            std::unique_ptr<PlainTextDb> perf_db;
+            const ReadonlyRamDb* find_db = nullptr;
+        };
+        auto state      = std::make_shared<State>();
+        const auto path = state->dir / (kind == DbKinds::FindDb ? "test.fdb.txt" : "test.db.txt");
+        {
+            std::ofstream file(path);
+            auto problem = state->layer.Problem();
+            for(auto n = 1; n <= 1000; ++n)
+            {
+                // Vary the batch size to get distinct keys; the last one is looked up.
+                auto x = TensorDescriptor{miopenFloat, {n, 64, 56, 56}};
+                auto y = state->layer.conv.GetForwardOutputTensor(x, state->layer.w, miopenFloat);
+                problem = conv::ProblemDescription{
+                    x, state->layer.w, y, state->layer.conv, conv::Direction::Forward};
+                file << DbRecord{kind, problem}.GetKey()
+                     << "=ConvOclDirectFwd:1,8,8,4,1,1,1,1;ConvBinWinograd3x3U:0.0,0,x\n";
+            }
+            state->layer.x = problem.GetIn();
+            state->layer.y = problem.GetOut();
+        }
+
+        if(kind == DbKinds::FindDb)
+        {
+            state->find_db = &ReadonlyRamDb::GetCached(kind, path, true);
+            return [state] {
+                if(!state->find_db->FindRecord(state->layer.Problem()))
+                    MIOPEN_THROW("Record not found");
+            };
+        }
+
+        state->perf_db = std::make_unique<PlainTextDb>(kind, path);
+        return [state] {
+            if(!state->perf_db->FindRecord(state->layer.Problem()))
+                MIOPEN_THROW("Record not found");
+        };
+    }
+
+    /// Runs miopenConvolutionForwardImmediate with a no-op invoker registered for the solver,
+    /// which is what a warm invoker cache looks like to the API.
+    static Body ConvForwardImmediate()
+    {
+        struct State
+        {
+            Handle handle;
+            ConvLayer layer;
+            solver::Id solver_id{"ConvDirectNaiveConvFwd"};
+            float dummy = 0.f; // Never accessed: the invoker is a no-op.
+        };
+        auto state = std::make_shared<State>();
+        state->handle.RegisterInvoker([](const Handle&, const AnyInvokeParams&) {},
+                                      state->layer.Problem().MakeNetworkConfig(),
+                                      state->solver_id.ToString());
+
+        return [state] {
+            auto& s = *state;
+            Check(miopenConvolutionForwardImmediate(&s.handle,
+                                                    &s.layer.w,
+                                                    &s.dummy,
+                                                    &s.layer.x,
+                                                    &s.dummy,
+                                                    &s.layer.conv,
+                                                    &s.layer.y,
+                                                    &s.dummy,
+                                                    nullptr,
+                                                    0,
+                                                    s.solver_id.Value()),
+                  "miopenConvolutionForwardImmediate");
+        };
+    }
+
+    /// Creates and compiles a conv+bias+ReLU plan that has already been compiled once,
+    /// so the kernels come from the caches.
+    static Body FusionCompile()
+    {
+        struct State
+        {
+            Handle handle;
+            ConvLayer layer;
+            TensorDescriptor bias{miopenFloat, {1, 64, 1, 1}};
+        };
+        auto state = std::make_shared<State>();
+
+        return [state] {
+            auto& s = *state;
+            miopenFusionPlanDescriptor_t plan;
+            miopenFusionOpDescriptor_t op;
+            Check(miopenCreateFusionPlan(&plan, miopenVerticalFusion, &s.layer.x),
+                  "miopenCreateFusionPlan");
+            const auto plan_guard = std::unique_ptr<void, void (*)(void*)>{
+                plan, [](void* p) {
+                    miopenDestroyFusionPlan(static_cast<miopenFusionPlanDescriptor_t>(p));
+                }};
+            Check(miopenCreateOpConvForward(plan, &op, &s.layer.conv, &s.layer.w),
+                  "miopenCreateOpConvForward");
+            Check(miopenCreateOpBiasForward(plan, &op, &s.bias), "miopenCreateOpBiasForward");
+            Check(miopenCreateOpActivationForward(plan, &op, miopenActivationRELU),
+                  "miopenCreateOpActivationForward");
+            Check(miopenCompileFusionPlan(&s.handle, plan), "miopenCompileFusionPlan");
+        };
+    }
+
+    /// Builds and finalizes the operation graph of a single forward convolution.
+    static void GraphFinalize()
+    {
+        static Handle handle;
+        namespace gr = graphapi;
+
+        gr::AutoDeleteAllocator allocator;
+        const auto layer = ConvLayer{};
+        auto* x = allocator.allocate(gr::makeTensor<false>("x", miopenFloat, layer.x.GetLengths()));
+        auto* w = allocator.allocate(gr::makeTensor<false>("w", miopenFloat, layer.w.GetLengths()));
+        auto* y = allocator.allocate(gr::makeTensor<false>("y", miopenFloat, layer.y.GetLengths()));
+        auto* conv = allocator.allocate(gr::ConvolutionBuilder{}
+                                            .setCompType(miopenFloat)
+                                            .setMode(miopenConvolution)
+                                            .setSpatialDims(2)
+                                            .setDilations({1, 1})
+                                            .setFilterStrides({1, 1})
+                                            .setPrePaddings({1, 1})
+                                            .setPostPaddings({1, 1})
+                                            .build());
+
+        gr::OpGraphBuilder builder;
+        builder.setHandle(&handle);
+        builder.addNode(allocator.allocate(gr::OperationConvolutionForwardBuilder()
+                                               .setConvolution(conv)
+                                               .setX(x)
+                                               .setW(w)
+                                               .setY(y)
+                                               .setAlpha(1.0)
+                                               .setBeta(0.0)
+                                               .build()));
+        const auto graph = std::move(builder).build();
+        (void)graph;
+    }
+};
+
+} // namespace host_overhead
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::host_overhead::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/solvers.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/packed_values.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace perfdb_values {
+
+using Config = solver::conv::PerformanceConfigConvAsm1x1U;
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(records, "records");
+        add(iterations, "iterations");
+    }
+
+    void run()
+    {
+        auto text   = std::vector<std::string>{};
+        auto packed = std::vector<std::string>{};
+        text.reserve(records);
+        packed.reserve(records);
+
+        for(auto i = 0; i < records; i++)
+        {
+            const auto config = Config{1 + i % 4,
+                                       1 << (i % 6),
+                                       1 + i % 16,
+                                       1 << (i % 7),
+                                       1 + i % 8,
+                                       1 << (i % 6),
+                                       1 + i % 8,
+                                       1 << (i % 4),
+                                       false};
+            std::ostringstream ss;
+            config.Serialize(ss);
+            text.push_back(ss.str());
+            packed.emplace_back();
+            if(!config.SerializePacked(packed.back()))
+                MIOPEN_THROW("Unable to pack " + text.back());
+        }
+
+        const auto text_us   = Time(text);
+        const auto packed_us = Time(packed);
+
+        std::cout << std::left << std::setw(8) << "format" << std::right << std::setw(14)
+                  << "bytes/record" << std::setw(16) << "ns/record" << std::endl;
+        Report("text", text, text_us);
+        Report("packed", packed, packed_us);
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Times deserialization of perf-db VALUES stored as text and packed"
+                  << std::endl;
+    }
+
+private:
+    int records    = 100000;
+    int iterations = 10;
+
+    double Time(const std::vector<std::string>& values) const
+    {
+        auto config      = Config{};
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; i++)
+        {
+            for(const auto& s : values)
+            {
+                if(!config.Deserialize(s))
+                    MIOPEN_THROW("Unable to deserialize " + s);
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+    }
+
+    void Report(const char* name, const std::vector<std::string>& values, double us) const
+    {
+        std::size_t bytes = 0;
+        for(const auto& s : values)
+            bytes += s.size();
+        std::cout << std::left << std::setw(8) << name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14)
+                  << static_cast<double>(bytes) / values.size() << std::setw(16)
+                  << us * 1000 / values.size() << std::endl;
+    }
+};
+
+} // namespace perfdb_values
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::perfdb_values::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -27,12 +27,16 @@
 #include <miopen/miopen.h>
 
 #include <miopen/common.hpp>
+#include <miopen/conv/tuning_queue.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/invoker_snapshot.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/problem.hpp>
 #include <miopen/search_options.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/solution_archive.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/type_name.hpp>
 
@@ -269,6 +273,17 @@ miopenStatus_t miopenSetFindOptionAttachBinaries(miopenFindOptions_t options, un
     });
 }
 
+miopenStatus_t miopenSetFindOptionSelectionPolicy(miopenFindOptions_t options,
+                                                  miopenSolutionCostFunction_t cost,
+                                                  void* userData)
+{
+    MIOPEN_LOG_FUNCTION(options, userData);
+
+    return miopen::try_([&] {
+        miopen::deref(options).selection_policy = miopen::MakeSelectionPolicy(cost, userData);
+    });
+}
+
 miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
                                    miopenProblem_t problem,
                                    miopenFindOptions_t options,
@@ -276,6 +291,7 @@ miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
                                    size_t* numSolutions,
                                    size_t maxSolutions)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle, problem, options, solutions, numSolutions, maxSolutions);
 
     return miopen::try_([&] {
@@ -304,6 +320,23 @@ miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
     });
 }
 
+miopenStatus_t miopenTuneQueuedProblems(miopenHandle_t handle, size_t* numTuned)
+{
+    MIOPEN_LOG_FUNCTION(handle, numTuned);
+
+    return miopen::try_([&] {
+        auto& handle_deref = miopen::deref(handle);
+
+        const auto tuned = miopen::conv::TuningQueue::Drain(
+            miopen::conv::TuningQueue::GetDefaultPath(), [&](const miopen::Problem& problem) {
+                miopen::conv::TuningQueue::Tune(handle_deref, problem);
+            });
+
+        if(numTuned != nullptr)
+            *numTuned = tuned;
+    });
+}
+
 inline std::ostream& operator<<(std::ostream& stream, const miopenTensorArgument_t& tensor)
 {
     switch(tensor.id)
@@ -399,6 +432,7 @@ miopenStatus_t miopenRunSolution(miopenHandle_t handle,
                                  void* workspace,
                                  size_t workspaceSize)
 {
+    MIOPEN_METRICS_LATENCY();
     const auto tensors_vector = std::vector<miopenTensorArgument_t>{tensors, tensors + nInputs};
     MIOPEN_LOG_FUNCTION(handle, solution, nInputs, tensors_vector, workspace, workspaceSize);
 
@@ -436,9 +470,22 @@ miopenStatus_t miopenLoadSolution(miopenSolution_t* solution, const char* data,
         if(data == nullptr)
             MIOPEN_THROW(miopenStatusBadParm, "Data parameter should not be a nullptr.");
 
-        auto json                = nlohmann::json::from_msgpack(data, data + size);
         auto& solution_ptr_deref = miopen::deref(solution);
-        solution_ptr_deref       = new miopen::Solution{json.get<miopen::Solution>()};
+
+        if(miopen::solution_archive::IsArchive(data, size))
+        {
+            auto solutions = miopen::solution_archive::Read(data, size);
+            if(solutions.size() != 1)
+                MIOPEN_THROW(miopenStatusBadParm,
+                             "The blob holds " + std::to_string(solutions.size()) +
+                                 " solutions, use miopenLoadSolutions instead.");
+            solution_ptr_deref = new miopen::Solution{std::move(solutions.front())};
+            return;
+        }
+
+        // Blobs saved by earlier versions.
+        auto json          = nlohmann::json::from_msgpack(data, data + size);
+        solution_ptr_deref = new miopen::Solution{json.get<miopen::Solution>()};
     });
 }
 
@@ -452,6 +499,8 @@ miopenStatus_t miopenSaveSolution(miopenSolution_t solution, char* data)
 
         auto& solution_deref = miopen::deref(solution);
 
+        // Keep writing the format earlier versions read, archives are opt-in through
+        // miopenSaveSolutions.
         if(solution_deref.serialization_cache.empty())
         {
             const nlohmann::json json          = solution_deref;
@@ -486,6 +535,83 @@ miopenStatus_t miopenGetSolutionSize(miopenSolution_t solution, size_t* size)
     });
 }
 
+miopenStatus_t
+miopenSaveSolutions(const miopenSolution_t* solutions, size_t count, const char* path)
+{
+    MIOPEN_LOG_FUNCTION(solutions, count, path);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Archive path is null");
+        if(count != 0 && solutions == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Solutions parameter should not be a nullptr.");
+
+        auto items = std::vector<const miopen::Solution*>{};
+        items.reserve(count);
+        for(size_t i = 0; i < count; ++i)
+            items.push_back(&miopen::deref(solutions[i]));
+
+        miopen::solution_archive::Save(items, path);
+    });
+}
+
+miopenStatus_t miopenLoadSolutions(const char* path, miopenSolution_t* solutions, size_t* count)
+{
+    MIOPEN_LOG_FUNCTION(path, solutions, count);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Archive path is null");
+        auto& count_deref = miopen::deref(count);
+
+        if(solutions == nullptr)
+        {
+            count_deref = miopen::solution_archive::Count(path);
+            return;
+        }
+
+        auto loaded = miopen::solution_archive::Load(path);
+        if(loaded.size() > count_deref)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "The archive holds " + std::to_string(loaded.size()) +
+                             " solutions, which is more than " + std::to_string(count_deref));
+
+        for(size_t i = 0; i < loaded.size(); ++i)
+            solutions[i] = new miopen::Solution{std::move(loaded[i])};
+        count_deref = loaded.size();
+    });
+}
+
+miopenStatus_t miopenSaveInvokerSnapshot(miopenHandle_t handle, const char* path, size_t* numSaved)
+{
+    MIOPEN_LOG_FUNCTION(handle, path, numSaved);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Snapshot path is null");
+
+        const auto saved = miopen::InvokerSnapshot::Instance().Save(miopen::deref(handle), path);
+
+        if(numSaved != nullptr)
+            *numSaved = saved;
+    });
+}
+
+miopenStatus_t miopenLoadInvokerSnapshot(miopenHandle_t handle, const char* path, size_t* numLoaded)
+{
+    MIOPEN_LOG_FUNCTION(handle, path, numLoaded);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Snapshot path is null");
+
+        const auto loaded = miopen::InvokerSnapshot::Load(miopen::deref(handle), path);
+
+        if(numLoaded != nullptr)
+            *numLoaded = loaded;
+    });
+}
+
 miopenStatus_t miopenGetSolutionWorkspaceSize(miopenSolution_t solution, size_t* workspaceSize)
 {
     MIOPEN_LOG_FUNCTION(solution);
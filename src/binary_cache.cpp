@@ -27,6 +27,7 @@
 #include <miopen/binary_cache.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/md5.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/env.hpp>
 #include <miopen/stringutils.hpp>
@@ -40,6 +41,7 @@
 #include <miopen/db.hpp>
 #include <miopen/db_path.hpp>
 #include <miopen/target_properties.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/filesystem.hpp>
 #include <fstream>
 #include <iostream>
@@ -155,6 +157,9 @@ std::vector<char> LoadBinary(const TargetProperties& target,
                              const fs::path& name,
                              const std::string& args)
 {
+    MIOPEN_TRACE_SCOPE("kernel_cache", "LoadBinary", name);
+    MIOPEN_METRICS_LATENCY_OF("LoadBinary");
+
     if(miopen::IsCacheDisabled())
         return {};
 
@@ -168,11 +173,13 @@ std::vector<char> LoadBinary(const TargetProperties& target,
     if(record)
     {
         MIOPEN_LOG_I2("Successfully loaded binary for: " << filename << "; args: " << args);
+        MIOPEN_METRICS_COUNT("binary_cache.hits");
         return *record;
     }
     else
     {
         MIOPEN_LOG_I2("Unable to load binary for: " << filename << "; args: " << args);
+        MIOPEN_METRICS_COUNT("binary_cache.misses");
         return {};
     }
 }
@@ -200,6 +207,9 @@ fs::path LoadBinary(const TargetProperties& target,
                     const fs::path& name,
                     const std::string& args)
 {
+    MIOPEN_TRACE_SCOPE("kernel_cache", "LoadBinary", name);
+    MIOPEN_METRICS_LATENCY_OF("LoadBinary");
+
     if(miopen::IsCacheDisabled())
         return {};
 
@@ -207,10 +217,12 @@ fs::path LoadBinary(const TargetProperties& target,
     auto f = GetCacheFile(target.DbId(), name, args);
     if(fs::exists(f))
     {
+        MIOPEN_METRICS_COUNT("binary_cache.hits");
         return f;
     }
     else
     {
+        MIOPEN_METRICS_COUNT("binary_cache.misses");
         return {};
     }
 }
@@ -0,0 +1,211 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/buffer_pool.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BUFFER_POOL_HIGH_WATERMARK, 256)
+
+namespace miopen {
+
+namespace {
+
+constexpr std::size_t min_size_class = 512;
+constexpr std::size_t pow2_limit     = std::size_t{1} << 20;
+
+std::size_t NextPow2(std::size_t v)
+{
+    std::size_t p = 1;
+    while(p < v)
+        p <<= 1;
+    return p;
+}
+
+} // namespace
+
+BufferPool::BufferPool()
+    : BufferPool(env::value(MIOPEN_BUFFER_POOL_HIGH_WATERMARK) * std::size_t{1024 * 1024})
+{
+}
+
+BufferPool::BufferPool(std::size_t high_watermark_) : high_watermark(high_watermark_) {}
+
+BufferPool::~BufferPool()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!in_use.empty())
+        MIOPEN_LOG_W("BufferPool destroyed with " << in_use.size() << " buffers in use");
+    TrimImpl(0);
+}
+
+/// Small requests are rounded to a power of 2. Above 1 MiB every octave is
+/// split in 8 classes, which bounds the waste by 12.5%.
+std::size_t BufferPool::GetSizeClass(std::size_t sz)
+{
+    if(sz <= min_size_class)
+        return min_size_class;
+    if(sz <= pow2_limit)
+        return NextPow2(sz);
+
+    const auto step = NextPow2(sz) / 16;
+    return (sz + step - 1) / step * step;
+}
+
+void BufferPool::SetAllocator(const Allocator& allocator_)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimImpl(0);
+    allocator = allocator_;
+}
+
+Allocator::ManageDataPtr BufferPool::Acquire(std::size_t sz, const void* stream)
+{
+    if(sz == 0)
+        return {nullptr, AllocatorDeleter{&BufferPool::Release, this}};
+
+    const auto size = GetSizeClass(sz);
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    Block block{};
+    const auto found = cached.find(Key{stream, size});
+    if(found != cached.end())
+    {
+        block = found->second->block;
+        lru.erase(found->second);
+        cached.erase(found);
+        stats.bytes_cached -= size;
+        --stats.blocks_cached;
+        ++stats.hits;
+    }
+    else
+    {
+        ++stats.misses;
+        const auto alloc = allocator;
+        lock.unlock();
+
+        // The allocator reports the failure itself. Retry once with the cache
+        // emptied, the memory may be held by blocks of other streams.
+        void* ptr = nullptr;
+        try
+        {
+            ptr = alloc(size).release();
+        }
+        catch(const Exception&)
+        {
+            Trim();
+            ptr = alloc(size).release();
+        }
+
+        lock.lock();
+        block = Block{ptr, size, stream, alloc};
+    }
+
+    in_use.emplace(block.ptr, block);
+    stats.bytes_in_use += size;
+    ++stats.blocks_in_use;
+    stats.peak_bytes = std::max(stats.peak_bytes, stats.bytes_in_use + stats.bytes_cached);
+
+    return {DataCast(block.ptr), AllocatorDeleter{&BufferPool::Release, this}};
+}
+
+void BufferPool::Release(void* context, void* ptr)
+{
+    static_cast<BufferPool*>(context)->ReleaseImpl(ptr);
+}
+
+void BufferPool::ReleaseImpl(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Runs in a deleter, so it must not throw
+    const auto it = in_use.find(ptr);
+    if(it == in_use.end())
+    {
+        MIOPEN_LOG_E("Buffer " << ptr << " does not belong to the pool");
+        return;
+    }
+
+    const auto block = it->second;
+    in_use.erase(it);
+    stats.bytes_in_use -= block.size;
+    --stats.blocks_in_use;
+
+    lru.push_front(CachedBlock{block, {}});
+    lru.front().index = cached.emplace(Key{block.stream, block.size}, lru.begin());
+    stats.bytes_cached += block.size;
+    ++stats.blocks_cached;
+
+    if(stats.bytes_cached > high_watermark)
+        TrimImpl(high_watermark);
+}
+
+void BufferPool::Trim(std::size_t target)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimImpl(target);
+}
+
+void BufferPool::TrimImpl(std::size_t target)
+{
+    while(stats.bytes_cached > target && !lru.empty())
+    {
+        const auto& oldest = lru.back();
+        const auto block   = oldest.block;
+        cached.erase(oldest.index);
+        lru.pop_back();
+
+        stats.bytes_cached -= block.size;
+        --stats.blocks_cached;
+        ++stats.releases;
+
+        block.allocator.deallocator(block.allocator.context, block.ptr);
+    }
+}
+
+void BufferPool::SetHighWatermark(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    high_watermark = bytes;
+    TrimImpl(high_watermark);
+}
+
+std::size_t BufferPool::GetHighWatermark() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return high_watermark;
+}
+
+BufferPoolStats BufferPool::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+} // namespace miopen
@@ -31,7 +31,12 @@
 #include <miopen/tensor.hpp>
 #include <miopen/datatype.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CHECK_NUMERICS)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CHECK_NUMERICS_INTERVAL, 256)
 
 namespace miopen {
 
@@ -40,19 +45,6 @@ bool CheckNumericsEnabled(const int bitMask)
     return (env::value(MIOPEN_CHECK_NUMERICS) & bitMask) != 0;
 }
 
-// Must keep this structure synchronized with one in MIOpenCheckNumerics
-struct CheckNumericsResult
-{
-    float sum    = 0.0f;
-    float absSum = 0.0f;
-    float min    = 0.0f;
-    float max    = 0.0f;
-
-    int hasZero = 0;
-    int hasNan  = 0;
-    int hasInf  = 0;
-};
-
 std::string GetKernelName(miopenDataType_t data_type)
 {
     switch(data_type)
@@ -70,17 +62,17 @@ std::string GetKernelName(miopenDataType_t data_type)
     }
 }
 
-bool checkNumericsImpl(
-    const Handle& handle, int mode, const TensorDescriptor& dDesc, ConstData_t data, bool isInput)
+namespace {
+
+void LaunchCheckNumerics(const Handle& handle,
+                         const TensorDescriptor& dDesc,
+                         ConstData_t data,
+                         Data_t result,
+                         int computeStats)
 {
-    int numElements = dDesc.GetElementSize();
-    CheckNumericsResult abnormal_h;
-    auto abnormal_d =
-        handle.Create(sizeof(CheckNumericsResult)); // TODO - someday avoid slow malloc/free here
-    handle.WriteTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
+    const int numElements        = dDesc.GetElementSize();
     const size_t threadsPerBlock = 256;
     const size_t numBlocks       = handle.GetMaxComputeUnits() * 6;
-    const int computeStats       = (mode & CheckNumerics::ComputeStats);
     // TODO - some constants we should get from the device:
     std::string program_name      = "MIOpenCheckNumerics.cpp";
     std::string kernel_name       = GetKernelName(dDesc.GetType());
@@ -88,50 +80,188 @@ bool checkNumericsImpl(
     const std::vector<size_t> vgd = {numBlocks, size_t{1}, size_t{1}};
     handle.AddKernel(
         "MIOpenCheckNumerics", "MIOpenCheckNumerics", program_name, kernel_name, vld, vgd, "")(
-        data, numElements, abnormal_d.get(), computeStats);
+        data, numElements, result, computeStats);
+}
 
-    handle.ReadTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
+bool IsAbnormal(const CheckNumericsResult& result)
+{
+    return (result.hasNan != 0) || (result.hasInf != 0);
+}
 
-    bool isAbnormal = (abnormal_h.hasNan != 0) || (abnormal_h.hasInf != 0);
+void LogResult(int mode,
+               const CheckNumericsResult& result,
+               bool isInput,
+               ConstData_t data,
+               std::size_t numElements,
+               const std::string& desc)
+{
+    const bool isAbnormal = IsAbnormal(result);
+    if(((mode & CheckNumerics::Info) == 0) && !(((mode & CheckNumerics::Warn) != 0) && isAbnormal))
+        return;
 
-    if(((mode & CheckNumerics::Info) != 0) || (((mode & CheckNumerics::Warn) != 0) && isAbnormal))
+    MIOPEN_LOG((isAbnormal ? miopen::LoggingLevel::Warning : miopen::LoggingLevel::Info),
+               (isInput ? "INPUT " : "OUTPUT")
+                   << " ptr=" << data << " zeros=" << result.hasZero << " nans=" << result.hasNan
+                   << " infs=" << result.hasInf << "  {" << desc << "}");
+    if((mode & CheckNumerics::ComputeStats) != 0)
     {
+        assert(numElements != 0);
         MIOPEN_LOG((isAbnormal ? miopen::LoggingLevel::Warning : miopen::LoggingLevel::Info),
-                   (isInput ? "INPUT " : "OUTPUT")
-                       << " ptr=" << data << " zeros=" << abnormal_h.hasZero
-                       << " nans=" << abnormal_h.hasNan << " infs=" << abnormal_h.hasInf << "  {"
-                       << dDesc << "}");
-        if(computeStats != 0)
+                   "Stats: mean=" << (result.sum / numElements)
+                                  << " absmean=" << (result.absSum / numElements)
+                                  << " min=" << result.min << " max=" << result.max
+                                  << " absmax=" << result.absMax);
+    }
+}
+
+void OnAbnormal(int mode, bool isInput)
+{
+    if((mode & CheckNumerics::Throw) != 0)
+    {
+        if(isInput)
+        {
+            MIOPEN_THROW(miopenStatusInternalError,
+                         "abnormal checkNumerics result detected on INPUT");
+        }
+        else
         {
-            assert(numElements != 0);
-            MIOPEN_LOG((isAbnormal ? miopen::LoggingLevel::Warning : miopen::LoggingLevel::Info),
-                       "Stats: mean=" << (abnormal_h.sum / numElements)
-                                      << " absmean=" << (abnormal_h.absSum / numElements)
-                                      << " min=" << abnormal_h.min << " max=" << abnormal_h.max);
+            MIOPEN_THROW(miopenStatusInternalError,
+                         "abnormal checkNumerics result detected on OUTPUT");
         }
     }
+    if((mode & CheckNumerics::Abort) != 0)
+    {
+        abort();
+    }
+}
 
-    if(isAbnormal)
+std::string ToString(const TensorDescriptor& desc)
+{
+    std::ostringstream ss;
+    ss << desc;
+    return ss.str();
+}
+
+} // namespace
+
+NumericsAggregator::NumericsAggregator(std::size_t capacity_) : capacity(capacity_)
+{
+    if(capacity == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "numerics check interval must be positive");
+    pending.reserve(capacity);
+}
+
+std::size_t
+NumericsAggregator::Reserve(const TensorDescriptor& desc, ConstData_t data, bool isInput)
+{
+    if(Full())
+        MIOPEN_THROW(miopenStatusInternalError, "no free numerics check slot");
+    pending.push_back({ToString(desc), data, desc.GetElementSize(), isInput});
+    return pending.size() - 1;
+}
+
+std::size_t NumericsAggregator::Collect(int mode, const CheckNumericsResult* results)
+{
+    std::size_t abnormal = 0;
+    const Slot* first    = nullptr;
+
+    for(std::size_t i = 0; i < pending.size(); ++i)
     {
+        const auto& slot   = pending[i];
+        const auto& result = results[i];
+        LogResult(mode, result, slot.isInput, slot.data, slot.elements, slot.desc);
 
-        if((mode & CheckNumerics::Throw) != 0)
-        {
-            if(isInput)
-            {
-                MIOPEN_THROW(miopenStatusInternalError,
-                             "abnormal checkNumerics result detected on INPUT");
-            }
-            else
-            {
-                MIOPEN_THROW(miopenStatusInternalError,
-                             "abnormal checkNumerics result detected on OUTPUT");
-            }
-        }
-        if((mode & CheckNumerics::Abort) != 0)
+        ++summary.checked;
+        summary.nans += result.hasNan != 0 ? 1 : 0;
+        summary.infs += result.hasInf != 0 ? 1 : 0;
+        if(!std::isnan(result.absMax))
+            summary.absMax = std::max(summary.absMax, result.absMax);
+        if(IsAbnormal(result))
         {
-            abort();
+            ++abnormal;
+            if(first == nullptr)
+                first = &slot;
         }
     }
+    summary.abnormal += abnormal;
+
+    if(first != nullptr)
+    {
+        MIOPEN_LOG_W("Deferred numerics check: " << abnormal << " of " << pending.size()
+                                                 << " tensors are abnormal, first one {"
+                                                 << first->desc << "}");
+    }
+    const bool isInput = first != nullptr && first->isInput;
+    pending.clear();
+    if(abnormal != 0)
+        OnAbnormal(mode, isInput);
+    return abnormal;
+}
+
+bool CheckNumericsMonitor::Check(
+    const Handle& handle, int mode, const TensorDescriptor& desc, ConstData_t data, bool isInput)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(!aggregator)
+    {
+        const auto interval = env::value(MIOPEN_CHECK_NUMERICS_INTERVAL);
+        aggregator          = std::make_unique<NumericsAggregator>(interval);
+        const std::vector<CheckNumericsResult> init(interval);
+        results = handle.CreateTemporary(interval * sizeof(CheckNumericsResult));
+        handle.WriteTo(init.data(), results, interval * sizeof(CheckNumericsResult));
+    }
+
+    const auto slot   = aggregator->Reserve(desc, data, isInput);
+    const auto result = handle.CreateSubBuffer(
+        results.get(), slot * sizeof(CheckNumericsResult), sizeof(CheckNumericsResult));
+    // The absolute maximum is always gathered, the rest of the stats only on request.
+    LaunchCheckNumerics(handle, desc, data, result.get(), mode & CheckNumerics::ComputeStats);
+
+    return aggregator->Full() ? FlushUnlocked(handle, mode) : false;
+}
+
+NumericsSummary CheckNumericsMonitor::Flush(const Handle& handle, int mode)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!aggregator)
+        return {};
+    FlushUnlocked(handle, mode);
+    return aggregator->Summary();
+}
+
+bool CheckNumericsMonitor::FlushUnlocked(const Handle& handle, int mode)
+{
+    const auto count = aggregator->Pending();
+    if(count == 0)
+        return false;
+
+    // Only the slots in use are transferred, both ways.
+    std::vector<CheckNumericsResult> host(count);
+    handle.ReadTo(host.data(), results, count * sizeof(CheckNumericsResult));
+    const std::vector<CheckNumericsResult> init(count);
+    handle.WriteTo(init.data(), results, count * sizeof(CheckNumericsResult));
+
+    return aggregator->Collect(mode, host.data()) != 0;
+}
+
+bool checkNumericsImpl(
+    const Handle& handle, int mode, const TensorDescriptor& dDesc, ConstData_t data, bool isInput)
+{
+    if((mode & CheckNumerics::Deferred) != 0)
+        return handle.GetNumericsMonitor().Check(handle, mode, dDesc, data, isInput);
+
+    CheckNumericsResult abnormal_h;
+    auto abnormal_d = handle.CreateTemporary(sizeof(CheckNumericsResult));
+    handle.WriteTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
+    LaunchCheckNumerics(
+        handle, dDesc, data, abnormal_d.get(), mode & CheckNumerics::ComputeStats);
+    handle.ReadTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
+
+    const bool isAbnormal = IsAbnormal(abnormal_h);
+    LogResult(mode, abnormal_h, isInput, data, dDesc.GetElementSize(), ToString(dDesc));
+    if(isAbnormal)
+        OnAbnormal(mode, isInput);
 
     return isAbnormal;
 };
@@ -145,10 +275,22 @@ bool checkNumericsInput(const Handle& handle, const TensorDescriptor& dDesc, Con
 
 // Synchronizes to wait for kernel to finish, then checks data for output:
 // Returns: 1 if abnormal value (inf or nan) detected in specified data, 0 otherwise
+// Deferred checks are queued behind the kernel instead and do not synchronize.
 bool checkNumericsOutput(const Handle& handle, const TensorDescriptor& dDesc, ConstData_t data)
 {
-    handle.Finish();
-    return checkNumericsImpl(handle, env::value(MIOPEN_CHECK_NUMERICS), dDesc, data, false);
+    const int mode = env::value(MIOPEN_CHECK_NUMERICS);
+    if((mode & CheckNumerics::Deferred) == 0)
+        handle.Finish();
+    return checkNumericsImpl(handle, mode, dDesc, data, false);
+}
+
+// Reads back the deferred checks that are still pending on the handle.
+NumericsSummary flushNumericsChecks(const Handle& handle, bool logOnly)
+{
+    int mode = env::value(MIOPEN_CHECK_NUMERICS);
+    if(logOnly)
+        mode &= ~(CheckNumerics::Throw | CheckNumerics::Abort);
+    return handle.GetNumericsMonitor().Flush(handle, mode);
 }
 
 } // namespace miopen
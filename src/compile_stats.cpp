@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/compile_stats.hpp>
+#include <miopen/binary_cache.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DISABLE_COMPILE_STATS)
+
+namespace miopen {
+
+std::string CompileStat::CreateQuery()
+{
+    std::ostringstream ss;
+    ss << "CREATE TABLE IF NOT EXISTS `" << table_name() << "` ("
+       << "`id` INTEGER PRIMARY KEY ASC"
+       << ",`kernel_name` TEXT NOT NULL"
+       << ",`kernel_args` TEXT NOT NULL"
+       << ",`backend` TEXT NOT NULL"
+       << ",`arch` TEXT NOT NULL"
+       << ",`source_size` INT NOT NULL"
+       << ",`binary_size` INT NOT NULL"
+       << ",`duration_us` INT NOT NULL"
+       << ",`timestamp` INT NOT NULL"
+       << ");"
+       << "CREATE INDEX IF NOT EXISTS "
+       << "`idx_" << table_name() << "` "
+       << "ON " << table_name() << "(kernel_name);";
+    return ss.str();
+}
+
+fs::path GetCompileStatsPath()
+{
+    if(IsCacheDisabled())
+        return {};
+    const auto dir = GetCachePath(false);
+    if(dir.empty())
+        return {};
+    return dir / "compile_stats.db";
+}
+
+void RecordCompileStat(const CompileStat& stat)
+{
+#if MIOPEN_ENABLE_SQLITE
+    if(env::enabled(MIOPEN_DISABLE_COMPILE_STATS))
+        return;
+
+    const auto path = GetCompileStatsPath();
+    if(path.empty())
+        return;
+
+    try
+    {
+        // Builds run in parallel, the cached db instance is not thread-safe.
+        // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+        static std::mutex mutex;
+        const std::lock_guard<std::mutex> lock{mutex};
+
+        auto& db = CompileStatsDb::GetCached(path, false);
+        if(!db.dbInvalid)
+            db.StoreRecord(stat);
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to record the build of " << stat.kernel_name << ": " << ex.what());
+    }
+#else
+    std::ignore = stat;
+#endif
+}
+
+#if MIOPEN_ENABLE_SQLITE
+CompileStatsDb::CompileStatsDb(const fs::path& filename_, bool is_system_)
+    : SQLiteBase(DbKinds::KernelDb, filename_, is_system_)
+{
+    if(!is_system && DisableUserDbFileIO)
+        return;
+
+    if(dbInvalid)
+    {
+        MIOPEN_LOG_I(filename << " database invalid");
+        return;
+    }
+    if(!is_system)
+        sql.Exec(CompileStat::CreateQuery());
+    if(!CheckTableColumns(CompileStat::table_name(), CompileStat::FieldNames()))
+    {
+        MIOPEN_LOG_W("Invalid fields in table: " << CompileStat::table_name()
+                                                 << " disabling access to " << filename);
+        dbInvalid = true;
+    }
+}
+
+bool CompileStatsDb::StoreRecordUnsafe(const CompileStat& stat)
+{
+    if(filename.empty() || dbInvalid)
+        return false;
+
+    static const auto insert_query = "INSERT INTO " + CompileStat::table_name() + "(" +
+                                     JoinStrings(CompileStat::FieldNames(), ", ") +
+                                     ") VALUES(?, ?, ?, ?, ?, ?, ?, ?);";
+    const auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+
+    auto stmt = SQLite::Statement{sql, insert_query};
+    stmt.BindPath(1, stat.kernel_name);
+    stmt.BindText(2, stat.kernel_args);
+    stmt.BindText(3, stat.backend);
+    stmt.BindText(4, stat.arch);
+    stmt.BindInt64(5, static_cast<int64_t>(stat.source_size));
+    stmt.BindInt64(6, static_cast<int64_t>(stat.binary_size));
+    stmt.BindInt64(7, std::llround(stat.duration_ms * 1000.0));
+    stmt.BindInt64(8, timestamp);
+
+    if(stmt.Step(sql) != SQLITE_DONE)
+        MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+    return true;
+}
+#endif
+
+} // namespace miopen
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/applicability_filter.hpp>
+#include <miopen/conv/problem_description.hpp>
+
+namespace miopen {
+namespace conv {
+
+bool ApplicabilityFilter::Accepts(const ProblemDescription& problem) const
+{
+    if((directions & (1U << static_cast<unsigned>(problem.GetDirection()))) == 0)
+        return false;
+    if(problem.GetSpatialDims() >= 32 || (spatial_dims & (1U << problem.GetSpatialDims())) == 0)
+        return false;
+    if(!grouped && problem.GetGroupCount() > 1)
+        return false;
+    if(!mixed_types && problem.HasMixedDataTypes())
+        return false;
+
+    const auto layout = problem.IsLayoutDefault() ? LayoutDefault
+                        : problem.IsLayoutNHWC()  ? LayoutNHWC
+                                                  : LayoutOther;
+    return (layouts & layout) != 0;
+}
+
+} // namespace conv
+} // namespace miopen
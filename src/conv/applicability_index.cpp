@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/applicability_index.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_CONV_IMMED_FALLBACK_CACHE_SIZE, 1024)
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+void PrintStrides(std::ostream& os, const TensorDescriptor& desc)
+{
+    for(const auto stride : desc.GetStrides())
+        os << stride << ',';
+    os << ';';
+}
+
+} // namespace
+
+ApplicabilityIndex& ApplicabilityIndex::Instance()
+{
+    static ApplicabilityIndex index;
+    return index;
+}
+
+std::string ApplicabilityIndex::MakeKey(const ExecutionContext& ctx,
+                                        const ProblemDescription& problem)
+{
+    std::ostringstream ss;
+
+    // Problem. The network config covers shapes, layouts, types, groups, direction
+    // and the alpha/beta case; the rest is what solvers additionally look at.
+    ss << problem.MakeNetworkConfig().ToString() << '|' << problem.GetBias() << '|';
+    PrintStrides(ss, problem.GetIn());
+    PrintStrides(ss, problem.GetWeights());
+    PrintStrides(ss, problem.GetOut());
+    const auto& conv = problem.GetConv();
+    ss << conv.mode << ',' << conv.paddingMode << ','
+       << conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_FP16_ALT_IMPL) << ','
+       << conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_DETERMINISTIC) << ','
+       << conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_FP8_ROUNDING_MODE) << '|';
+
+    // Target
+    const auto& handle = ctx.GetStream();
+    ss << handle.GetDeviceName() << ',' << handle.GetDbBasename() << '|';
+
+    // Context switches
+    ss << ctx.use_asm_kernels << ctx.use_hip_kernels << ctx.use_opencl_convolutions
+       << ctx.disable_search_enforce << ctx.use_dynamic_solutions_only << ','
+       << ctx.rmv.getValue() << ',' << ctx.general_compile_options << '|';
+
+    ss << env::getUpdateCount();
+    return ss.str();
+}
+
+std::vector<ApplicableSolver> ApplicabilityIndex::Build(const ExecutionContext& ctx,
+                                                        const ProblemDescription& problem)
+{
+    std::vector<ApplicableSolver> result;
+
+    for(const auto& solver_id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+    {
+        const auto& s = solver_id.GetSolver();
+        // Let's allow non-dynamic later, if necessary.
+        if(s.IsEmpty() || !s.IsDynamic())
+            continue;
+        if(!s.GetApplicabilityFilter().Accepts(problem))
+            continue;
+        if(!s.IsApplicable(ctx, problem))
+            continue;
+        result.push_back({solver_id, s.GetWorkspaceSize(ctx, problem), s.GetWti(ctx, problem)});
+    }
+
+    return result;
+}
+
+std::size_t ApplicabilityIndex::GetCapacity() const
+{
+    return capacity ? *capacity : env::value(MIOPEN_DEBUG_CONV_IMMED_FALLBACK_CACHE_SIZE);
+}
+
+std::vector<ApplicableSolver> ApplicabilityIndex::Get(const ExecutionContext& ctx,
+                                                      const ProblemDescription& problem)
+{
+    const auto max_entries = GetCapacity();
+    if(max_entries == 0)
+        return Build(ctx, problem);
+
+    const auto key = MakeKey(ctx, problem);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = entries.find(key);
+        if(it != entries.end())
+        {
+            ++hits;
+            lru.splice(lru.begin(), lru, it->second.lru);
+            return it->second.solvers;
+        }
+        ++misses;
+    }
+
+    // Built without holding the lock; a concurrent miss on the same key does the
+    // same work and the second insertion is a no-op.
+    auto solvers = Build(ctx, problem);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(entries.find(key) == entries.end())
+    {
+        while(entries.size() >= max_entries)
+        {
+            entries.erase(lru.back());
+            lru.pop_back();
+        }
+        lru.push_front(key);
+        entries.emplace(key, Entry{solvers, lru.begin()});
+        MIOPEN_LOG_I2("Applicability index: " << solvers.size() << " solver(s) for " << key);
+    }
+    return solvers;
+}
+
+void ApplicabilityIndex::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    lru.clear();
+}
+
+ApplicabilityIndexStats ApplicabilityIndex::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return {hits, misses, entries.size()};
+}
+
+} // namespace conv
+} // namespace miopen
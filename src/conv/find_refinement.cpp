@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/find_refinement.hpp>
+
+#include <miopen/find_controls.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/search_options.hpp>
+#include <miopen/solution.hpp>
+
+#include <exception>
+#include <sstream>
+#include <utility>
+
+namespace miopen {
+namespace conv {
+
+FindRefinement::FindRefinement(Refiner refiner_)
+    : refiner(std::move(refiner_)), worker([this]() { Run(); })
+{
+}
+
+FindRefinement::~FindRefinement()
+{
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        stop            = true;
+    }
+    wakeup.notify_all();
+    worker.join();
+}
+
+FindRefinement& FindRefinement::Instance()
+{
+    static FindRefinement refinement{&FindRefinement::Find};
+    return refinement;
+}
+
+void FindRefinement::Enqueue(const ProblemDescription& problem)
+{
+    std::ostringstream key;
+    problem.Serialize(key);
+
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        if(!queued.insert(key.str()).second)
+            return;
+        queue.push_back(problem);
+    }
+    MIOPEN_LOG_I("Find refinement is queued for " << key.str());
+    wakeup.notify_one();
+}
+
+void FindRefinement::Wait()
+{
+    auto lock = std::unique_lock<std::mutex>{mutex};
+    idle.wait(lock, [&]() { return queue.empty() && !busy; });
+}
+
+void FindRefinement::Run()
+{
+    auto lock = std::unique_lock<std::mutex>{mutex};
+    while(true)
+    {
+        wakeup.wait(lock, [&]() { return stop || !queue.empty(); });
+        if(stop)
+            return;
+
+        const auto problem = std::move(queue.front());
+        queue.pop_front();
+        busy = true;
+        lock.unlock();
+
+        try
+        {
+            refiner(problem);
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Find refinement has failed: " << ex.what());
+        }
+
+        lock.lock();
+        busy = false;
+        if(queue.empty())
+            idle.notify_all();
+    }
+}
+
+Problem FindRefinement::AsFindProblem(const ProblemDescription& problem)
+{
+    auto conv = problem.GetConv();
+    conv.findMode.Set(FindMode::Values::Normal);
+
+    const auto forward = problem.GetDirection() == Direction::Forward;
+    auto find_problem  = Problem{};
+    find_problem.SetOperatorDescriptor(conv);
+    find_problem.SetDirection(static_cast<miopenProblemDirection_t>(problem.GetDirection()));
+    find_problem.RegisterTensorDescriptor(miopenTensorConvolutionX,
+                                          forward ? problem.GetIn() : problem.GetOut());
+    find_problem.RegisterTensorDescriptor(miopenTensorConvolutionW, problem.GetWeights());
+    find_problem.RegisterTensorDescriptor(miopenTensorConvolutionY,
+                                          forward ? problem.GetOut() : problem.GetIn());
+    return find_problem;
+}
+
+void FindRefinement::Find(const ProblemDescription& problem)
+{
+    if(problem.GetConv().mode == miopenTranspose)
+        return;
+
+    // A separate handle keeps the measurements off the streams of the application.
+    auto handle = Handle{};
+    std::ignore = AsFindProblem(problem).FindSolutions(handle, FindOptions{}, 1);
+}
+
+} // namespace conv
+} // namespace miopen
@@ -32,7 +32,12 @@
 #include <miopen/execution_context.hpp>
 #include <miopen/tensor_layout.hpp>
 
+#include <charconv>
+#include <cmath>
+#include <cstdint>
 #include <sstream>
+#include <string_view>
+#include <vector>
 
 namespace miopen {
 
@@ -237,6 +242,81 @@ void ProblemDescription::Serialize(std::ostream& stream) const
     }
 }
 
+namespace {
+
+std::vector<std::string_view> SplitKey(std::string_view s, char separator)
+{
+    auto tokens = std::vector<std::string_view>{};
+    for(auto pos = s.find(separator); pos != std::string_view::npos; pos = s.find(separator))
+    {
+        tokens.push_back(s.substr(0, pos));
+        s.remove_prefix(pos + 1);
+    }
+    tokens.push_back(s);
+    return tokens;
+}
+
+/// Sum of the log2 of the ratios of the differing tokens, which all have to be sizes.
+template <class IsSize>
+double KeyDistance(const std::vector<std::string_view>& a,
+                   const std::vector<std::string_view>& b,
+                   IsSize is_size)
+{
+    const auto parse = [](std::string_view s) {
+        auto value     = std::int64_t{};
+        const auto res = std::from_chars(s.data(), s.data() + s.size(), value);
+        return res.ec == std::errc{} && res.ptr == s.data() + s.size() && value > 0 ? value : 0;
+    };
+
+    if(a.size() != b.size())
+        return -1;
+
+    auto distance = 0.0;
+    for(std::size_t i = 0; i < a.size(); ++i)
+    {
+        if(a[i] == b[i])
+            continue;
+        if(!is_size(i))
+            return -1;
+
+        const auto x = parse(a[i]);
+        const auto y = parse(b[i]);
+        if(x == 0 || y == 0)
+            return -1;
+        distance += std::abs(std::log2(static_cast<double>(x) / static_cast<double>(y)));
+    }
+    return distance;
+}
+
+} // namespace
+
+double ProblemDescription::FindDbKeyDistance(std::string_view key, std::string_view other)
+{
+    // See Serialize(): C-[D-]H-W-Filter-K-[oD-]oH-oW-N-...
+    const auto a = SplitKey(key, '-');
+    const auto b = SplitKey(other, '-');
+    if(a.size() < 8)
+        return -1;
+
+    const auto filter  = a[3].find('x') == std::string_view::npos ? 4 : 3;
+    const auto spatial = filter - 1;
+    const auto batch   = filter + 2 + spatial;
+    return KeyDistance(a, b, [&](std::size_t i) {
+        return (i >= 1 && i <= spatial) || (i >= filter + 2 && i <= batch);
+    });
+}
+
+double ProblemDescription::PerfDbKeyDistance(std::string_view key, std::string_view other)
+{
+    // See Visit(): spatial_dim x in_channels x in_h x in_w x in_d x ... x batchsize x ...
+    const auto a = SplitKey(key, 'x');
+    const auto b = SplitKey(other, 'x');
+    if(a.size() < 10)
+        return -1;
+
+    return KeyDistance(a, b, [](std::size_t i) { return (i >= 2 && i <= 4) || i == 9; });
+}
+
 bool ProblemDescription::IsLayoutDefault() const
 {
     if(GetSpatialDims() == 2)
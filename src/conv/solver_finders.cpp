@@ -32,6 +32,7 @@
 #include <miopen/perf_field.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/tuning_trace.hpp>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_GEMM)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_DIRECT)
@@ -230,6 +231,7 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
     auto best         = std::numeric_limits<float>::max();
     auto best_invoker = Invoker{};
     auto ret          = std::vector<Solution>{};
+    auto measurement  = TuningMeasurement{handle, "find", network_config.ToString()};
 
     for(const auto& sol : solutions)
     {
@@ -255,14 +257,15 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
             MIOPEN_THROW("Invoker is not provided by solver " + sol.solver_id);
 
         std::vector<Program> programs;
-        const auto invoker = handle.PrepareInvoker(*sol.invoker_factory,
-                                                   sol.construction_params,
-                                                   force_attach_binary ? &programs : nullptr);
+        measurement.Select(sol.solver_id, "");
+        const auto invoker = measurement.Prepare(*sol.invoker_factory,
+                                                 sol.construction_params,
+                                                 force_attach_binary ? &programs : nullptr);
 
         try
         {
             // Run invoker max 6 times, with ~5 sec time limit.
-            using elapsed_t                 = decltype(handle.GetKernelTime());
+            using elapsed_t                 = decltype(measurement.Run(invoker, invoke_ctx));
             constexpr elapsed_t TIME_MS_MAX = 5000.0;
             constexpr int N_RUNS_MAX        = 8;
             constexpr int N_RUNS_DISCARD    = 3;
@@ -271,8 +274,7 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
             int i                           = 0;
             while(i < N_RUNS_MAX && elapsed < TIME_MS_MAX)
             {
-                invoker(handle, invoke_ctx);
-                elapsed += handle.GetKernelTime();
+                elapsed += measurement.Run(invoker, invoke_ctx);
                 if(i < N_RUNS_DISCARD)
                     first_elapsed += elapsed;
                 ++i;
@@ -306,7 +308,9 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
     if(!selected.Succeeded())
         return {};
 
-    handle.RegisterInvoker(best_invoker, network_config, selected.solver_id, algorithm_name);
+    // Replayed measurements leave nothing to run.
+    if(!measurement.IsReplay())
+        handle.RegisterInvoker(best_invoker, network_config, selected.solver_id, algorithm_name);
     MIOPEN_LOG_I("Selected: " << selected << ": " << best
                               << ", workspace_sz = " << selected.workspace_sz);
 
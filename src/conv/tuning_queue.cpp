@@ -0,0 +1,306 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/tuning_queue.hpp>
+
+#include <miopen/db_path.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/search_options.hpp>
+#include <miopen/solution.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+std::string GetKey(const ProblemDescription& problem)
+{
+    std::ostringstream key;
+    problem.Serialize(key);
+    return key.str();
+}
+
+LockFile& GetLockFile(const fs::path& file) { return LockFile::Get(LockFilePath(file)); }
+
+std::vector<nlohmann::json> ReadEntries(const fs::path& file)
+{
+    auto entries = std::vector<nlohmann::json>{};
+    auto stream  = std::ifstream{file};
+    auto line    = std::string{};
+
+    while(std::getline(stream, line))
+    {
+        if(line.empty())
+            continue;
+
+        auto entry = nlohmann::json::parse(line, nullptr, false);
+        if(entry.is_discarded() || !entry.contains("key") || !entry.contains("problem"))
+        {
+            MIOPEN_LOG_W("Ignoring a malformed line of " << file << ": " << line);
+            continue;
+        }
+        entries.emplace_back(std::move(entry));
+    }
+
+    return entries;
+}
+
+void WriteEntries(const fs::path& file, const std::vector<nlohmann::json>& entries)
+{
+    auto stream = std::ofstream{file, std::ios::trunc};
+    for(const auto& entry : entries)
+        stream << entry.dump() << '\n';
+}
+
+bool Contains(const std::vector<nlohmann::json>& entries, const std::string& key)
+{
+    return std::any_of(entries.begin(), entries.end(), [&](const auto& entry) {
+        return entry.at("key").template get<std::string>() == key;
+    });
+}
+
+bool Append(const fs::path& file, const std::string& key, const Problem& problem)
+{
+    const auto lock = std::lock_guard<LockFile>{GetLockFile(file)};
+
+    if(Contains(ReadEntries(file), key))
+        return false;
+
+    if(!file.parent_path().empty())
+        fs::create_directories(file.parent_path());
+
+    auto stream = std::ofstream{file, std::ios::app};
+    stream << nlohmann::json{{"key", key}, {"problem", problem}}.dump() << '\n';
+    return true;
+}
+
+void Remove(const fs::path& file, const std::string& key)
+{
+    const auto lock = std::lock_guard<LockFile>{GetLockFile(file)};
+
+    auto entries = ReadEntries(file);
+    entries.erase(std::remove_if(entries.begin(),
+                                 entries.end(),
+                                 [&](const auto& entry) {
+                                     return entry.at("key").template get<std::string>() == key;
+                                 }),
+                  entries.end());
+    WriteEntries(file, entries);
+}
+
+} // namespace
+
+TuningQueue::TuningQueue(fs::path file_,
+                         Tuner tuner_,
+                         std::chrono::milliseconds idle_period_,
+                         bool worker_)
+    : file(std::move(file_)),
+      tuner(std::move(tuner_)),
+      idle_period(idle_period_),
+      last_activity(std::chrono::steady_clock::now())
+{
+    if(!worker_)
+        return;
+
+    worker = std::make_unique<FindRefinement>(
+        [this](const ProblemDescription& problem) { TuneScheduled(problem); });
+
+    auto entries = std::vector<nlohmann::json>{};
+    {
+        const auto lock = std::lock_guard<LockFile>{GetLockFile(file)};
+        entries         = ReadEntries(file);
+    }
+
+    for(const auto& entry : entries)
+    {
+        try
+        {
+            worker->Enqueue(entry.at("problem").get<Problem>().AsConvolution());
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Unable to schedule a queued problem for tuning: " << ex.what());
+        }
+    }
+}
+
+TuningQueue::~TuningQueue()
+{
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        stop            = true;
+    }
+    activity.notify_all();
+    worker.reset();
+}
+
+TuningQueue& TuningQueue::Instance()
+{
+    static TuningQueue queue{
+        GetDefaultPath(),
+        [](const Problem& problem) { Tune(problem); },
+        std::chrono::milliseconds{env::value(MIOPEN_BACKGROUND_TUNING_IDLE_MS)},
+        !env::disabled(MIOPEN_BACKGROUND_TUNING_WORKER)};
+    return queue;
+}
+
+fs::path TuningQueue::GetDefaultPath()
+{
+    return GetUserDbPath() / ("tuning_queue." + GetUserDbSuffix() + ".txt");
+}
+
+void TuningQueue::Enqueue(const ProblemDescription& problem)
+{
+    if(problem.GetConv().mode == miopenTranspose)
+        return;
+
+    const auto key = GetKey(problem);
+    if(Append(file, key, FindRefinement::AsFindProblem(problem)))
+        MIOPEN_LOG_I("Queued for tuning: " << key);
+
+    if(worker)
+        worker->Enqueue(problem);
+}
+
+void TuningQueue::NotifyActivity()
+{
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    last_activity   = std::chrono::steady_clock::now();
+}
+
+void TuningQueue::Wait()
+{
+    if(worker)
+        worker->Wait();
+}
+
+std::size_t TuningQueue::Size() const
+{
+    const auto lock = std::lock_guard<LockFile>{GetLockFile(file)};
+    return ReadEntries(file).size();
+}
+
+std::size_t TuningQueue::Drain(const fs::path& file, const Tuner& tuner)
+{
+    auto tuned = std::size_t{0};
+
+    while(true)
+    {
+        auto entry = nlohmann::json{};
+        {
+            const auto lock    = std::lock_guard<LockFile>{GetLockFile(file)};
+            const auto entries = ReadEntries(file);
+            if(entries.empty())
+                break;
+            entry = entries.front();
+        }
+
+        const auto key = entry.at("key").get<std::string>();
+        MIOPEN_LOG_I("Tuning a queued problem: " << key);
+
+        try
+        {
+            tuner(entry.at("problem").get<Problem>());
+            ++tuned;
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Tuning of a queued problem has failed: " << ex.what());
+        }
+
+        // Failed problems are dropped as well, otherwise they would be retried forever.
+        Remove(file, key);
+    }
+
+    return tuned;
+}
+
+void TuningQueue::Tune(const Problem& problem)
+{
+    // A separate handle keeps the measurements off the streams of the application.
+    auto handle = Handle{};
+    Tune(handle, problem);
+}
+
+void TuningQueue::Tune(Handle& handle, const Problem& problem)
+{
+    auto options              = FindOptions{};
+    options.exhaustive_search = true;
+    std::ignore               = problem.FindSolutions(handle, options, 1);
+}
+
+bool TuningQueue::WaitForIdle()
+{
+    auto lock = std::unique_lock<std::mutex>{mutex};
+    while(!stop)
+    {
+        const auto idle_since = last_activity + idle_period;
+        if(std::chrono::steady_clock::now() >= idle_since)
+            return true;
+        activity.wait_until(lock, idle_since);
+    }
+    return false;
+}
+
+void TuningQueue::TuneScheduled(const ProblemDescription& problem)
+{
+    if(!WaitForIdle())
+        return;
+
+    const auto key = GetKey(problem);
+    {
+        // Another process may have tuned the problem in the meantime.
+        const auto lock = std::lock_guard<LockFile>{GetLockFile(file)};
+        if(!Contains(ReadEntries(file), key))
+            return;
+    }
+
+    try
+    {
+        tuner(FindRefinement::AsFindProblem(problem));
+    }
+    catch(...)
+    {
+        Remove(file, key);
+        throw;
+    }
+    Remove(file, key);
+}
+
+} // namespace conv
+} // namespace miopen
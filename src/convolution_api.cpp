@@ -32,6 +32,7 @@
 #include <miopen/find_controls.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <miopen/driver_arguments.hpp>
@@ -542,7 +543,7 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
                                       size_t workSpaceSize,
                                       bool exhaustiveSearch)
 {
-
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle,
                         xDesc,
                         x,
@@ -619,7 +620,7 @@ miopenConvolutionForward(miopenHandle_t handle,
                          void* workSpace,
                          size_t workSpaceSize)
 {
-
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle,
                         alpha,
                         xDesc,
@@ -747,6 +748,7 @@ miopenConvolutionForwardGetSolution(miopenHandle_t handle,
                                     size_t* solutionCount,
                                     miopenConvSolution_t* solutions)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle, wDesc, xDesc, convDesc, yDesc, maxSolutionCount);
     return miopen::try_([&] {
         auto ctx               = ExecutionContext{};
@@ -823,6 +825,7 @@ miopenConvolutionForwardImmediate(miopenHandle_t handle,
                                   size_t workSpaceSize,
                                   const uint64_t solution_id)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(
         handle, wDesc, w, xDesc, x, convDesc, yDesc, y, workSpace, workSpaceSize, solution_id);
     miopen::debug::LogCmdConvolution(
@@ -886,6 +889,7 @@ miopenConvolutionBackwardDataGetSolution(miopenHandle_t handle,
                                          size_t* solutionCount,
                                          miopenConvSolution_t* solutions)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle, dyDesc, wDesc, convDesc, dxDesc, maxSolutionCount);
     return miopen::try_([&] {
         auto ctx               = ExecutionContext{};
@@ -962,6 +966,7 @@ miopenConvolutionBackwardDataImmediate(miopenHandle_t handle,
                                        size_t workSpaceSize,
                                        const uint64_t solution_id)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(
         handle, dyDesc, wDesc, convDesc, dxDesc, workSpace, workSpaceSize, solution_id);
     miopen::debug::LogCmdConvolution(
@@ -1024,6 +1029,7 @@ miopenConvolutionBackwardWeightsGetSolution(miopenHandle_t handle,
                                             size_t* solutionCount,
                                             miopenConvSolution_t* solutions)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle, dyDesc, xDesc, convDesc, dwDesc, maxSolutionCount);
     return miopen::try_([&] {
         auto ctx               = ExecutionContext{};
@@ -1100,6 +1106,7 @@ miopenConvolutionBackwardWeightsImmediate(miopenHandle_t handle,
                                           size_t workSpaceSize,
                                           const uint64_t solution_id)
 {
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(
         handle, dyDesc, dy, xDesc, x, convDesc, dwDesc, dw, workSpace, workSpaceSize, solution_id);
     miopen::debug::LogCmdConvolution(
@@ -1150,7 +1157,7 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                                            size_t workSpaceSize,
                                            bool exhaustiveSearch)
 {
-
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle,
                         dyDesc,
                         dy,
@@ -1227,7 +1234,7 @@ miopenConvolutionBackwardData(miopenHandle_t handle,
                               void* workSpace,
                               size_t workSpaceSize)
 {
-
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle,
                         alpha,
                         dyDesc,
@@ -1330,7 +1337,7 @@ miopenFindConvolutionBackwardWeightsAlgorithm(miopenHandle_t handle,
                                               size_t workSpaceSize,
                                               bool exhaustiveSearch)
 {
-
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle,
                         dyDesc,
                         dy,
@@ -1382,7 +1389,7 @@ miopenConvolutionBackwardWeights(miopenHandle_t handle,
                                  void* workSpace,
                                  size_t workSpaceSize)
 {
-
+    MIOPEN_METRICS_LATENCY();
     MIOPEN_LOG_FUNCTION(handle,
                         alpha,
                         dyDesc,
@@ -1463,3 +1470,15 @@ extern "C" miopenStatus_t miopenGetConvolutionAttribute(miopenConvolutionDescrip
     return miopen::try_(
         [&] { miopen::deref(value) = miopen::deref(convDesc).attribute.Get(attr); });
 }
+
+MIOPEN_EXPORT
+extern "C" miopenStatus_t
+miopenSetConvolutionSelectionPolicy(miopenConvolutionDescriptor_t convDesc,
+                                    miopenSolutionCostFunction_t cost,
+                                    void* userData)
+{
+    MIOPEN_LOG_FUNCTION(convDesc, userData);
+    return miopen::try_([&] {
+        miopen::deref(convDesc).selection_policy = miopen::MakeSelectionPolicy(cost, userData);
+    });
+}
@@ -23,6 +23,7 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 #include <ostream>
@@ -194,6 +195,17 @@ void DbRecord::Merge(const DbRecord& that)
     if(key != that.key)
         return;
 
+    if(that.HasPackedValues())
+    {
+        for(auto& packed_pair : packed_map)
+        {
+            const auto it = map.find(packed_pair.first);
+            if(it != map.end())
+                it->second = std::move(packed_pair.second);
+        }
+    }
+    packed_map.clear();
+
     for(const auto& that_pair : that.map)
     {
         if(map.find(that_pair.first) != map.end())
@@ -201,4 +213,11 @@ void DbRecord::Merge(const DbRecord& that)
         map[that_pair.first] = that_pair.second;
     }
 }
+
+bool DbRecord::HasPackedValues() const
+{
+    return std::any_of(map.begin(), map.end(), [](const auto& pair) {
+        return solver::serialize::IsPacked(pair.second);
+    });
+}
 } // namespace miopen
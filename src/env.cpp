@@ -31,6 +31,7 @@
 #include <cstdlib>
 #endif
 
+#include <atomic>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -42,6 +43,16 @@
 
 namespace miopen::env {
 
+namespace {
+
+std::atomic<std::size_t>& UpdateCounter()
+{
+    static std::atomic<std::size_t> counter{0};
+    return counter;
+}
+
+} // namespace
+
 void setEnvironmentVariable(std::string_view name, std::string_view value)
 {
 #ifdef _WIN32
@@ -51,6 +62,7 @@ void setEnvironmentVariable(std::string_view name, std::string_view value)
     if(setenv(name.data(), value.data(), 1) != 0)
 #endif
         MIOPEN_THROW("Setting environment variable failed: " + std::string{name});
+    ++UpdateCounter();
 }
 
 void clearEnvironmentVariable(std::string_view name)
@@ -62,8 +74,11 @@ void clearEnvironmentVariable(std::string_view name)
     if(unsetenv(name.data()) != 0)
 #endif
         MIOPEN_THROW("Removing environment variable failed: " + std::string{name});
+    ++UpdateCounter();
 }
 
+std::size_t getUpdateCount() { return UpdateCounter(); }
+
 std::optional<std::string> getEnvironmentVariable(std::string_view name)
 {
 #ifdef _WIN32
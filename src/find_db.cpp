@@ -33,7 +33,11 @@
 #include <miopen_data.hpp>
 #endif
 #include <miopen/filesystem.hpp>
+
+#include <fstream>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace miopen {
@@ -252,6 +256,60 @@ bool FindDbRecord_t<TDb>::Validate(Handle& handle, const NetworkConfig& config)
     return !any || unbuilt;
 }
 
+template <class TDb>
+std::optional<std::string>
+FindDbRecord_t<TDb>::FindNearestKey(const std::string& key,
+                                    double (*distance)(std::string_view, std::string_view)) const
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::optional<std::string>> known;
+
+    const auto known_key = installed_path.string() + '\n' + path.string() + '\n' + key;
+    const auto lock      = std::lock_guard<std::mutex>{mutex};
+    if(const auto it = known.find(known_key); it != known.end())
+        return it->second;
+
+    auto nearest          = std::optional<std::string>{};
+    auto nearest_distance = 0.0;
+    const auto consider   = [&](std::string_view other) {
+        const auto d = distance(key, other);
+        if(d >= 0 && (!nearest || d < nearest_distance ||
+                      (d == nearest_distance && other < *nearest)))
+        {
+            nearest          = std::string{other};
+            nearest_distance = d;
+        }
+    };
+
+    const auto scan_file = [&](const fs::path& file) {
+        if(file.empty() || !fs::exists(file))
+            return;
+        std::ifstream stream(file);
+        std::string line;
+        while(std::getline(stream, line))
+        {
+            const auto eq = line.find('=');
+            if(eq != std::string::npos)
+                consider(std::string_view{line}.substr(0, eq));
+        }
+    };
+
+#if MIOPEN_DEBUG_FIND_DB_CACHING
+    if(!installed_path.empty())
+    {
+        const auto& installed = ReadonlyRamDb::GetCached(DbKinds::FindDb, installed_path, false);
+        for(const auto& item : installed.GetCacheMap())
+            consider(item.first);
+    }
+#else
+    scan_file(installed_path);
+#endif
+    scan_file(path);
+
+    known.emplace(known_key, nearest);
+    return nearest;
+}
+
 template <class TDb>
 void FindDbRecord_t<TDb>::CopyTo(std::vector<Solution>& to) const
 {
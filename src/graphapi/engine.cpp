@@ -26,6 +26,7 @@
 
 #include <miopen/errors.hpp>
 #include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/memory_planner.hpp>
 #include <miopen/graphapi/opgraph.hpp>
 
 namespace miopen {
@@ -34,6 +35,12 @@ namespace graphapi {
 
 GraphPatternExecutor::~GraphPatternExecutor() = default;
 
+std::vector<VirtualTensorBuffer>
+GraphPatternExecutor::getVirtualTensorBuffers(const OpGraph& graph) const
+{
+    return MemoryPlan::getVirtualTensorBuffers(graph);
+}
+
 size_t GraphExecutorFind20::getWorkspaceSize() const
 {
     return miopen::deref(mSolution).GetWorkspaceSize();
@@ -36,6 +36,21 @@ std::string ExecutionPlan::getJsonRepresentation() const
     return {};
 }
 
+void ExecutionPlan::initMemoryPlan()
+{
+    auto& engine         = mEngineCfg.getEngine();
+    const auto* executor = engine.getExecutor();
+    const auto* graph    = engine.getOpGraph();
+    if(executor != nullptr && graph != nullptr && executor->needsVirtualTensorBuffers())
+    {
+        mMemoryPlan = MemoryPlan::make(executor->getVirtualTensorBuffers(*graph));
+    }
+    else
+    {
+        mMemoryPlan = {};
+    }
+}
+
 ExecutionPlanBuilder& ExecutionPlanBuilder::setHandle(miopenHandle_t handle) &
 {
     mExecutionPlan.mHandle = checkPtr(handle);
@@ -79,6 +94,7 @@ ExecutionPlan ExecutionPlanBuilder::build() &
 {
     if(mExecutionPlan.mHandle != nullptr && mEngineCfgSet)
     {
+        mExecutionPlan.initMemoryPlan();
         return mExecutionPlan;
     }
     else
@@ -91,6 +107,7 @@ ExecutionPlan ExecutionPlanBuilder::build() &&
 {
     if(mExecutionPlan.mHandle != nullptr && mEngineCfgSet)
     {
+        mExecutionPlan.initMemoryPlan();
         return std::move(mExecutionPlan);
     }
     else
@@ -38,6 +38,7 @@
 #include <miopen/graphapi/variant_pack.hpp>
 #include <miopen/graphapi/convolution.hpp>
 #include <miopen/graphapi/conv_bias_res_add_activ_forward_executor.hpp>
+#include <miopen/graphapi/pointwise_fusion_executor.hpp>
 
 namespace miopen {
 namespace graphapi {
@@ -1013,6 +1014,42 @@ public:
     }
 };
 
+/// Catch-all for graphs made only of elementwise ops (plus reshapes of inputs
+/// and reductions into outputs), compiled into one generated kernel. Must stay
+/// after the hand-written patterns since it also matches their sub-graphs.
+class PointwiseFusion_Pattern : public GraphPatternMatcher
+{
+public:
+    static std::unique_ptr<GraphPatternMatcher> Make()
+    {
+        return std::make_unique<PointwiseFusion_Pattern>();
+    }
+
+    std::string_view name() const final
+    {
+        static const std::string_view n{"pointwise_fusion"};
+        return n;
+    }
+
+    bool matches(const OpGraph* graph_ptr) const final
+    {
+        assert(graph_ptr);
+        return PointwiseFusionExecutor::isFusible(*graph_ptr);
+    }
+
+    std::vector<Engine> getEngines(OpGraph* graph_ptr) const override
+    {
+        assert(graph_ptr);
+
+        std::shared_ptr<GraphPatternExecutor> exec = PointwiseFusionExecutor::make(*graph_ptr);
+        if(!exec)
+        {
+            return {};
+        }
+        return {EngineBuilder().setGraph(graph_ptr).setExecutor(exec).setGlobalIndex(0).build()};
+    }
+};
+
 std::vector<Engine> findEngines(OpGraph* graph)
 {
     assert(graph);
@@ -1021,6 +1058,7 @@ std::vector<Engine> findEngines(OpGraph* graph)
     patterns.emplace_back(MHA_Fwd_F8_Pattern::Make());
     patterns.emplace_back(MHA_Bwd_F8_Pattern::Make());
     patterns.emplace_back(ConvBiasResAddActive_Fwd_Pattern::Make());
+    patterns.emplace_back(PointwiseFusion_Pattern::Make());
 
     for(const auto& p : patterns)
     {
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/graphapi/memory_planner.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace miopen {
+
+namespace graphapi {
+
+namespace {
+
+size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/// Kahn's algorithm, ties broken by the order in which the nodes were added
+std::vector<const OpNode*> sortNodes(const OpGraph& graph)
+{
+    const auto& nodes = graph.getNodes();
+    const auto* src   = graph.getSourceNode();
+
+    std::unordered_map<const OpNode*, size_t> inDegree;
+    for(const auto* node : nodes)
+    {
+        auto& degree = inDegree[node];
+        for(const auto& [pred, tensor] : graph.getInEdges(node))
+        {
+            std::ignore = tensor;
+            if(pred != src)
+                ++degree;
+        }
+    }
+
+    std::deque<const OpNode*> ready;
+    for(const auto* node : nodes)
+    {
+        if(inDegree[node] == 0)
+            ready.push_back(node);
+    }
+
+    std::vector<const OpNode*> sorted;
+    sorted.reserve(nodes.size());
+    while(!ready.empty())
+    {
+        const auto* node = ready.front();
+        ready.pop_front();
+        sorted.push_back(node);
+
+        for(const auto& [succ, tensor] : graph.getOutEdges(node))
+        {
+            std::ignore = tensor;
+            auto it     = inDegree.find(succ);
+            if(it != inDegree.end() && --it->second == 0)
+                ready.push_back(succ);
+        }
+    }
+
+    MIOPEN_THROW_IF(sorted.size() != nodes.size(), "OpGraph has a cycle");
+    return sorted;
+}
+
+} // namespace
+
+std::vector<VirtualTensorBuffer> MemoryPlan::getVirtualTensorBuffers(const OpGraph& graph)
+{
+    std::vector<VirtualTensorBuffer> buffers;
+    std::unordered_map<const Tensor*, size_t> bufferOf;
+    auto bufferFor = [&](const Tensor* tensor, size_t step) -> VirtualTensorBuffer& {
+        auto [it, inserted] = bufferOf.try_emplace(tensor, buffers.size());
+        if(inserted)
+        {
+            buffers.push_back(
+                VirtualTensorBuffer{tensor->getId(), tensor->GetNumBytes(), step, step});
+        }
+        return buffers[it->second];
+    };
+
+    const auto sorted = sortNodes(graph);
+    for(size_t step = 0; step < sorted.size(); ++step)
+    {
+        for(const auto& [pred, tensor] : graph.getInEdges(sorted[step]))
+        {
+            std::ignore = pred;
+            if(tensor->isVirtual())
+            {
+                auto& buffer    = bufferFor(tensor, step);
+                buffer.lastStep = std::max(buffer.lastStep, step);
+            }
+        }
+        for(const auto& [succ, tensor] : graph.getOutEdges(sorted[step]))
+        {
+            std::ignore = succ;
+            if(tensor->isVirtual())
+            {
+                auto& buffer     = bufferFor(tensor, step);
+                buffer.firstStep = std::min(buffer.firstStep, step);
+            }
+        }
+    }
+
+    return buffers;
+}
+
+MemoryPlan MemoryPlan::make(const OpGraph& graph, size_t alignment)
+{
+    return make(getVirtualTensorBuffers(graph), alignment);
+}
+
+MemoryPlan MemoryPlan::make(const std::vector<VirtualTensorBuffer>& buffers, size_t alignment)
+{
+    MIOPEN_THROW_IF(alignment == 0 || (alignment & (alignment - 1)) != 0,
+                    "memory plan alignment must be a power of 2");
+
+    MemoryPlan plan;
+    plan.mAlignment = alignment;
+
+    plan.mBlocks.reserve(buffers.size());
+    for(const auto& buffer : buffers)
+    {
+        MIOPEN_THROW_IF(buffer.firstStep > buffer.lastStep, "buffer dies before it is created");
+        MIOPEN_THROW_IF(std::any_of(plan.mBlocks.cbegin(),
+                                    plan.mBlocks.cend(),
+                                    [&](const Block& b) { return b.tensorId == buffer.tensorId; }),
+                        "tensor planned twice");
+        plan.mBlocks.push_back(Block{buffer.tensorId,
+                                     0,
+                                     alignUp(buffer.size, alignment),
+                                     buffer.firstStep,
+                                     buffer.lastStep});
+    }
+
+    // Largest first, so that small tensors fill the gaps left between the big ones
+    std::vector<size_t> order(plan.mBlocks.size());
+    for(size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return plan.mBlocks[a].size > plan.mBlocks[b].size;
+    });
+
+    std::vector<const Block*> placed;
+    std::vector<const Block*> live;
+    for(auto i : order)
+    {
+        auto& block = plan.mBlocks[i];
+        plan.mNaiveSize += block.size;
+
+        live.clear();
+        std::copy_if(placed.cbegin(), placed.cend(), std::back_inserter(live), [&](auto* other) {
+            return other->firstStep <= block.lastStep && block.firstStep <= other->lastStep;
+        });
+        std::sort(live.begin(), live.end(), [](auto* a, auto* b) { return a->offset < b->offset; });
+
+        // First gap among the overlapping blocks that is large enough
+        size_t offset = 0;
+        for(const auto* other : live)
+        {
+            if(offset + block.size <= other->offset)
+                break;
+            offset = std::max(offset, other->offset + other->size);
+        }
+
+        block.offset = offset;
+        plan.mSize   = std::max(plan.mSize, offset + block.size);
+        placed.push_back(&block);
+    }
+
+    MIOPEN_LOG_I2("Virtual tensors: " << plan.mBlocks.size() << ", planned workspace: "
+                                      << plan.mSize << " bytes, unplanned: " << plan.mNaiveSize
+                                      << " bytes");
+    return plan;
+}
+
+size_t MemoryPlan::getOffset(int64_t tensorId) const
+{
+    auto it = std::find_if(mBlocks.cbegin(), mBlocks.cend(), [tensorId](const Block& block) {
+        return block.tensorId == tensorId;
+    });
+    MIOPEN_THROW_IF(it == mBlocks.cend(), "No such tensor id in MemoryPlan");
+    return it->offset;
+}
+
+VariantPack MemoryPlan::bind(const VariantPack& vpk, size_t baseOffset) const
+{
+    if(mBlocks.empty())
+    {
+        return vpk;
+    }
+
+    MIOPEN_THROW_IF(vpk.getWorkspace() == nullptr,
+                    "VariantPack has no workspace for the virtual tensors");
+
+    auto tensorIds    = vpk.getTensorIds();
+    auto dataPointers = vpk.getDataPtrs();
+    auto* base = static_cast<char*>(vpk.getWorkspace()) + baseOffset;
+    for(const auto& block : mBlocks)
+    {
+        // The executor relies on the planned size, so the plan owns these tensors
+        MIOPEN_THROW_IF(std::find(tensorIds.cbegin(), tensorIds.cend(), block.tensorId) !=
+                            tensorIds.cend(),
+                        "VariantPack has a pointer for virtual tensor " +
+                            std::to_string(block.tensorId) +
+                            ", whose memory is planned in the workspace");
+
+        tensorIds.push_back(block.tensorId);
+        dataPointers.push_back(base + block.offset);
+    }
+
+    return {std::move(tensorIds), std::move(dataPointers), vpk.getWorkspace()};
+}
+
+} // namespace graphapi
+
+} // namespace miopen
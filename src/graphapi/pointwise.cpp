@@ -683,34 +683,6 @@ OperationPointwiseBuilder& OperationPointwiseBuilder::setAlpha2(OperationPointwi
     return *this;
 }
 
-namespace {
-
-template <typename Range1, typename Range2, typename Range3>
-bool checkDimsWithPossibleBroadcasting(Range1 input1, Range2 input2, Range3 output)
-{
-    auto input1it   = input1.cbegin();
-    auto input1Last = input1.cend();
-    auto input2it   = input2.cbegin();
-    auto input2Last = input2.cend();
-    auto outputit   = output.cbegin();
-    auto outputLast = output.cend();
-
-    bool OK = true;
-
-    for(; OK && input1it != input1Last && input2it != input2Last && outputit != outputLast;
-        ++input1it, ++input2it, ++outputit)
-    {
-        OK = (*input1it == *input2it && *input1it == *outputit) ||
-             (*input1it == 1 && *input2it > 1 && *input2it == *outputit) ||
-             (*input2it == 1 && *input1it > 1 && *input1it == *outputit);
-    }
-    OK = OK && input1it == input1Last && input2it == input2Last && outputit == outputLast;
-
-    return OK;
-}
-
-} // namespace
-
 OperationPointwise OperationPointwiseBuilder::build()
 {
     if(mOperationPointwise.mPointwise == nullptr)
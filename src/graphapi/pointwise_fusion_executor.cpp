@@ -0,0 +1,985 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/graphapi/pointwise_fusion_executor.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/reduction.hpp>
+#include <miopen/graphapi/reshape.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/mlo_internal.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+
+namespace miopen {
+
+namespace graphapi {
+
+namespace {
+
+constexpr std::size_t localSize = 256;
+// Keep the grid bounded, the kernel uses a grid-stride loop
+constexpr std::size_t maxGlobalSize = localSize * 65536;
+// HIPOCKernelInvoke packs a std::vector<OpKernelArg> into a 256-byte buffer
+constexpr std::size_t maxArgTensors = 256 / sizeof(void*);
+
+const std::string algorithmName  = "MIOpenGraphPointwiseFusion";
+const std::string kernelName     = "MIOpenGraphPointwiseFusion";
+const std::string initKernelName = "MIOpenGraphPointwiseFusionInit";
+
+// The first kernel keeps the plain name, so single-kernel graphs read naturally
+std::string stageKernelName(size_t stage)
+{
+    return stage == 0 ? kernelName : kernelName + std::to_string(stage);
+}
+
+const char* const kernelPreamble = R"(
+#ifndef MIOPEN_DONT_USE_HIP_RUNTIME_HEADERS
+#include <hip/hip_runtime.h>
+#endif
+
+// comparison and logical modes test floats for exact equality
+#pragma clang diagnostic ignored "-Wfloat-equal"
+
+__device__ inline float bf16_to_float(unsigned short x)
+{
+    return __uint_as_float(static_cast<unsigned int>(x) << 16);
+}
+
+__device__ inline unsigned short float_to_bf16(float x)
+{
+    unsigned int u = __float_as_uint(x);
+    if((u & 0x7f800000u) != 0x7f800000u)
+        u += 0x7fffu + ((u >> 16) & 1u); // round to nearest even
+    else if((u & 0xffffu) != 0u)
+        u |= 0x10000u; // keep NaN quiet after truncation
+    return static_cast<unsigned short>(u >> 16);
+}
+
+template <typename F>
+__device__ inline void atomic_update(float* addr, F f)
+{
+    unsigned int* uaddr = reinterpret_cast<unsigned int*>(addr);
+    unsigned int old    = *uaddr;
+    unsigned int assumed;
+    do
+    {
+        assumed = old;
+        old     = atomicCAS(uaddr, assumed, __float_as_uint(f(__uint_as_float(assumed))));
+    } while(assumed != old);
+}
+)";
+
+std::string floatLiteral(float value)
+{
+    std::ostringstream ss;
+    if(std::isfinite(value))
+    {
+        ss << std::scientific << std::setprecision(std::numeric_limits<float>::max_digits10)
+           << value << 'f';
+    }
+    else
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        ss << "__uint_as_float(0x" << std::hex << bits << "u)";
+    }
+    return ss.str();
+}
+
+template <typename Variant>
+float toFloat(const Variant& v)
+{
+    return std::visit([](auto&& arg) { return static_cast<float>(arg); }, v);
+}
+
+const char* storageType(miopenDataType_t type)
+{
+    switch(type)
+    {
+    case miopenFloat: return "float";
+    case miopenHalf: return "_Float16";
+    case miopenBFloat16: return "unsigned short";
+    default: return nullptr;
+    }
+}
+
+std::string loadExpr(miopenDataType_t type, const std::string& ptr, const std::string& offset)
+{
+    const auto ref = ptr + "[" + offset + "]";
+    switch(type)
+    {
+    case miopenHalf: return "static_cast<float>(" + ref + ")";
+    case miopenBFloat16: return "bf16_to_float(" + ref + ")";
+    default: return ref;
+    }
+}
+
+std::string storeExpr(miopenDataType_t type, const std::string& value)
+{
+    switch(type)
+    {
+    case miopenHalf: return "static_cast<_Float16>(" + value + ")";
+    case miopenBFloat16: return "float_to_bf16(" + value + ")";
+    default: return value;
+    }
+}
+
+/// Emits the statements splitting a linear index into per-dimension indices.
+/// Dimensions of length 1 get no index since they never contribute to an offset.
+void emitDecomposition(std::ostream& os,
+                       const std::string& indent,
+                       const std::string& rem,
+                       const std::string& linear,
+                       const std::vector<size_t>& dims,
+                       const std::vector<std::string>& names)
+{
+    std::vector<size_t> used;
+    for(size_t d = 0; d < dims.size(); ++d)
+    {
+        if(dims[d] != 1)
+            used.push_back(d);
+    }
+
+    if(used.empty())
+        return;
+
+    if(used.size() == 1)
+    {
+        os << indent << "const size_t " << names[used.front()] << " = " << linear << ";\n";
+        return;
+    }
+
+    os << indent << "size_t " << rem << " = " << linear << ";\n";
+    for(auto it = used.crbegin(); it != used.crend(); ++it)
+    {
+        if(std::next(it) == used.crend())
+        {
+            os << indent << "const size_t " << names[*it] << " = " << rem << ";\n";
+        }
+        else
+        {
+            os << indent << "const size_t " << names[*it] << " = " << rem << " % " << dims[*it]
+               << ";\n"
+               << indent << rem << " /= " << dims[*it] << ";\n";
+        }
+    }
+}
+
+/// Builds the source of the fused kernels. Any unsupported construct makes
+/// the generator invalid instead of throwing, so it can also serve as the
+/// graph pattern matcher.
+///
+/// A reduction result is only complete once its kernel has finished, so the
+/// nodes consuming it go to the next kernel ("stage"). Virtual tensors used
+/// across stages are kept in buffers planned by the ExecutionPlan.
+class PointwiseKernelGenerator
+{
+public:
+    explicit PointwiseKernelGenerator(const OpGraph& graph) : mGraph(graph)
+    {
+        mValid = generate();
+    }
+
+    bool isValid() const noexcept { return mValid; }
+
+    std::vector<std::vector<Tensor*>> takeArgTensors()
+    {
+        std::vector<std::vector<Tensor*>> args;
+        for(auto& stage : mStages)
+            args.push_back(std::move(stage.args));
+        return args;
+    }
+    std::vector<Tensor*> takeInitArgTensors() { return std::move(mInitArgs); }
+    std::vector<VirtualTensorBuffer> takeBuffers() { return std::move(mBuffers); }
+
+    std::string takeSource() { return std::move(mSource); }
+
+    size_t getElementCount() const noexcept { return mElementCount; }
+    size_t getInitElementCount() const noexcept { return mInitElementCount; }
+
+private:
+    struct Stage
+    {
+        std::vector<Tensor*> args;
+        std::vector<bool> argIsOutput;
+        std::unordered_map<const Tensor*, std::string> values;
+        std::ostringstream body;
+    };
+
+    const OpGraph& mGraph;
+    bool mValid = false;
+
+    std::vector<size_t> mIterDims;
+    size_t mElementCount     = 0;
+    size_t mInitElementCount = 0;
+
+    std::vector<Stage> mStages;
+    size_t mStage = 0; // the one being emitted
+    std::vector<Tensor*> mInitArgs;
+    std::vector<VirtualTensorBuffer> mBuffers;
+    std::unordered_map<const Tensor*, const OpNode*> mProducers;
+    std::unordered_map<const OpNode*, size_t> mNodeStages;
+    std::ostringstream mInitBody;
+    std::string mSource;
+    int mNextValue = 0;
+
+    bool generate();
+    bool sortNodes(std::vector<const OpNode*>& sorted) const;
+    bool deriveIterationSpace(const std::vector<const OpNode*>& nodes);
+    void assignStages(const std::vector<const OpNode*>& nodes);
+    bool emitPointwise(const OperationPointwise& node);
+    bool emitReshape(const OperationReshape& node);
+    bool emitReduction(const OperationReduction& node);
+    bool emitStore(const Tensor& tensor, const std::string& value);
+    void assemble();
+
+    std::string argName(const Tensor& tensor, bool isOutput);
+    std::string value(const Tensor& tensor);
+    std::string newValue(const std::string& expr);
+    std::string offsetExpr(const Tensor& tensor) const;
+    static std::string offsetExpr(const std::vector<size_t>& dims,
+                                  const std::vector<size_t>& strides,
+                                  const std::vector<std::string>& idx);
+
+    Stage& stage() { return mStages[mStage]; }
+
+    bool isGraphInput(const Tensor& tensor) const
+    {
+        return !tensor.isVirtual() && mProducers.count(&tensor) == 0;
+    }
+
+    /// Whether the tensor goes to memory when computed
+    bool isStored(const Tensor& tensor) const
+    {
+        return !tensor.isVirtual() ||
+               std::any_of(mBuffers.cbegin(), mBuffers.cend(), [&](const auto& buffer) {
+                   return buffer.tensorId == tensor.getId();
+               });
+    }
+};
+
+bool PointwiseKernelGenerator::sortNodes(std::vector<const OpNode*>& sorted) const
+{
+    const auto& nodes = mGraph.getNodes();
+    std::unordered_map<const OpNode*, size_t> inDegrees;
+
+    for(const auto* node : nodes)
+    {
+        const auto& inEdges = mGraph.getInEdges(node);
+        inDegrees[node] = std::count_if(inEdges.cbegin(), inEdges.cend(), [&](const Edge& e) {
+            return e.first != mGraph.getSourceNode();
+        });
+    }
+
+    // Kahn's algorithm; ties are resolved by the order the user listed the nodes in,
+    // which keeps the generated source (and so its cache key) stable.
+    std::vector<const OpNode*> ready;
+    std::copy_if(nodes.cbegin(), nodes.cend(), std::back_inserter(ready), [&](const OpNode* n) {
+        return inDegrees[n] == 0;
+    });
+
+    while(!ready.empty())
+    {
+        const auto* node = ready.front();
+        ready.erase(ready.begin());
+        sorted.push_back(node);
+
+        for(const auto& [dst, tensor] : mGraph.getOutEdges(node))
+        {
+            std::ignore = tensor;
+            if(dst == mGraph.getSinkNode())
+                continue;
+            if(--inDegrees[dst] == 0)
+                ready.push_back(dst);
+        }
+    }
+
+    return sorted.size() == nodes.size();
+}
+
+bool PointwiseKernelGenerator::deriveIterationSpace(const std::vector<const OpNode*>& nodes)
+{
+    // Reshape inputs live in a different index space and reduction outputs are
+    // collapsed, everything else spans the iteration space (with broadcasting)
+    std::vector<const Tensor*> tensors;
+
+    for(const auto* node : nodes)
+    {
+        if(const auto* pw = dynamic_cast<const OperationPointwise*>(node))
+        {
+            auto ins = pw->getInTensors();
+            tensors.insert(tensors.end(), ins.cbegin(), ins.cend());
+            tensors.push_back(pw->getY());
+        }
+        else if(const auto* rs = dynamic_cast<const OperationReshape*>(node))
+        {
+            tensors.push_back(rs->getY());
+        }
+        else if(const auto* red = dynamic_cast<const OperationReduction*>(node))
+        {
+            tensors.push_back(red->getX());
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if(tensors.empty())
+        return false;
+
+    const auto rank = tensors.front()->GetLengths().size();
+    mIterDims.assign(rank, 1);
+
+    for(const auto* t : tensors)
+    {
+        const auto& lens = t->GetLengths();
+        if(lens.size() != rank || storageType(t->GetType()) == nullptr)
+            return false;
+        std::transform(
+            lens.cbegin(), lens.cend(), mIterDims.cbegin(), mIterDims.begin(), [](auto a, auto b) {
+                return std::max<size_t>(a, b);
+            });
+    }
+
+    for(const auto* t : tensors)
+    {
+        if(!checkDimsWithPossibleBroadcasting(t->GetLengths(), mIterDims, mIterDims))
+            return false;
+    }
+
+    mElementCount = std::accumulate(
+        mIterDims.cbegin(), mIterDims.cend(), size_t{1}, std::multiplies<size_t>{});
+
+    return mElementCount > 0;
+}
+
+void PointwiseKernelGenerator::assignStages(const std::vector<const OpNode*>& nodes)
+{
+    auto isReduction = [](const OpNode* node) {
+        return dynamic_cast<const OperationReduction*>(node) != nullptr;
+    };
+
+    for(const auto* node : nodes)
+    {
+        size_t nodeStage = 0;
+        for(const auto& [src, tensor] : mGraph.getInEdges(node))
+        {
+            std::ignore = tensor;
+            if(src != mGraph.getSourceNode())
+                nodeStage = std::max(nodeStage, mNodeStages.at(src) + (isReduction(src) ? 1 : 0));
+        }
+        mNodeStages.emplace(node, nodeStage);
+    }
+
+    // Step 0 of the schedule is the init kernel, step s + 1 runs stage s.
+    // Reduction results are cleared by the init kernel and accumulated in
+    // memory, other virtual tensors only need a buffer to cross stages.
+    std::unordered_map<const Tensor*, size_t> bufferOf;
+    std::vector<bool> crossesStages;
+    for(const auto* node : nodes)
+    {
+        const auto producerStage = mNodeStages.at(node);
+        for(const auto& [dst, tensor] : mGraph.getOutEdges(node))
+        {
+            if(!tensor->isVirtual())
+                continue;
+
+            auto [it, inserted] = bufferOf.try_emplace(tensor, mBuffers.size());
+            if(inserted)
+            {
+                const auto firstStep = isReduction(node) ? 0 : producerStage + 1;
+                mBuffers.push_back(VirtualTensorBuffer{
+                    tensor->getId(), tensor->GetNumBytes(), firstStep, producerStage + 1});
+                crossesStages.push_back(isReduction(node));
+            }
+
+            if(dst != mGraph.getSinkNode())
+            {
+                const auto consumerStage = mNodeStages.at(dst);
+                auto& buffer             = mBuffers[it->second];
+                buffer.lastStep          = std::max(buffer.lastStep, consumerStage + 1);
+                if(consumerStage > producerStage)
+                    crossesStages[it->second] = true;
+            }
+        }
+    }
+
+    std::vector<VirtualTensorBuffer> buffers;
+    for(size_t i = 0; i < mBuffers.size(); ++i)
+    {
+        if(crossesStages[i])
+            buffers.push_back(mBuffers[i]);
+    }
+    mBuffers = std::move(buffers);
+}
+
+std::string PointwiseKernelGenerator::argName(const Tensor& tensor, bool isOutput)
+{
+    auto& args        = stage().args;
+    auto& argIsOutput = stage().argIsOutput;
+
+    auto it = std::find(args.cbegin(), args.cend(), &tensor);
+    if(it == args.cend())
+    {
+        // the lookup only happens while generating, so const_cast is fine here
+        args.push_back(const_cast<Tensor*>(&tensor)); // NOLINT
+        argIsOutput.push_back(isOutput);
+        return "p" + std::to_string(args.size() - 1);
+    }
+    const auto index = it - args.cbegin();
+    if(isOutput)
+        argIsOutput[index] = true;
+    return "p" + std::to_string(index);
+}
+
+std::string PointwiseKernelGenerator::newValue(const std::string& expr)
+{
+    auto name = "v" + std::to_string(mNextValue++);
+    stage().body << "        const float " << name << " = " << expr << ";\n";
+    return name;
+}
+
+std::string PointwiseKernelGenerator::offsetExpr(const std::vector<size_t>& dims,
+                                                 const std::vector<size_t>& strides,
+                                                 const std::vector<std::string>& idx)
+{
+    std::string expr;
+    for(size_t d = 0; d < dims.size(); ++d)
+    {
+        // broadcast dimensions do not contribute to the offset
+        if(dims[d] == 1 || strides[d] == 0)
+            continue;
+        if(!expr.empty())
+            expr += " + ";
+        expr += idx[d] + " * " + std::to_string(strides[d]);
+    }
+    return expr.empty() ? "0" : expr;
+}
+
+std::string PointwiseKernelGenerator::offsetExpr(const Tensor& tensor) const
+{
+    std::vector<std::string> idx;
+    for(size_t d = 0; d < mIterDims.size(); ++d)
+        idx.push_back("i" + std::to_string(d));
+    return offsetExpr(tensor.GetLengths(), tensor.GetStrides(), idx);
+}
+
+std::string PointwiseKernelGenerator::value(const Tensor& tensor)
+{
+    auto& values = stage().values;
+    if(auto it = values.find(&tensor); it != values.end())
+        return it->second;
+
+    // Only graph inputs and results of earlier stages are missing here: tensors
+    // produced by this stage are visited first thanks to the topological order
+    assert(isGraphInput(tensor) || isStored(tensor));
+    const auto ptr  = argName(tensor, false);
+    const auto name = newValue(loadExpr(tensor.GetType(), ptr, offsetExpr(tensor)));
+    values.emplace(&tensor, name);
+    return name;
+}
+
+bool PointwiseKernelGenerator::emitStore(const Tensor& tensor, const std::string& val)
+{
+    // Every thread owns exactly one output element
+    if(tensor.GetLengths() != mIterDims)
+        return false;
+
+    const auto ptr = argName(tensor, true);
+    stage().body << "        " << ptr << "[" << offsetExpr(tensor)
+                 << "] = " << storeExpr(tensor.GetType(), val) << ";\n";
+    return true;
+}
+
+bool PointwiseKernelGenerator::emitPointwise(const OperationPointwise& node)
+{
+    const auto& pw = *node.getPointwise();
+
+    if(node.getX() == nullptr || node.getY() == nullptr)
+        return false; // backward activations
+
+    auto scaled = [&](const Tensor* t, const OperationPointwise::Alpha& alpha) {
+        auto v = value(*t);
+        auto a = toFloat(alpha);
+        return a == 1.0f ? v : "(" + floatLiteral(a) + " * " + v + ")";
+    };
+
+    const auto x = scaled(node.getX(), node.getAlpha1());
+    const auto b = node.getB() != nullptr ? scaled(node.getB(), node.getAlpha2()) : std::string{};
+    const auto t = node.getT() != nullptr ? value(*node.getT()) : std::string{};
+
+    std::string expr;
+
+    switch(pw.getMode())
+    {
+    case MIOPEN_POINTWISE_ADD: expr = x + " + " + b; break;
+    case MIOPEN_POINTWISE_ADD_SQUARE: expr = x + " + " + b + " * " + b; break;
+    case MIOPEN_POINTWISE_DIV: expr = x + " / " + b; break;
+    case MIOPEN_POINTWISE_MAX: expr = "fmaxf(" + x + ", " + b + ")"; break;
+    case MIOPEN_POINTWISE_MIN: expr = "fminf(" + x + ", " + b + ")"; break;
+    case MIOPEN_POINTWISE_MOD: expr = "fmodf(" + x + ", " + b + ")"; break;
+    case MIOPEN_POINTWISE_MUL: expr = x + " * " + b; break;
+    case MIOPEN_POINTWISE_POW: expr = "powf(" + x + ", " + b + ")"; break;
+    case MIOPEN_POINTWISE_SUB: expr = x + " - " + b; break;
+    case MIOPEN_POINTWISE_ABS: expr = "fabsf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_CEIL: expr = "ceilf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_COS: expr = "cosf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_EXP: expr = "expf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_FLOOR: expr = "floorf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_LOG: expr = "logf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_NEG: expr = "-" + x; break;
+    case MIOPEN_POINTWISE_RSQRT: expr = "rsqrtf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_SIN: expr = "sinf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_SQRT: expr = "sqrtf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_TAN: expr = "tanf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_IDENTITY: expr = x; break;
+    case MIOPEN_POINTWISE_RECIPROCAL: expr = "1.0f / " + x; break;
+    case MIOPEN_POINTWISE_RELU_FWD: {
+        const auto lower = floatLiteral(toFloat(pw.getReluLowerClip()));
+        const auto upper = floatLiteral(toFloat(pw.getReluUpperClip()));
+        const auto slope = floatLiteral(toFloat(pw.getReluLowerClipSlope()));
+        expr = "(" + x + " > " + lower + " ? fminf(" + x + ", " + upper + ") : " + lower + " + " +
+               slope + " * (" + x + " - " + lower + "))";
+        break;
+    }
+    case MIOPEN_POINTWISE_TANH_FWD: expr = "tanhf(" + x + ")"; break;
+    case MIOPEN_POINTWISE_SIGMOID_FWD: expr = "1.0f / (1.0f + expf(-" + x + "))"; break;
+    case MIOPEN_POINTWISE_ELU_FWD: {
+        const auto alpha = floatLiteral(toFloat(pw.getEluAlpha()));
+        expr = "(" + x + " > 0.0f ? " + x + " : " + alpha + " * expm1f(" + x + "))";
+        break;
+    }
+    case MIOPEN_POINTWISE_GELU_FWD:
+        expr = "0.5f * " + x + " * (1.0f + erff(" + x + " * 0.70710678118654752f))";
+        break;
+    case MIOPEN_POINTWISE_SOFTPLUS_FWD: {
+        const auto beta = floatLiteral(toFloat(pw.getSoftPlusBeta()));
+        expr = "log1pf(expf(" + beta + " * " + x + ")) / " + beta;
+        break;
+    }
+    case MIOPEN_POINTWISE_SWISH_FWD: {
+        const auto beta = floatLiteral(toFloat(pw.getSwishBeta()));
+        expr = x + " / (1.0f + expf(-" + beta + " * " + x + "))";
+        break;
+    }
+    case MIOPEN_POINTWISE_GELU_APPROX_TANH_FWD:
+        expr = "0.5f * " + x + " * (1.0f + tanhf(0.79788456080286536f * (" + x + " + 0.044715f * " +
+               x + " * " + x + " * " + x + ")))";
+        break;
+    case MIOPEN_POINTWISE_CMP_EQ: expr = "(" + x + " == " + b + " ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_CMP_NEQ: expr = "(" + x + " != " + b + " ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_CMP_GT: expr = "(" + x + " > " + b + " ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_CMP_GE: expr = "(" + x + " >= " + b + " ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_CMP_LT: expr = "(" + x + " < " + b + " ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_CMP_LE: expr = "(" + x + " <= " + b + " ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_LOGICAL_AND:
+        expr = "(" + x + " != 0.0f && " + b + " != 0.0f ? 1.0f : 0.0f)";
+        break;
+    case MIOPEN_POINTWISE_LOGICAL_OR:
+        expr = "(" + x + " != 0.0f || " + b + " != 0.0f ? 1.0f : 0.0f)";
+        break;
+    case MIOPEN_POINTWISE_LOGICAL_NOT: expr = "(" + x + " == 0.0f ? 1.0f : 0.0f)"; break;
+    case MIOPEN_POINTWISE_BINARY_SELECT:
+        expr = "(" + t + " != 0.0f ? " + x + " : " + b + ")";
+        break;
+    default: return false;
+    }
+
+    const auto* y = node.getY();
+    const auto v  = newValue(expr);
+    stage().values.emplace(y, v);
+
+    return !isStored(*y) || emitStore(*y, v);
+}
+
+bool PointwiseKernelGenerator::emitReshape(const OperationReshape& node)
+{
+    const auto& x = *node.getX();
+    const auto& y = *node.getY();
+
+    // A reshape changes which element a thread owns, so it can only be folded
+    // into the load of a tensor that comes from memory
+    if(!isGraphInput(x) || x.GetLengths().size() != mIterDims.size())
+        return false;
+
+    std::vector<std::string> yIdx;
+    for(size_t d = 0; d < mIterDims.size(); ++d)
+        yIdx.push_back(y.GetLengths()[d] == 1 ? "0" : "i" + std::to_string(d));
+
+    const auto ptr = argName(x, false);
+    std::string offset;
+
+    if(node.getOpKind() == OperationReshape::OpKind::TRANSPOSE)
+    {
+        std::swap(yIdx[yIdx.size() - 1], yIdx[yIdx.size() - 2]);
+        offset = offsetExpr(x.GetLengths(), x.GetStrides(), yIdx);
+    }
+    else
+    {
+        // Generic reshapes preserve the linear element order of packed tensors
+        if(!x.IsPacked() || !y.IsPacked() || x.GetElementSize() != y.GetElementSize())
+            return false;
+
+        std::string linear = "0";
+        for(size_t d = 0; d < yIdx.size(); ++d)
+            linear = "(" + linear + ") * " + std::to_string(y.GetLengths()[d]) + " + " + yIdx[d];
+
+        const auto lin    = "l" + std::to_string(mNextValue);
+        const auto& xDims = x.GetLengths();
+        std::vector<std::string> xIdx(xDims.size());
+        for(size_t d = 0; d < xDims.size(); ++d)
+            xIdx[d] = lin + "_" + std::to_string(d);
+
+        emitDecomposition(stage().body, "        ", lin, linear, xDims, xIdx);
+        offset = offsetExpr(xDims, x.GetStrides(), xIdx);
+    }
+
+    const auto v = newValue(loadExpr(x.GetType(), ptr, offset));
+    stage().values.emplace(&y, v);
+
+    return !isStored(y) || emitStore(y, v);
+}
+
+bool PointwiseKernelGenerator::emitReduction(const OperationReduction& node)
+{
+    const auto& x = *node.getX();
+    const auto& y = *node.getY();
+
+    // Results are accumulated with atomics straight into the output buffer,
+    // or into a planned one if y is virtual
+    if(y.GetType() != miopenFloat || x.GetLengths() != mIterDims ||
+       y.GetLengths().size() != mIterDims.size())
+        return false;
+
+    const auto& yDims = y.GetLengths();
+    for(size_t d = 0; d < yDims.size(); ++d)
+    {
+        if(yDims[d] != 1 && yDims[d] != mIterDims[d])
+            return false;
+    }
+
+    const auto ySize = y.GetElementSize();
+    const auto reducedCount = mElementCount / ySize;
+
+    const auto v   = value(x);
+    const auto ptr = argName(y, true);
+    const auto dst = "&" + ptr + "[" + offsetExpr(y) + "]";
+
+    auto update = [&](const std::string& fn) {
+        return "atomic_update(" + dst + ", [=](float acc) { return " + fn + "; })";
+    };
+
+    std::string stmt;
+    std::string identity;
+
+    switch(node.getReduction()->getReductionOperator())
+    {
+    case MIOPEN_REDUCE_TENSOR_ADD:
+        stmt     = "atomicAdd(" + dst + ", " + v + ")";
+        identity = "0.0f";
+        break;
+    case MIOPEN_REDUCE_TENSOR_AVG:
+        stmt     = "atomicAdd(" + dst + ", " + v + " / " + std::to_string(reducedCount) + ".0f)";
+        identity = "0.0f";
+        break;
+    case MIOPEN_REDUCE_TENSOR_NORM1:
+        stmt     = "atomicAdd(" + dst + ", fabsf(" + v + "))";
+        identity = "0.0f";
+        break;
+    case MIOPEN_REDUCE_TENSOR_MUL:
+        stmt     = update("acc * " + v);
+        identity = "1.0f";
+        break;
+    case MIOPEN_REDUCE_TENSOR_MIN:
+        stmt     = update("fminf(acc, " + v + ")");
+        identity = floatLiteral(std::numeric_limits<float>::infinity());
+        break;
+    case MIOPEN_REDUCE_TENSOR_MAX:
+        stmt     = update("fmaxf(acc, " + v + ")");
+        identity = floatLiteral(-std::numeric_limits<float>::infinity());
+        break;
+    case MIOPEN_REDUCE_TENSOR_AMAX:
+        stmt     = update("fmaxf(acc, fabsf(" + v + "))");
+        identity = "0.0f";
+        break;
+    default: return false; // NORM2 needs a finalization pass
+    }
+
+    stage().body << "        " << stmt << ";\n";
+
+    // The init kernel walks the output in its own (packed) index space and
+    // only takes the reduction outputs as arguments
+    mInitArgs.push_back(const_cast<Tensor*>(&y)); // NOLINT
+    const auto initPtr = "p" + std::to_string(mInitArgs.size() - 1);
+
+    std::vector<std::string> idx(yDims.size());
+    for(size_t d = 0; d < yDims.size(); ++d)
+        idx[d] = "r" + std::to_string(d);
+
+    mInitBody << "    if(idx < " << ySize << ")\n    {\n";
+    emitDecomposition(mInitBody, "        ", "rem", "idx", yDims, idx);
+    mInitBody << "        " << initPtr << "[" << offsetExpr(yDims, y.GetStrides(), idx)
+              << "] = " << identity << ";\n    }\n";
+
+    mInitElementCount = std::max(mInitElementCount, ySize);
+    return true;
+}
+
+void PointwiseKernelGenerator::assemble()
+{
+    std::ostringstream src;
+    src << kernelPreamble;
+
+    if(!mInitArgs.empty())
+    {
+        std::ostringstream initParams;
+        for(size_t i = 0; i < mInitArgs.size(); ++i)
+            initParams << (i != 0 ? ",\n    " : "") << "float* __restrict__ p" << i;
+
+        src << "\nextern \"C\" __global__ void " << initKernelName << "(\n    "
+            << initParams.str() << ")\n{\n"
+            << "    const size_t idx = blockIdx.x * static_cast<size_t>(blockDim.x) + "
+               "threadIdx.x;\n"
+            << mInitBody.str() << "}\n";
+    }
+
+    std::vector<std::string> idx(mIterDims.size());
+    for(size_t d = 0; d < mIterDims.size(); ++d)
+        idx[d] = "i" + std::to_string(d);
+
+    for(size_t s = 0; s < mStages.size(); ++s)
+    {
+        const auto& stg = mStages[s];
+
+        std::ostringstream params;
+        for(size_t i = 0; i < stg.args.size(); ++i)
+        {
+            if(i != 0)
+                params << ",\n    ";
+            params << (stg.argIsOutput[i] ? "" : "const ") << storageType(stg.args[i]->GetType())
+                   << "* __restrict__ p" << i;
+        }
+
+        src << "\nextern \"C\" __global__ void " << stageKernelName(s) << "(\n    "
+            << params.str() << ")\n{\n"
+            << "    const size_t stride = gridDim.x * static_cast<size_t>(blockDim.x);\n"
+            << "    for(size_t idx = blockIdx.x * static_cast<size_t>(blockDim.x) + threadIdx.x; "
+               "idx < "
+            << mElementCount << "; idx += stride)\n    {\n";
+
+        emitDecomposition(src, "        ", "rem", "idx", mIterDims, idx);
+
+        src << stg.body.str() << "    }\n}\n";
+    }
+
+    mSource = src.str();
+}
+
+bool PointwiseKernelGenerator::generate()
+{
+    std::vector<const OpNode*> nodes;
+
+    if(!sortNodes(nodes) || !deriveIterationSpace(nodes))
+        return false;
+
+    for(const auto* node : nodes)
+    {
+        for(const auto& [dst, tensor] : mGraph.getOutEdges(node))
+        {
+            std::ignore = dst;
+            mProducers.emplace(tensor, node);
+        }
+    }
+
+    assignStages(nodes);
+
+    // Stable, so that every stage keeps the topological order
+    std::stable_sort(nodes.begin(), nodes.end(), [&](const OpNode* a, const OpNode* b) {
+        return mNodeStages.at(a) < mNodeStages.at(b);
+    });
+    mStages.resize(mNodeStages.at(nodes.back()) + 1);
+
+    for(const auto* node : nodes)
+    {
+        mStage  = mNodeStages.at(node);
+        bool ok = false;
+        if(const auto* pw = dynamic_cast<const OperationPointwise*>(node))
+            ok = emitPointwise(*pw);
+        else if(const auto* rs = dynamic_cast<const OperationReshape*>(node))
+            ok = emitReshape(*rs);
+        else if(const auto* red = dynamic_cast<const OperationReduction*>(node))
+            ok = emitReduction(*red);
+
+        if(!ok)
+            return false;
+    }
+
+    for(const auto& stg : mStages)
+    {
+        if(stg.args.empty() || stg.args.size() > maxArgTensors ||
+           std::none_of(stg.argIsOutput.cbegin(), stg.argIsOutput.cend(), [](bool b) {
+               return b;
+           }))
+        {
+            return false;
+        }
+    }
+
+    assemble();
+    return true;
+}
+
+} // namespace
+
+PointwiseFusionExecutor::PointwiseFusionExecutor(std::vector<std::vector<Tensor*>>&& argTensors,
+                                                 std::vector<Tensor*>&& initArgTensors,
+                                                 std::vector<VirtualTensorBuffer>&& buffers,
+                                                 std::string&& kernelSrc,
+                                                 size_t elementCount,
+                                                 size_t initElementCount)
+    : GraphPatternExecutor(),
+      mArgTensors(std::move(argTensors)),
+      mInitArgTensors(std::move(initArgTensors)),
+      mBuffers(std::move(buffers)),
+      mKernelSrc(std::move(kernelSrc)),
+      mElementCount(elementCount),
+      mInitElementCount(initElementCount)
+{
+    // The source fully describes the kernel, so its hash is a good cache key
+    const auto hash = md5(mKernelSrc);
+    mProgramName    = "MIOpenGraphPointwiseFusion_" + hash + ".cpp";
+    mNetworkConfig  = hash;
+}
+
+bool PointwiseFusionExecutor::isFusible(const OpGraph& graph)
+{
+    return PointwiseKernelGenerator{graph}.isValid();
+}
+
+std::unique_ptr<GraphPatternExecutor> PointwiseFusionExecutor::make(const OpGraph& graph)
+{
+    PointwiseKernelGenerator generator{graph};
+    if(!generator.isValid())
+        return nullptr;
+
+    auto argTensors = generator.takeArgTensors();
+    MIOPEN_LOG_I2("Fusing " << graph.numNodes() << " graph nodes into " << argTensors.size()
+                            << " pointwise kernel(s)");
+
+    return std::make_unique<PointwiseFusionExecutor>(std::move(argTensors),
+                                                     generator.takeInitArgTensors(),
+                                                     generator.takeBuffers(),
+                                                     generator.takeSource(),
+                                                     generator.getElementCount(),
+                                                     generator.getInitElementCount());
+}
+
+void PointwiseFusionExecutor::execute(miopenHandle_t handle, const VariantPack& vpk)
+{
+    auto& h = miopen::deref(handle);
+
+    auto makeArgs = [&](const std::vector<Tensor*>& tensors) {
+        std::vector<OpKernelArg> args;
+        args.reserve(tensors.size());
+        for(const auto* tensor : tensors)
+        {
+            args.emplace_back(vpk.getDataPointer(tensor->getId()));
+        }
+        return args;
+    };
+
+    // The stages are cached at their own index, the init kernel after them
+    const auto numStages  = mArgTensors.size();
+    const auto numKernels = numStages + (hasReductions() ? 1 : 0);
+
+    std::vector<KernelInvoke> kernels;
+    {
+        auto&& cached = h.GetKernels(algorithmName, mNetworkConfig);
+        kernels.assign(cached.begin(), cached.end());
+    }
+
+    if(kernels.size() != numKernels)
+    {
+        kernels.clear();
+
+        const std::vector<size_t> vld{localSize, 1, 1};
+        const std::vector<size_t> vgd{
+            std::min(AlignUp(mElementCount, localSize), maxGlobalSize), 1, 1};
+        for(size_t stage = 0; stage < numStages; ++stage)
+        {
+            kernels.push_back(h.AddKernel(algorithmName,
+                                          mNetworkConfig,
+                                          mProgramName,
+                                          stageKernelName(stage),
+                                          vld,
+                                          vgd,
+                                          "",
+                                          stage,
+                                          mKernelSrc));
+        }
+
+        if(hasReductions())
+        {
+            const std::vector<size_t> initVgd{AlignUp(mInitElementCount, localSize), 1, 1};
+            kernels.push_back(h.AddKernel(algorithmName,
+                                          mNetworkConfig,
+                                          mProgramName,
+                                          initKernelName,
+                                          vld,
+                                          initVgd,
+                                          "",
+                                          numStages,
+                                          mKernelSrc));
+        }
+    }
+
+    if(hasReductions())
+    {
+        auto initArgs = makeArgs(mInitArgTensors);
+        kernels[numStages](initArgs);
+    }
+
+    for(size_t stage = 0; stage < numStages; ++stage)
+    {
+        auto args = makeArgs(mArgTensors[stage]);
+        kernels[stage](args);
+    }
+}
+
+} // namespace graphapi
+
+} // namespace miopen
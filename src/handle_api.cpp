@@ -25,6 +25,7 @@
  *******************************************************************************/
 #include <cstdio>
 #include <miopen/version.h>
+#include <miopen/check_numerics.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 
@@ -120,3 +121,36 @@ extern "C" miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enab
 {
     return miopen::try_([&] { miopen::deref(handle).EnableProfiling(enable); });
 }
+
+extern "C" miopenStatus_t miopenFlushNumericsChecks(miopenHandle_t handle,
+                                                    size_t* checked,
+                                                    size_t* abnormal,
+                                                    float* absMax)
+{
+    return miopen::try_([&] {
+        const auto summary = miopen::flushNumericsChecks(miopen::deref(handle));
+        if(checked != nullptr)
+            *checked = summary.checked;
+        if(abnormal != nullptr)
+            *abnormal = summary.abnormal;
+        if(absMax != nullptr)
+            *absMax = summary.absMax;
+    });
+}
+
+extern "C" miopenStatus_t miopenGetBufferPoolStats(miopenHandle_t handle,
+                                                   miopenBufferPoolStats_t* stats)
+{
+    return miopen::try_([&] {
+        const auto pool   = miopen::deref(handle).GetBufferPool().GetStats();
+        auto& out         = miopen::deref(stats);
+        out.hits          = pool.hits;
+        out.misses        = pool.misses;
+        out.releases      = pool.releases;
+        out.bytesInUse    = pool.bytes_in_use;
+        out.bytesCached   = pool.bytes_cached;
+        out.peakBytes     = pool.peak_bytes;
+        out.buffersInUse  = pool.blocks_in_use;
+        out.buffersCached = pool.blocks_cached;
+    });
+}
@@ -34,9 +34,11 @@
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/timer.hpp>
+#include <miopen/trace.hpp>
 
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
 #include <miopen/write_file.hpp>
@@ -66,6 +68,7 @@
 #define WORKAROUND_FAULTY_HIPMEMGETINFO_VEGA_NAVI2X (HIP_PACKAGE_VERSION_FLAT >= 5007000000ULL)
 
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEVICE_CU)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_LAZY_MODULE_LOADING)
 
 namespace miopen {
 
@@ -286,8 +289,10 @@ struct HandleImpl
     float profiling_result = 0.0;
     int device             = -1;
     Allocator allocator{};
+    BufferPool buffer_pool;
     KernelCache cache;
     TargetProperties target_properties;
+    CheckNumericsMonitor numerics_monitor;
 };
 
 Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleImpl>())
@@ -343,7 +348,21 @@ Handle::Handle() : impl(std::make_unique<HandleImpl>())
     MIOPEN_LOG_NQI(*this);
 }
 
-Handle::~Handle() {}
+Handle::~Handle()
+{
+    if(!impl)
+        return;
+    // Report the deferred numerics checks of a batch that was not filled up.
+    // A destructor must not throw or abort, so the results are only logged.
+    try
+    {
+        flushNumericsChecks(*this, true);
+    }
+    catch(...)
+    {
+        MIOPEN_LOG_W("Unable to report the deferred numerics checks");
+    }
+}
 
 // not MT safe
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
@@ -411,6 +430,7 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
     this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
 
     this->impl->allocator.context = allocatorContext;
+    this->impl->buffer_pool.SetAllocator(this->impl->allocator);
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -424,6 +444,18 @@ Allocator::ManageDataPtr Handle::Create(std::size_t sz) const
     return this->impl->allocator(sz);
 }
 
+Allocator::ManageDataPtr Handle::CreateTemporary(std::size_t sz) const
+{
+    return this->impl->buffer_pool.Acquire(sz, this->GetStream());
+}
+
+BufferPool& Handle::GetBufferPool() const { return this->impl->buffer_pool; }
+
+CheckNumericsMonitor& Handle::GetNumericsMonitor() const
+{
+    return this->impl->numerics_monitor;
+}
+
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const
 {
@@ -510,7 +542,17 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
                                                         program_out);
         built.push_back(kernel);
     }
-    return factory(built);
+
+    auto invoker = factory(built);
+    if(!trace::IsEnabled() || kernels.empty())
+        return invoker;
+
+    // Tracing wraps the invoker when it is prepared, so untraced invokers pay nothing.
+    return [invoker = std::move(invoker), kernel = kernels.front().kernel_name](
+               const Handle& handle, const AnyInvokeParams& params) {
+        MIOPEN_TRACE_SCOPE("invoker", "Invoke", kernel);
+        invoker(handle, params);
+    };
 }
 
 void Handle::ClearKernels(const std::string& algorithm, const std::string& network_config) const
@@ -581,8 +623,11 @@ Program Handle::LoadProgram(const fs::path& program_name,
     if(hsaco.empty())
     {
         CompileTimer ct;
-        auto p =
-            HIPOCProgram{program_name.string(), params, this->GetTargetProperties(), kernel_src};
+        auto p = [&]() {
+            MIOPEN_METRICS_LATENCY_OF("Compile");
+            return HIPOCProgram{
+                program_name.string(), params, this->GetTargetProperties(), kernel_src};
+        }();
         ct.Log("Kernel", program_name.string());
 
         // Save to cache
@@ -639,9 +684,11 @@ Program Handle::LoadProgram(const fs::path& program_name,
     }
     else
     {
-        auto p = HIPOCProgram{program_name, hsaco};
+        // Lazy programs keep the code object and defer the module load until the first launch.
+        auto p = env::enabled(MIOPEN_LAZY_MODULE_LOADING) ? HIPOCProgram::Lazy(program_name, hsaco)
+                                                          : HIPOCProgram{program_name, hsaco};
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
-        if(force_attach_binary)
+        if(force_attach_binary && !p.IsCodeObjectInMemory())
         {
             MIOPEN_LOG_I2("Attaching a binary to the program for future serialization");
             p.AttachBinary(std::vector<char>{hsaco.data(), hsaco.data() + hsaco.size()});
@@ -227,6 +227,12 @@ HIPOCKernelInvoke HIPOCKernel::Invoke(hipStream_t stream,
                                       std::function<void(hipEvent_t, hipEvent_t)> callback,
                                       bool coop_launch) const
 {
-    return HIPOCKernelInvoke{stream, fun, ldims, gdims, name, callback, coop_launch};
+    if(!program.IsLazy())
+        return HIPOCKernelInvoke{stream, fun, ldims, gdims, name, callback, coop_launch};
+
+    // Pinned before the lookup, so the module can not be evicted between the two.
+    auto pin     = program.PinModule();
+    const auto f = program.GetFunction(kernel_module);
+    return HIPOCKernelInvoke{stream, f, ldims, gdims, name, callback, coop_launch, std::move(pin)};
 }
 } // namespace miopen
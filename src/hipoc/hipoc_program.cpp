@@ -24,6 +24,7 @@
  *
  *******************************************************************************/
 #include <miopen/config.h>
+#include <miopen/compile_stats.hpp>
 
 #include <miopen/errors.hpp>
 #include <miopen/gcn_asm_utils.hpp>
@@ -33,9 +34,11 @@
 #include <miopen/kernel_warnings.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/mlir_build.hpp>
+#include <miopen/module_lru.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/temp_file.hpp>
+#include <miopen/timer.hpp>
 #include <miopen/write_file.hpp>
 #include <miopen/env.hpp>
 #include <miopen/comgr.hpp>
@@ -154,7 +157,7 @@ static hipModulePtr CreateModule(const fs::path& hsaco_file)
     return m;
 }
 
-template <typename T> /// intended for std::string and std::vector<char>
+template <typename T> /// intended for std::string(_view) and std::vector<char>
 hipModulePtr CreateModuleInMem(const T& blob)
 {
     hipModule_t raw_m;
@@ -190,6 +193,17 @@ HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
     module = CreateModuleInMem(blob);
 }
 
+HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
+                                   const void* image,
+                                   std::size_t size)
+    : program(program_name)
+{
+    const auto& arch = env::value(MIOPEN_DEVICE_ARCH);
+    if(!arch.empty())
+        return;
+    module = CreateModuleInMem(std::string_view{static_cast<const char*>(image), size});
+}
+
 HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
                                    std::string params,
                                    const TargetProperties& target_,
@@ -211,6 +225,76 @@ HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
     }
 }
 
+HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
+                                   const fs::path& filespec,
+                                   bool lazy_)
+    : program(program_name), hsaco_file(filespec), lazy(lazy_)
+{
+    if(!lazy)
+        module = CreateModule(hsaco_file);
+}
+
+HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
+                                   std::vector<char> blob,
+                                   bool lazy_)
+    : program(program_name), binary(std::move(blob)), lazy(lazy_)
+{
+    if(!lazy)
+        module = CreateModuleInMem(binary);
+}
+
+HIPOCProgramImpl::~HIPOCProgramImpl()
+{
+    if(lazy)
+        ModuleLru::Instance().Forget(this);
+}
+
+bool HIPOCProgramImpl::LoadModule()
+{
+    std::lock_guard<std::mutex> lock(module_mutex);
+    if(module)
+        return false;
+    MIOPEN_LOG_I2("Loading module: " << program);
+    module = binary.empty() ? CreateModule(hsaco_file) : CreateModuleInMem(binary);
+    return true;
+}
+
+void HIPOCProgramImpl::UnloadModule()
+{
+    std::lock_guard<std::mutex> lock(module_mutex);
+    if(!module)
+        return;
+    MIOPEN_LOG_I2("Unloading module: " << program);
+    // Kernels launched by invokers which are gone by now may still be running.
+    const auto status = hipDeviceSynchronize();
+    if(status != hipSuccess)
+        MIOPEN_LOG_W("hipDeviceSynchronize() failed before unloading " << program << ": "
+                                                                      << hipGetErrorString(status));
+    functions.clear();
+    module.reset();
+}
+
+hipFunction_t HIPOCProgramImpl::GetFunction(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(module_mutex);
+    if(!module)
+    {
+        // Evicted since it has been touched, load it again.
+        module = binary.empty() ? CreateModule(hsaco_file) : CreateModuleInMem(binary);
+    }
+
+    const auto found = functions.find(name);
+    if(found != functions.end())
+        return found->second;
+
+    hipFunction_t fun = nullptr;
+    const auto status = hipModuleGetFunction(&fun, module.get(), name.c_str());
+    if(status != hipSuccess)
+        MIOPEN_THROW_HIP_STATUS(status, "Failed to get function: " + name + " from " + program);
+    functions.emplace(name, fun);
+    return fun;
+}
+
 #if !MIOPEN_USE_COMGR
 void HIPOCProgramImpl::BuildCodeObjectInFile(std::string& params,
                                              std::string_view src,
@@ -297,8 +381,20 @@ void HIPOCProgramImpl::BuildCodeObjectInMemory(const std::string& params,
 }
 #endif // MIOPEN_USE_COMGR
 
+static std::string GetCompilerBackend(const fs::path& program)
+{
+    if(program.extension() == ".mlir")
+        return "mlir";
+#if MIOPEN_USE_COMGR
+    return program.extension() == ".cpp" ? "hiprtc" : "comgr";
+#else
+    return program.extension() == ".cpp" ? "hipcc" : "clang";
+#endif
+}
+
 void HIPOCProgramImpl::BuildCodeObject(std::string params, const std::string& kernel_src)
 {
+    const auto options = params;
     const auto src = [&]() -> std::string_view {
         if(program.extension() == ".mlir")
             return {}; // MLIR solutions do not use source code.
@@ -321,11 +417,39 @@ void HIPOCProgramImpl::BuildCodeObject(std::string params, const std::string& ke
         params += " -Wno-everything";
 #endif
 
+    Timer timer;
+    timer.start();
 #if MIOPEN_USE_COMGR /// \todo Refactor when functionality stabilize.
     BuildCodeObjectInMemory(params, src, program);
 #else
     BuildCodeObjectInFile(params, src, program);
 #endif
+    const auto duration_ms = timer.elapsed_ms();
+
+    if(program.extension() == dynamic_library_postfix)
+        return; // Not built, only copied.
+
+    CompileStat stat;
+    stat.kernel_name = program;
+    stat.kernel_args = options;
+    stat.backend     = GetCompilerBackend(program);
+    stat.arch        = target.Name();
+    stat.source_size = src.size();
+    stat.binary_size = binary.size();
+    stat.duration_ms = duration_ms;
+    if(binary.empty())
+    {
+        // The stats must never fail a build
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+        boost::system::error_code error_code;
+#else
+        std::error_code error_code;
+#endif
+        const auto size = fs::file_size(hsaco_file, error_code);
+        if(!error_code)
+            stat.binary_size = size;
+    }
+    RecordCompileStat(stat);
 }
 
 HIPOCProgram::HIPOCProgram() {}
@@ -352,7 +476,74 @@ HIPOCProgram::HIPOCProgram(const fs::path& program_name, const std::vector<uint8
 {
 }
 
-hipModule_t HIPOCProgram::GetModule() const { return impl->module.get(); }
+HIPOCProgram
+HIPOCProgram::FromImage(const fs::path& program_name, const void* image, std::size_t size)
+{
+    auto p = HIPOCProgram{};
+    p.impl = std::make_shared<HIPOCProgramImpl>(program_name, image, size);
+    return p;
+}
+
+HIPOCProgram HIPOCProgram::Lazy(const fs::path& program_name, const fs::path& hsaco)
+{
+    auto p = HIPOCProgram{};
+    p.impl = std::make_shared<HIPOCProgramImpl>(program_name, hsaco, true);
+    return p;
+}
+
+HIPOCProgram HIPOCProgram::Lazy(const fs::path& program_name, std::vector<char> hsaco)
+{
+    auto p = HIPOCProgram{};
+    p.impl = std::make_shared<HIPOCProgramImpl>(program_name, std::move(hsaco), true);
+    return p;
+}
+
+/// The LRU only holds a weak reference, so it does not extend the lifetime of the program.
+static ModuleLru::Unloader MakeUnloader(const std::shared_ptr<HIPOCProgramImpl>& impl)
+{
+    const auto weak = std::weak_ptr<HIPOCProgramImpl>{impl};
+    return [weak]() {
+        if(const auto locked = weak.lock())
+            locked->UnloadModule();
+    };
+}
+
+/// Registers the use of a lazy program with the LRU, which may evict other modules.
+static void TouchLazyModule(const std::shared_ptr<HIPOCProgramImpl>& impl)
+{
+    ModuleLru::Instance().Touch(impl.get(), MakeUnloader(impl));
+}
+
+hipModule_t HIPOCProgram::GetModule() const
+{
+    if(impl->lazy)
+    {
+        TouchLazyModule(impl);
+        impl->LoadModule();
+    }
+    return impl->module.get();
+}
+
+bool HIPOCProgram::IsLazy() const { return impl->lazy; }
+
+std::shared_ptr<const void> HIPOCProgram::PinModule() const
+{
+    if(!impl->lazy)
+        return nullptr;
+
+    ModuleLru::Instance().Pin(impl.get(), MakeUnloader(impl));
+    // The pin also keeps the program alive, as destroying it would unload the module.
+    return std::shared_ptr<const void>(impl.get(), [keep = impl](HIPOCProgramImpl* pinned) {
+        ModuleLru::Instance().Unpin(pinned);
+    });
+}
+
+hipFunction_t HIPOCProgram::GetFunction(const std::string& name) const
+{
+    if(impl->lazy)
+        TouchLazyModule(impl);
+    return impl->GetFunction(name);
+}
 
 fs::path HIPOCProgram::GetCodeObjectPathname() const
 {
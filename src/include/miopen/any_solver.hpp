@@ -27,6 +27,7 @@
 #ifndef MIOPEN_GUARD_MLOPEN_ANY_SOLVER_HPP
 #define MIOPEN_GUARD_MLOPEN_ANY_SOLVER_HPP
 
+#include <miopen/conv/applicability_filter.hpp>
 #include <miopen/problem_description_base.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/find_solution.hpp>
@@ -129,6 +130,12 @@ struct AnySolver
         return ptr_value->MayNeedWorkspace();
     }
 
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        assert(ptr_value != nullptr);
+        return ptr_value->GetApplicabilityFilter();
+    }
+
     // virtual base class
     struct AnySolver_base
     {
@@ -163,6 +170,7 @@ struct AnySolver
         virtual size_t GetWorkspaceSize(const ExecutionContext& ctx,
                                         const miopen::conv::ProblemDescription& problem) const = 0;
         virtual bool MayNeedWorkspace() const                                                  = 0;
+        virtual miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const               = 0;
     };
 
     // templated derived class
@@ -184,6 +192,20 @@ struct AnySolver
             static constexpr bool Is = type::value;
         };
 
+        struct FilteredSolver
+        {
+            template <typename U>
+            static constexpr auto Test(U*) -> typename std::is_same<
+                miopen::conv::ApplicabilityFilter,
+                decltype(std::declval<const U&>().GetApplicabilityFilter())>::type;
+
+            template <typename U>
+            static constexpr std::false_type Test(...);
+
+            using type               = decltype(Test<T>(nullptr));
+            static constexpr bool Is = type::value;
+        };
+
         struct LegacySolver
         {
             template <typename U>
@@ -372,6 +394,19 @@ struct AnySolver
             return value.GetWorkspaceSize(ctx, problem);
         }
         bool MayNeedWorkspace() const override { return value.MayNeedWorkspace(); }
+
+        miopen::conv::ApplicabilityFilter GetApplicabilityFilter(std::true_type) const
+        {
+            return value.GetApplicabilityFilter();
+        }
+        miopen::conv::ApplicabilityFilter GetApplicabilityFilter(std::false_type) const
+        {
+            return {};
+        }
+        miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const override
+        {
+            return GetApplicabilityFilter(std::integral_constant<bool, FilteredSolver::Is>());
+        }
         const std::type_info& Type() const override { return typeid(T); };
         std::string GetSolverDbId() const override { return value.SolverDbId(); }
 
@@ -102,8 +102,10 @@ class DbTimer<AnyRamDb>
     AnyRamDb& inner;
 
     template <class TFunc>
-    static auto Measure(const std::string& funcName, TFunc&& func)
+    static auto Measure(const char* funcName, TFunc&& func)
     {
+        MIOPEN_TRACE_SCOPE("db", funcName);
+
         if(!miopen::IsLogging(LoggingLevel::Info2))
             return func();
 
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BUFFER_POOL_HPP
+#define GUARD_MIOPEN_BUFFER_POOL_HPP
+
+#include <miopen/allocator.hpp>
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace miopen {
+
+struct BufferPoolStats
+{
+    std::size_t hits           = 0; // requests served from the cache
+    std::size_t misses         = 0; // requests that went to the allocator
+    std::size_t releases       = 0; // blocks given back to the allocator
+    std::size_t bytes_in_use   = 0;
+    std::size_t bytes_cached   = 0;
+    std::size_t peak_bytes     = 0; // max of bytes_in_use + bytes_cached
+    std::size_t blocks_in_use  = 0;
+    std::size_t blocks_cached  = 0;
+};
+
+/// Caching layer over an Allocator for internal scratch buffers.
+///
+/// Requests are rounded up to a size class and a freed block is kept in the
+/// cache of the stream it was acquired for. A later request of the same class
+/// on the same stream reuses it without synchronization, since the work that
+/// used the block was enqueued on that stream earlier. Blocks are never handed
+/// over to another stream.
+///
+/// Cached blocks are given back to the allocator, least recently used first,
+/// once they exceed the high watermark (MIOPEN_BUFFER_POOL_HIGH_WATERMARK, in
+/// MiB). A watermark of 0 disables caching.
+///
+/// Buffers acquired from the pool must not outlive it.
+class MIOPEN_INTERNALS_EXPORT BufferPool
+{
+public:
+    BufferPool();
+    explicit BufferPool(std::size_t high_watermark);
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    ~BufferPool();
+
+    /// Drops the cached blocks, they belong to the previous allocator
+    void SetAllocator(const Allocator& allocator);
+
+    Allocator::ManageDataPtr Acquire(std::size_t sz, const void* stream);
+
+    /// Gives cached blocks back to the allocator until at most target bytes remain
+    void Trim(std::size_t target = 0);
+
+    void SetHighWatermark(std::size_t bytes);
+    std::size_t GetHighWatermark() const;
+
+    BufferPoolStats GetStats() const;
+
+    static std::size_t GetSizeClass(std::size_t sz);
+
+private:
+    using Key = std::pair<const void*, std::size_t>; // stream, size class
+
+    struct Block
+    {
+        void* ptr;
+        std::size_t size;
+        const void* stream;
+        Allocator allocator;
+    };
+
+    struct CachedBlock;
+    using Lru = std::list<CachedBlock>;
+
+    struct CachedBlock
+    {
+        Block block;
+        std::multimap<Key, Lru::iterator>::iterator index;
+    };
+
+    static void Release(void* context, void* ptr);
+    void ReleaseImpl(void* ptr);
+    void TrimImpl(std::size_t target);
+
+    mutable std::mutex mutex;
+    Allocator allocator{};
+    std::size_t high_watermark;
+    std::unordered_map<void*, Block> in_use;
+    Lru lru; // most recently freed first
+    std::multimap<Key, Lru::iterator> cached;
+    BufferPoolStats stats;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BUFFER_POOL_HPP
@@ -1,8 +1,15 @@
 #ifndef GUARD_MIOPEN_CHECK_NUMERICS_HPP
 #define GUARD_MIOPEN_CHECK_NUMERICS_HPP
 
+#include <miopen/allocator.hpp>
 #include <miopen/common.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 namespace miopen {
 
 struct Handle;
@@ -15,6 +22,88 @@ struct CheckNumerics
     static const int Throw        = 0x04; // MIOPEN_THROW on abnormal result
     static const int Abort        = 0x08; // abort on abnormal result (to drop into debugger)
     static const int ComputeStats = 0x10; // Print mean/absmean/min/max (slow)
+    static const int Deferred     = 0x20; // accumulate on device, read back every N checks
+};
+
+// Must keep this structure synchronized with one in MIOpenCheckNumerics
+struct CheckNumericsResult
+{
+    float sum    = 0.0f;
+    float absSum = 0.0f;
+    float min    = 0.0f;
+    float max    = 0.0f;
+
+    int hasZero = 0;
+    int hasNan  = 0;
+    int hasInf  = 0;
+
+    float absMax = 0.0f;
+};
+
+struct NumericsSummary
+{
+    std::size_t checked  = 0; // tensors read back so far
+    std::size_t abnormal = 0; // tensors with a NaN or an Inf
+    std::size_t nans     = 0;
+    std::size_t infs     = 0;
+    float absMax         = 0.0f;
+};
+
+/// Host side of the deferred checks. Remembers which tensor was checked into
+/// each slot of the device buffer and folds the results, once read back, into
+/// a running summary. Does not touch the device.
+class MIOPEN_INTERNALS_EXPORT NumericsAggregator
+{
+public:
+    explicit NumericsAggregator(std::size_t capacity_);
+
+    std::size_t Capacity() const { return capacity; }
+    std::size_t Pending() const { return pending.size(); }
+    bool Full() const { return pending.size() >= capacity; }
+
+    /// Returns the slot the check of the tensor is to write its result to.
+    std::size_t Reserve(const TensorDescriptor& desc, ConstData_t data, bool isInput);
+
+    /// Consumes the results of all pending slots, logging them according to
+    /// the mode. Throws or aborts, if requested, only after the whole batch
+    /// has been accounted for. Returns the number of abnormal tensors.
+    std::size_t Collect(int mode, const CheckNumericsResult* results);
+
+    const NumericsSummary& Summary() const { return summary; }
+
+private:
+    struct Slot
+    {
+        std::string desc;
+        ConstData_t data;
+        std::size_t elements;
+        bool isInput;
+    };
+
+    std::size_t capacity;
+    std::vector<Slot> pending;
+    NumericsSummary summary;
+};
+
+/// Per-handle state of the deferred checks: a persistent device buffer with
+/// one result slot per check, read back when all the slots are used or on
+/// request.
+class MIOPEN_INTERNALS_EXPORT CheckNumericsMonitor
+{
+public:
+    bool Check(const Handle& handle,
+               int mode,
+               const TensorDescriptor& desc,
+               ConstData_t data,
+               bool isInput);
+    NumericsSummary Flush(const Handle& handle, int mode);
+
+private:
+    bool FlushUnlocked(const Handle& handle, int mode);
+
+    std::mutex mutex;
+    std::unique_ptr<NumericsAggregator> aggregator;
+    Allocator::ManageDataPtr results = nullptr;
 };
 
 MIOPEN_INTERNALS_EXPORT bool CheckNumericsEnabled(int bitMask = -1);
@@ -25,6 +114,10 @@ MIOPEN_INTERNALS_EXPORT bool
 checkNumericsOutput(const Handle& handle, const TensorDescriptor& dDesc, ConstData_t data);
 MIOPEN_INTERNALS_EXPORT bool checkNumericsImpl(
     const Handle& handle, int mode, const TensorDescriptor& dDesc, ConstData_t data, bool isInput);
+/// Reports the pending deferred checks. With logOnly set, abnormal results are only
+/// logged, whatever the Throw and Abort bits of MIOPEN_CHECK_NUMERICS say.
+MIOPEN_INTERNALS_EXPORT NumericsSummary flushNumericsChecks(const Handle& handle,
+                                                            bool logOnly = false);
 } // namespace miopen
 
 #endif // GUARD_MIOPEN_CHECK_NUMERICS_HPP
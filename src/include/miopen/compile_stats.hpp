@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_COMPILE_STATS_HPP_
+#define GUARD_MIOPEN_COMPILE_STATS_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// One kernel build, as stored in the compile stats table of the user cache.
+struct CompileStat
+{
+    static std::string table_name() { return "compile_stats"; }
+
+    fs::path kernel_name;
+    std::string kernel_args;
+    std::string backend; // comgr, hiprtc, hipcc, clang or mlir
+    std::string arch;
+    std::size_t source_size = 0;
+    std::size_t binary_size = 0;
+    float duration_ms       = 0.0f;
+
+    static std::vector<std::string> FieldNames()
+    {
+        return {"kernel_name",
+                "kernel_args",
+                "backend",
+                "arch",
+                "source_size",
+                "binary_size",
+                "duration_us",
+                "timestamp"};
+    }
+    static std::string CreateQuery();
+};
+
+/// Path of the compile stats database in the user cache, empty if the cache is disabled.
+MIOPEN_INTERNALS_EXPORT fs::path GetCompileStatsPath();
+
+/// Stores the build in the compile stats database unless MIOPEN_DISABLE_COMPILE_STATS is set.
+/// Failures are logged and never propagated to the build.
+MIOPEN_INTERNALS_EXPORT void RecordCompileStat(const CompileStat& stat);
+
+#if MIOPEN_ENABLE_SQLITE
+class CompileStatsDb : public SQLiteBase<CompileStatsDb>
+{
+public:
+    MIOPEN_INTERNALS_EXPORT CompileStatsDb(const fs::path& filename_, bool is_system_);
+    MIOPEN_INTERNALS_EXPORT bool StoreRecordUnsafe(const CompileStat& stat);
+};
+#endif
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_COMPILE_STATS_HPP_
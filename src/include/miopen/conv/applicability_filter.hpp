@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONV_APPLICABILITY_FILTER_HPP
+#define GUARD_MIOPEN_CONV_APPLICABILITY_FILTER_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/conv_algo_name.hpp>
+
+namespace miopen {
+namespace conv {
+
+struct ProblemDescription;
+
+/// Necessary conditions a solver puts on a problem, checked before its
+/// IsApplicable(). Every check is a few comparisons, so problems that a solver
+/// cannot handle are rejected without touching the (possibly expensive)
+/// applicability logic, e.g. instantiating the CK instance lists.
+///
+/// A default-constructed filter accepts everything. Solvers declare one by
+/// providing `GetApplicabilityFilter() const`.
+struct MIOPEN_INTERNALS_EXPORT ApplicabilityFilter
+{
+    enum Layouts : unsigned
+    {
+        LayoutDefault = 1U << 0, // NCHW / NCDHW for all tensors
+        LayoutNHWC    = 1U << 1, // NHWC / NDHWC for all tensors
+        LayoutOther   = 1U << 2,
+        LayoutAny     = LayoutDefault | LayoutNHWC | LayoutOther,
+    };
+
+    unsigned directions   = ~0U; // bit per conv::Direction
+    unsigned spatial_dims = ~0U; // bit per number of spatial dimensions
+    unsigned layouts      = LayoutAny;
+    bool grouped          = true; // group count > 1
+    bool mixed_types      = true;
+
+    ApplicabilityFilter& ForDirection(conv::Direction direction)
+    {
+        directions = 1U << static_cast<unsigned>(direction);
+        return *this;
+    }
+
+    ApplicabilityFilter& ForSpatialDims(unsigned dims)
+    {
+        spatial_dims = 1U << dims;
+        return *this;
+    }
+
+    ApplicabilityFilter& ForLayouts(unsigned mask)
+    {
+        layouts = mask;
+        return *this;
+    }
+
+    ApplicabilityFilter& NoGroups()
+    {
+        grouped = false;
+        return *this;
+    }
+
+    ApplicabilityFilter& NoMixedTypes()
+    {
+        mixed_types = false;
+        return *this;
+    }
+
+    bool Accepts(const ProblemDescription& problem) const;
+};
+
+} // namespace conv
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONV_APPLICABILITY_FILTER_HPP
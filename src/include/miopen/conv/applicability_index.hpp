@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONV_APPLICABILITY_INDEX_HPP
+#define GUARD_MIOPEN_CONV_APPLICABILITY_INDEX_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace conv {
+
+struct ProblemDescription;
+
+struct ApplicableSolver
+{
+    solver::Id id;
+    std::size_t workspace = 0;
+    float wti             = 0.0f;
+};
+
+struct ApplicabilityIndexStats
+{
+    std::size_t hits    = 0;
+    std::size_t misses  = 0;
+    std::size_t entries = 0;
+};
+
+/// Per-process memo of the dynamic convolution solvers applicable to a
+/// problem, together with their workspace size and WTI, as used by the
+/// immediate mode fallback.
+///
+/// Entries are keyed by the problem (including strides, convolution mode and
+/// attributes), the target device and the ExecutionContext switches that
+/// solvers consult. The key also carries env::getUpdateCount(), so changing
+/// a MIOpen environment variable at runtime does not return stale results.
+/// The least recently used entries are evicted once the index holds
+/// MIOPEN_DEBUG_CONV_IMMED_FALLBACK_CACHE_SIZE of them; 0 disables caching.
+class MIOPEN_INTERNALS_EXPORT ApplicabilityIndex
+{
+public:
+    ApplicabilityIndex() = default;
+    explicit ApplicabilityIndex(std::size_t capacity_) : capacity(capacity_) {}
+
+    static ApplicabilityIndex& Instance();
+
+    /// Applicable dynamic solvers in registry order
+    std::vector<ApplicableSolver> Get(const ExecutionContext& ctx,
+                                      const ProblemDescription& problem);
+
+    void Clear();
+    ApplicabilityIndexStats GetStats() const;
+
+    static std::string MakeKey(const ExecutionContext& ctx, const ProblemDescription& problem);
+    static std::vector<ApplicableSolver> Build(const ExecutionContext& ctx,
+                                               const ProblemDescription& problem);
+
+private:
+    using LruList = std::list<std::string>;
+
+    struct Entry
+    {
+        std::vector<ApplicableSolver> solvers;
+        LruList::iterator lru;
+    };
+
+    std::size_t GetCapacity() const;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    LruList lru;
+    std::optional<std::size_t> capacity; // the env setting if empty
+    std::size_t hits   = 0;
+    std::size_t misses = 0;
+};
+
+} // namespace conv
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONV_APPLICABILITY_INDEX_HPP
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONV_FIND_REFINEMENT_HPP
+#define GUARD_MIOPEN_CONV_FIND_REFINEMENT_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/env.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_FIND_DB_REFINEMENT)
+
+namespace miopen {
+
+struct Problem;
+
+namespace conv {
+
+/// Runs Find in the background for problems served by a find-db record of a nearby problem
+/// (see MIOPEN_FIND_DB_NEAREST), so the exact record lands in the user find-db and later
+/// lookups use measured data. Each problem is refined once per process, one at a time, on a
+/// separate thread and HIP stream.
+class MIOPEN_INTERNALS_EXPORT FindRefinement
+{
+public:
+    using Refiner = std::function<void(const ProblemDescription&)>;
+
+    explicit FindRefinement(Refiner refiner_);
+    ~FindRefinement();
+
+    FindRefinement(const FindRefinement&) = delete;
+    FindRefinement& operator=(const FindRefinement&) = delete;
+
+    static FindRefinement& Instance();
+
+    /// Queues the problem unless it has been queued before.
+    void Enqueue(const ProblemDescription& problem);
+    /// Blocks until the queue is empty and the worker is idle.
+    void Wait();
+
+    /// Describes the problem the way Find 2.0 expects it. Transposed convolutions are not
+    /// supported.
+    static Problem AsFindProblem(const ProblemDescription& problem);
+    /// Finds solutions for the problem using freshly allocated buffers.
+    static void Find(const ProblemDescription& problem);
+
+private:
+    Refiner refiner;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable idle;
+    std::deque<ProblemDescription> queue;
+    std::unordered_set<std::string> queued;
+    bool busy = false;
+    bool stop = false;
+    std::thread worker;
+
+    void Run();
+};
+
+} // namespace conv
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONV_FIND_REFINEMENT_HPP
@@ -385,6 +385,15 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
 
     void Serialize(std::ostream& stream) const;
 
+    /// Distance between the problems serialized into the find-db keys, if these differ in the
+    /// batch size and the spatial sizes of the tensors only. Each differing size adds the log2 of
+    /// the ratio of its values. Returns a negative value for other keys.
+    static double FindDbKeyDistance(std::string_view key, std::string_view other);
+
+    /// The same for the PerfDb keys, which are made of the values visited by VisitAll(). Only
+    /// the batch size and the input spatial sizes may differ, the output sizes follow from them.
+    static double PerfDbKeyDistance(std::string_view key, std::string_view other);
+
     friend std::ostream& operator<<(std::ostream& os, const ProblemDescription& obj)
     {
         obj.Serialize(os);
@@ -28,6 +28,7 @@
 
 #include <miopen/config.hpp>
 
+#include <miopen/conv/applicability_filter.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/execution_context.hpp>
@@ -119,6 +120,7 @@ struct PerformanceConfigConvAsm3x3U : PerfConfigBase<PerformanceConfigConvAsm3x3
 struct ConvAsm3x3U final : ConvTunableSolver<PerformanceConfigConvAsm3x3U>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm3x3U>(); }
+    bool IsTuningSpaceThreadSafe() const override { return true; }
 
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
@@ -227,6 +229,7 @@ private:
 struct ConvAsm1x1U final : ConvTunableSolver<PerformanceConfigConvAsm1x1U>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm1x1U>(); }
+    bool IsTuningSpaceThreadSafe() const override { return true; }
 
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsm1x1U GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
@@ -2234,6 +2237,7 @@ struct PerformanceConfigAsmDirect3x3WrW : PerfConfigBase<PerformanceConfigAsmDir
 struct ConvAsmBwdWrW3x3 final : ConvTunableSolver<PerformanceConfigAsmDirect3x3WrW>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsmBwdWrW3x3>(); }
+    bool IsTuningSpaceThreadSafe() const override { return true; }
 
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmDirect3x3WrW GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
@@ -2377,6 +2381,7 @@ struct PerformanceConfigConvAsmBwdWrW1x1 : PerfConfigBase<PerformanceConfigConvA
 struct ConvAsmBwdWrW1x1 final : ConvTunableSolver<PerformanceConfigConvAsmBwdWrW1x1>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsmBwdWrW1x1>(); }
+    bool IsTuningSpaceThreadSafe() const override { return true; }
 
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsmBwdWrW1x1 MIOPEN_INTERNALS_EXPORT
     GetDefaultPerformanceConfig(const ExecutionContext&,
@@ -4308,6 +4313,15 @@ struct ConvHipImplicitGemmFwdXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::Forward)
+            .ForSpatialDims(2)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoGroups()
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4390,6 +4404,15 @@ struct ConvHipImplicitGemmBwdXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::BackwardData)
+            .ForSpatialDims(2)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoGroups()
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4476,6 +4499,15 @@ struct ConvHipImplicitGemmGroupFwdXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::Forward)
+            .ForSpatialDims(2)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutDefault |
+                        miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4553,6 +4585,15 @@ struct ConvHipImplicitGemm3DGroupFwdXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::Forward)
+            .ForSpatialDims(3)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutDefault |
+                        miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4630,6 +4671,15 @@ struct ConvHipImplicitGemm3DGroupWrwXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::BackwardWeights)
+            .ForSpatialDims(3)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutDefault |
+                        miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4707,6 +4757,15 @@ struct ConvHipImplicitGemm3DGroupBwdXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::BackwardData)
+            .ForSpatialDims(3)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutDefault |
+                        miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4798,6 +4857,15 @@ struct ConvHipImplicitGemmGroupBwdXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::BackwardData)
+            .ForSpatialDims(2)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutDefault |
+                        miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
@@ -4892,6 +4960,15 @@ struct ConvHipImplicitGemmGroupWrwXdlops final
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
+    miopen::conv::ApplicabilityFilter GetApplicabilityFilter() const
+    {
+        return miopen::conv::ApplicabilityFilter{}
+            .ForDirection(miopen::conv::Direction::BackwardWeights)
+            .ForSpatialDims(2)
+            .ForLayouts(miopen::conv::ApplicabilityFilter::LayoutDefault |
+                        miopen::conv::ApplicabilityFilter::LayoutNHWC)
+            .NoMixedTypes();
+    }
     MIOPEN_INTERNALS_EXPORT ConvSolution
     GetSolution(const ExecutionContext&,
                 const miopen::conv::ProblemDescription&,
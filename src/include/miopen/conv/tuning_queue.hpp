@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONV_TUNING_QUEUE_HPP
+#define GUARD_MIOPEN_CONV_TUNING_QUEUE_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/conv/find_refinement.hpp>
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_BACKGROUND_TUNING)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_BACKGROUND_TUNING_WORKER)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BACKGROUND_TUNING_IDLE_MS,
+                              1000) // Time without immediate mode queries before tuning starts
+
+namespace miopen {
+
+struct Handle;
+
+namespace conv {
+
+/// Persistent queue of problems for which immediate mode had no find-db record and fell back to
+/// heuristics. Queued problems are tuned (exhaustive Find, i.e. GenericSearch for tunable
+/// solvers) either by a worker thread once immediate mode has been idle for a while, or by a
+/// separate process through miopenTuneQueuedProblems(). Tuning publishes the results to the user
+/// find-db and perf-db, so later lookups use measured data.
+///
+/// The queue is a text file with one JSON encoded problem per line, guarded by a lock file, so
+/// several processes may share it.
+class MIOPEN_INTERNALS_EXPORT TuningQueue
+{
+public:
+    using Tuner = std::function<void(const Problem&)>;
+
+    /// Starts the worker if `worker_` is set and schedules the problems already in the file.
+    TuningQueue(fs::path file_, Tuner tuner_, std::chrono::milliseconds idle_period_, bool worker_);
+    ~TuningQueue();
+
+    TuningQueue(const TuningQueue&) = delete;
+    TuningQueue& operator=(const TuningQueue&) = delete;
+
+    static TuningQueue& Instance();
+    static fs::path GetDefaultPath();
+
+    /// Persists the problem unless it is queued already and schedules it for the worker.
+    void Enqueue(const ProblemDescription& problem);
+    /// Postpones tuning by the idle period. Called on every immediate mode query.
+    void NotifyActivity();
+    /// Blocks until the worker has tuned all scheduled problems.
+    void Wait();
+    /// Number of problems in the file waiting for tuning.
+    std::size_t Size() const;
+
+    /// Tunes all problems queued in the file and removes them from it. Returns their number.
+    static std::size_t Drain(const fs::path& file, const Tuner& tuner);
+    /// Runs exhaustive Find for the problem on a handle of its own.
+    static void Tune(const Problem& problem);
+    static void Tune(Handle& handle, const Problem& problem);
+
+private:
+    fs::path file;
+    Tuner tuner;
+    std::chrono::milliseconds idle_period;
+    mutable std::mutex mutex;
+    std::condition_variable activity;
+    std::chrono::steady_clock::time_point last_activity;
+    bool stop = false;
+    std::unique_ptr<FindRefinement> worker;
+
+    bool WaitForIdle();
+    void TuneScheduled(const ProblemDescription& problem);
+};
+
+} // namespace conv
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONV_TUNING_QUEUE_HPP
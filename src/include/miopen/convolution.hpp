@@ -32,6 +32,7 @@
 #include <miopen/kernel.hpp>
 #include <miopen/miopen.h>
 #include <miopen/object.hpp>
+#include <miopen/selection_policy.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/names.hpp>
 #include <miopen/invoke_params.hpp>
@@ -42,6 +43,7 @@
 
 #include <boost/any.hpp>
 
+#include <optional>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -149,7 +151,8 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
                                       const conv::ProblemDescription& problem,
                                       const AnyInvokeParams& invoke_ctx,
                                       int requestAlgoCount,
-                                      bool force_attach_binary);
+                                      bool force_attach_binary,
+                                      const SelectionPolicy* policy = nullptr);
 
 struct MIOPEN_INTERNALS_EXPORT ConvolutionDescriptor : miopenConvolutionDescriptor
 {
@@ -354,6 +357,8 @@ struct MIOPEN_INTERNALS_EXPORT ConvolutionDescriptor : miopenConvolutionDescript
     float lowp_quant; // quantization factor for low precision
     FindMode findMode;
     ConvolutionAttribute attribute;
+    /// Replaces ordering by time in Find and immediate mode when set.
+    std::optional<SelectionPolicy> selection_policy;
 
     std::vector<miopenConvSolution_t>
     GetSolutionsFallback(const ExecutionContext& ctx,
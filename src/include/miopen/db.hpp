@@ -28,6 +28,7 @@
 
 #include <miopen/db_record.hpp>
 #include <miopen/rank.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/filesystem.hpp>
 
 #include <boost/core/explicit_operator_bool.hpp>
@@ -114,7 +115,7 @@ public:
     Update(const T& problem_config, const std::string& id, const V& values)
     {
         DbRecord record(db_kind, problem_config);
-        record.SetValues(id, values);
+        record.SetPackableValues(id, values);
         const auto ok = UpdateRecord(record);
         if(ok)
             return record;
@@ -341,8 +342,10 @@ private:
     TInnerDb inner;
 
     template <class TFunc>
-    static auto Measure(const std::string& funcName, TFunc&& func)
+    static auto Measure(const char* funcName, TFunc&& func)
     {
+        MIOPEN_TRACE_SCOPE("db", funcName);
+
         if(!miopen::IsLogging(LoggingLevel::Info2))
             return func();
 
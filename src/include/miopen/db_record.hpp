@@ -28,6 +28,7 @@
 
 #include <miopen/config.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/packed_values.hpp>
 
 #include <cassert>
 #include <istream>
@@ -165,6 +166,8 @@ public:
 private:
     std::string key;
     std::unordered_map<std::string, std::string> map;
+    /// Packed form of the VALUES set by SetPackableValues(), see Merge().
+    std::unordered_map<std::string, std::string> packed_map;
 
     template <class T>
     static // 'static' is for calling from ctor
@@ -233,8 +236,13 @@ public:
     /// E.g. this = {ID1:VALUE1}
     ///      that = {ID1:VALUE3, ID2:VALUE2}
     ///      this.Merge(that) = {ID1:VALUE1, ID2:VALUE2}
+    /// If that record holds packed VALUES, VALUES set by SetPackableValues() are stored packed,
+    /// so a record keeps the format it is stored in.
     void Merge(const DbRecord& that);
 
+    /// Returns true if any VALUES of this record are packed.
+    bool HasPackedValues() const;
+
     /// Obtains VALUES from an object of class T and sets it in record (in association with ID,
     /// under the current KEY).
     /// T shall have the "void Serialize(std::ostream&) const" member function available.
@@ -246,6 +254,33 @@ public:
         return SetValues(id, Serialize(values));
     }
 
+    /// Same as above, but stores packed VALUES if requested and supported by T.
+    template <class T>
+    bool SetValues(const std::string& id, const T& values, bool packed)
+    {
+        if constexpr(solver::serialize::SupportsPacked<T>{})
+        {
+            std::string s;
+            if(packed && values.SerializePacked(s))
+                return SetValues(id, s);
+        }
+        return SetValues(id, values);
+    }
+
+    /// Same as above, but also keeps packed VALUES if supported by T, for Merge() to use
+    /// if the stored record is packed.
+    template <class T>
+    bool SetPackableValues(const std::string& id, const T& values)
+    {
+        if constexpr(solver::serialize::SupportsPacked<T>{})
+        {
+            std::string s;
+            if(values.SerializePacked(s))
+                packed_map[id] = std::move(s);
+        }
+        return SetValues(id, values);
+    }
+
     /// Get VALUES associated with ID under the current KEY and delivers those to a member function
     /// of a class T object. T shall have the "bool Deserialize(const std::string& str)"
     /// member function available.
@@ -259,6 +294,14 @@ public:
         if(!GetValues(id, s))
             return false;
 
+        // Types unaware of packed VALUES get them converted to text first.
+        if constexpr(!solver::serialize::SupportsPacked<T>{})
+        {
+            std::string text;
+            if(solver::serialize::IsPacked(s) && solver::serialize::UnpackToText(s, text))
+                s = std::move(text);
+        }
+
         const bool ok = values.Deserialize(s);
         if(!ok)
         {
@@ -41,6 +41,9 @@ namespace miopen::env {
 MIOPEN_EXPORT std::optional<std::string> getEnvironmentVariable(std::string_view name);
 MIOPEN_EXPORT void setEnvironmentVariable(std::string_view name, std::string_view value);
 MIOPEN_EXPORT void clearEnvironmentVariable(std::string_view name);
+/// Number of times MIOpen has set or cleared an environment variable.
+/// Lets caches of env-dependent results notice runtime changes.
+MIOPEN_EXPORT std::size_t getUpdateCount();
 
 namespace detail {
 
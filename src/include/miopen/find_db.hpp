@@ -41,9 +41,14 @@
 #include <boost/optional.hpp>
 
 #include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_FIND_DB)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_FIND_DB_NEAREST)
 
 namespace miopen {
 
@@ -75,6 +80,22 @@ testing_find_db_path_override(); /// \todo Remove when #1723 is resolved.
 
 } // namespace debug
 
+/// Problems providing "static double FindDbKeyDistance(std::string_view, std::string_view)" may
+/// be served by records of nearby problems when the find-db has none for the exact problem.
+template <class TProblemDescription, class = void>
+struct HasFindDbKeyDistance : std::false_type
+{
+};
+
+template <class TProblemDescription>
+struct HasFindDbKeyDistance<
+    TProblemDescription,
+    std::void_t<decltype(TProblemDescription::FindDbKeyDistance(std::string_view{},
+                                                                std::string_view{}))>>
+    : std::true_type
+{
+};
+
 template <class TDb>
 class FindDbRecord_t
 {
@@ -108,6 +129,9 @@ public:
 
         content = db->FindRecord(problem);
         in_sync = content.is_initialized();
+
+        if(!in_sync && env::enabled(MIOPEN_FIND_DB_NEAREST))
+            LoadNearest(problem);
     }
 
     template <class TProblemDescription, class TTestDb = TDb>
@@ -145,6 +169,8 @@ public:
     auto end() const { return content->As<FindDbData>().end(); }
     auto end() { return content->As<FindDbData>().end(); }
     bool empty() const { return !content.is_initialized(); }
+    /// The record belongs to the nearest problem found in the find-db, not to the requested one.
+    bool IsApproximate() const { return approximate; }
 
     template <class TProblemDescription>
     static std::vector<Solution> TryLoad(Handle& handle,
@@ -189,14 +215,42 @@ private:
     fs::path installed_path;
     boost::optional<DbTimer<TDb>> db;
     boost::optional<DbRecord> content{boost::none};
-    bool in_sync    = false;
-    bool dont_store = false; // E.g. to skip writing sub-optimal find-db records to disk.
+    bool in_sync     = false;
+    bool dont_store  = false; // E.g. to skip writing sub-optimal find-db records to disk.
+    bool approximate = false;
 
     static fs::path GetInstalledPath(Handle& handle, const std::string& path_suffix);
     static fs::path GetInstalledPathEmbed(Handle& handle, const std::string& path_suffix);
     static fs::path GetInstalledPathFile(Handle& handle, const std::string& path_suffix);
     static fs::path GetUserPath(Handle& handle, const std::string& path_suffix);
 
+    template <class TProblemDescription>
+    void LoadNearest(const TProblemDescription& problem)
+    {
+        if constexpr(HasFindDbKeyDistance<TProblemDescription>{})
+        {
+            const auto key     = DbRecord{DbKinds::FindDb, problem}.GetKey();
+            const auto nearest = FindNearestKey(key, &TProblemDescription::FindDbKeyDistance);
+            if(!nearest)
+                return;
+
+            content     = db->FindRecord(*nearest);
+            approximate = in_sync = content.is_initialized();
+            if(approximate)
+                MIOPEN_LOG_I("Find-db record " << *nearest << " is used for " << key);
+        }
+        else
+        {
+            std::ignore = problem;
+        }
+    }
+
+    /// Scans the keys of the find-db files for the one nearest to the given key. Results are
+    /// remembered for the lifetime of the process.
+    std::optional<std::string>
+    FindNearestKey(const std::string& key,
+                   double (*distance)(std::string_view, std::string_view)) const;
+
     // Returns true if rebuild is required
     bool Validate(Handle& handle, const NetworkConfig& config) const;
     void CopyTo(std::vector<Solution>& to) const;
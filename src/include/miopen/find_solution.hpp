@@ -34,16 +34,26 @@
 #include <miopen/execution_context.hpp>
 #include <miopen/find_controls.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
 #include <miopen/mlo_internal.hpp>
+#include <miopen/par_for.hpp>
 #include <miopen/search_options.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/solver.hpp>
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <type_traits>
 #include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_FIND_PARALLEL_SOLVERS)
+
 namespace miopen {
 
 struct AnyInvokeParams;
@@ -237,6 +247,40 @@ InvokerFactory GetInvokeFactory(Solver s,
     return GetInvokeFactoryImpl(rank<1>{}, s, context, problem, perf_cfg);
 }
 
+/// Forwards the perf-db accesses of solvers found concurrently one at a time, because the
+/// perf-db classes must not be used from several threads at once.
+template <class Db>
+class SerializedDb
+{
+public:
+    SerializedDb(Db& db_, std::mutex& mutex_) : db(db_), mutex(mutex_) {}
+
+    template <class... Args>
+    auto Load(Args&&... args)
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        return db.Load(std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    auto Update(Args&&... args)
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        return db.Update(std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    auto Remove(Args&&... args)
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        return db.Remove(std::forward<Args>(args)...);
+    }
+
+private:
+    Db& db;
+    std::mutex& mutex;
+};
+
 template <class... Solvers>
 struct SolverContainer
 {
@@ -280,52 +324,38 @@ struct SolverContainer
                           std::size_t limit = std::numeric_limits<std::size_t>::max(),
                           const std::optional<FindOptions>& options = std::nullopt) const
     {
-        std::vector<Solution> ss;
-        std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
-        miopen::each_args(
+        const auto enforce =
+            options && options->find_enforce ? *options->find_enforce : FindEnforce{};
+
+        auto db_mutex     = std::mutex{};
+        auto db_reference = [&]() -> decltype(auto) {
+            if constexpr(std::is_invocable_v<Db>)
+                return db();
+            else
+                return (db);
+        };
+        auto serialized_db = [&]() {
+            using DbType = std::remove_reference_t<decltype(db_reference())>;
+            return SerializedDb<DbType>{db_reference(), db_mutex};
+        };
+
+        return EvaluateSolvers<Solution>(
+            ctx,
+            problem,
+            limit,
+            true,
+            IsConcurrentFindAllowed(ctx, enforce),
             [&](auto solver) {
-                if(count >= limit)
-                    return;
-                if(find_only &&
-                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
-                    find_only->end()))
-                { // Do nothing (and keep silence for the sake of Tuna), just skip.
-                }
-                // For better performance, check IsDynamic() first, because
-                // it is much faster than IsApplicable().
-                else if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
-                {
-                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
-                }
-                else if(!solver.IsApplicable(ctx, problem))
-                {
-                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
-                }
-                else
-                {
-                    const Solution s =
-                        FindSolution(solver, ctx, problem, db, invoke_ctx, "", options);
-                    if(s.Succeeded())
-                    {
-                        ++count;
-                        ss.push_back(s);
-                        MIOPEN_LOG_I2(solver.SolverDbId() << ": Success.");
-                    }
-                    else
-                    {
-                        /// \todo If Solver is applicable it must provide an appropriate Solution.
-                        /// This is not the case for some 20x5 convolutions (and possibly others).
-                        /// Normally we should not get here and message level should be Error.
-                        /// For now, let's use Info (not Warning) level to avoid
-                        /// flooding the console.
-                        MIOPEN_LOG_I(solver.SolverDbId()
-                                     << ": [Warning] Applicable Solver not succeeded.");
-                    }
-                }
+                return FindSolution(solver, ctx, problem, serialized_db, invoke_ctx, "", options);
             },
-            Solvers{}...);
-        return ss;
+            [](auto solver) {
+                /// \todo If Solver is applicable it must provide an appropriate Solution.
+                /// This is not the case for some 20x5 convolutions (and possibly others).
+                /// Normally we should not get here and message level should be Error.
+                /// For now, let's use Info (not Warning) level to avoid
+                /// flooding the console.
+                MIOPEN_LOG_I(solver.SolverDbId() << ": [Warning] Applicable Solver not succeeded.");
+            });
     }
 
     // Search for all applicable solutions among many solvers
@@ -337,61 +367,41 @@ struct SolverContainer
                        const AnyInvokeParams& invoke_params = {}) const
     {
         auto db_container = std::optional<PerformanceDb>{};
-        std::vector<Solution> ss;
-        std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
-        miopen::each_args(
+        auto db_once      = std::once_flag{};
+        auto db_mutex     = std::mutex{};
+
+        return EvaluateSolvers<Solution>(
+            ctx,
+            problem,
+            limit,
+            // For better performance, check IsDynamic() first, because
+            // it is much faster than IsApplicable().
+            // problem.use_dynamic_solutions_only && !solver.IsDynamic()
+            false,
+            IsConcurrentFindAllowed(ctx, FindEnforce{}),
             [&](auto solver) {
-                if(count >= limit)
-                    return;
-                if(find_only &&
-                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
-                    find_only->end()))
-                { // Do nothing (and keep silence for the sake of Tuna), just skip.
-                }
-                // For better performance, check IsDynamic() first, because
-                // it is much faster than IsApplicable().
-                // else if(problem.use_dynamic_solutions_only && !solver.IsDynamic())
-                //    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
-                else if(!solver.IsApplicable(ctx, problem))
-                {
-                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
-                }
-                else
-                {
-                    auto db = [&]() -> PerformanceDb& {
-                        constexpr auto db_getter =
-                            []([[maybe_unused]] const ExecutionContext& ctx,
-                               [[maybe_unused]] const auto& problem) -> PerformanceDb {
-                            if constexpr(IsTunable<decltype(solver)>())
-                                return GetDb(ctx, problem);
-                            else
-                                MIOPEN_THROW(miopenStatusInternalError);
-                        };
-
-                        if(!db_container)
-                            db_container.emplace(std::move(db_getter(ctx, problem)));
-
-                        return *db_container;
+                auto db = [&]() {
+                    constexpr auto db_getter =
+                        []([[maybe_unused]] const ExecutionContext& ctx,
+                           [[maybe_unused]] const auto& problem) -> PerformanceDb {
+                        if constexpr(IsTunable<decltype(solver)>())
+                            return GetDb(ctx, problem);
+                        else
+                            MIOPEN_THROW(miopenStatusInternalError);
                     };
 
-                    auto s =
-                        FindSolution(solver, ctx, problem, db, invoke_params, "", std::nullopt);
-
-                    if(s.Succeeded())
-                    {
-                        ++count;
-                        ss.emplace_back(std::move(s));
-                        MIOPEN_LOG_I2(solver.SolverDbId() << ": Success.");
-                    }
-                    else
-                    {
-                        MIOPEN_LOG_E(solver.SolverDbId() << ": Applicable Solver not succeeded.");
-                    }
-                }
+                    std::call_once(db_once, [&]() {
+                        db_container.emplace(std::move(db_getter(ctx, problem)));
+                    });
+
+                    return SerializedDb<PerformanceDb>{*db_container, db_mutex};
+                };
+
+                return FindSolution(solver, ctx, problem, db, invoke_params, "", std::nullopt);
             },
-            Solvers{}...);
-        return ss;
+            [](auto solver) {
+                MIOPEN_LOG_E(solver.SolverDbId() << ": Applicable Solver not succeeded.");
+            });
     }
 
     template <class Context, class Problem>
@@ -510,6 +520,168 @@ struct SolverContainer
     {
         return ExecutePrimitive(&handle, problem, algo, invoke_params);
     }
+
+private:
+    enum class Verdict
+    {
+        Skipped,
+        NonDynamic,
+        NotApplicable,
+        Applicable,
+    };
+
+    /// Tuning benchmarks the kernels and writes the perf-db, and DbClean removes its records,
+    /// so both have to go one solver at a time.
+    template <class Context>
+    static bool IsConcurrentFindAllowed(const Context& ctx, const FindEnforce& enforce)
+    {
+        return !ctx.do_search && !enforce.IsSearch(ctx) && !enforce.IsDbClean(ctx);
+    }
+
+    template <class Solver, class Context, class Problem>
+    static Verdict CheckSolver(Solver solver,
+                               const Context& ctx,
+                               const Problem& problem,
+                               const boost::optional<std::vector<solver::Id>>& find_only,
+                               bool check_dynamic)
+    {
+        if(find_only && (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
+                         find_only->end()))
+            return Verdict::Skipped;
+        // For better performance, check IsDynamic() first, because
+        // it is much faster than IsApplicable().
+        if(check_dynamic && ctx.use_dynamic_solutions_only && !solver.IsDynamic())
+            return Verdict::NonDynamic;
+        return solver.IsApplicable(ctx, problem) ? Verdict::Applicable : Verdict::NotApplicable;
+    }
+
+    /// Calls f(solver, index) for each solver, on up to the given number of threads of the
+    /// shared pool. With a single thread the solvers are visited in order.
+    template <class F>
+    static void ForEachSolver(std::size_t threads, F&& f)
+    {
+        ForEachSolverImpl(threads, f, std::index_sequence_for<Solvers...>{});
+    }
+
+    template <class F, std::size_t... Is>
+    static void ForEachSolverImpl(std::size_t threads, F& f, std::index_sequence<Is...>)
+    {
+        if(threads <= 1)
+        {
+            (f(Solvers{}, Is), ...);
+            return;
+        }
+
+        const auto tasks = std::array<std::function<void()>, sizeof...(Solvers)>{
+            [&f]() { f(Solvers{}, Is); }...};
+        par_for(tasks.size(), max_threads{threads}, [&](std::size_t i) { tasks[i](); });
+    }
+
+    /// Returns the solutions of the applicable solvers in the order of the container.
+    ///
+    /// Without a limit the applicability checks run concurrently, and so do the find calls when
+    /// concurrent_find is set, unless MIOPEN_DEBUG_FIND_PARALLEL_SOLVERS=0. The log messages
+    /// of each solver are collected and printed afterwards in solver order, together with the
+    /// results, so both the returned list and the log do not depend on scheduling. Otherwise
+    /// the solvers are visited one by one and the search stops as soon as the limit is reached.
+    template <class Solution, class Context, class Problem, class Find, class OnFailure>
+    static std::vector<Solution> EvaluateSolvers(const Context& ctx,
+                                                 const Problem& problem,
+                                                 std::size_t limit,
+                                                 bool check_dynamic,
+                                                 bool concurrent_find,
+                                                 Find find,
+                                                 OnFailure on_failure)
+    {
+        constexpr auto solvers_count = sizeof...(Solvers);
+
+        const auto find_only = GetEnvFindOnlySolver();
+        auto verdicts        = std::array<Verdict, solvers_count>{};
+        auto found           = std::array<std::optional<Solution>, solvers_count>{};
+        auto logs            = std::array<std::string, solvers_count>{};
+        auto ss              = std::vector<Solution>{};
+
+        const auto check = [&](auto solver, std::size_t i) {
+            verdicts[i] = CheckSolver(solver, ctx, problem, find_only, check_dynamic);
+        };
+
+        const auto solve = [&](auto solver, std::size_t i) {
+            if(verdicts[i] == Verdict::Applicable)
+                found[i].emplace(find(solver));
+        };
+
+        const auto buffered = [&](const auto& step) {
+            return [&](auto solver, std::size_t i) {
+                auto buffer = LogBuffer{};
+                step(solver, i);
+                logs[i] += buffer.Take();
+            };
+        };
+
+        const auto flush_log = [&](std::size_t i) {
+            if(!logs[i].empty())
+                LogWrite(std::exchange(logs[i], {}));
+        };
+
+        const auto report = [&](auto solver, std::size_t i) {
+            flush_log(i);
+
+            switch(verdicts[i])
+            {
+            case Verdict::Skipped:
+                // Do nothing (and keep silence for the sake of Tuna), just skip.
+                break;
+            case Verdict::NonDynamic:
+                MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
+                break;
+            case Verdict::NotApplicable:
+                MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
+                break;
+            case Verdict::Applicable:
+                if(found[i]->Succeeded())
+                {
+                    ss.emplace_back(std::move(*found[i]));
+                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Success.");
+                }
+                else
+                {
+                    on_failure(solver);
+                }
+                break;
+            }
+        };
+
+        if(limit == std::numeric_limits<std::size_t>::max() &&
+           !env::disabled(MIOPEN_DEBUG_FIND_PARALLEL_SOLVERS))
+        {
+            ForEachSolver(solvers_count, buffered(check));
+            if(concurrent_find)
+            {
+                ForEachSolver(solvers_count, buffered(solve));
+                ForEachSolver(1, report);
+            }
+            else
+            {
+                ForEachSolver(1, [&](auto solver, std::size_t i) {
+                    flush_log(i);
+                    solve(solver, i);
+                    report(solver, i);
+                });
+            }
+        }
+        else
+        {
+            ForEachSolver(1, [&](auto solver, std::size_t i) {
+                if(ss.size() >= limit)
+                    return;
+                check(solver, i);
+                solve(solver, i);
+                report(solver, i);
+            });
+        }
+
+        return ss;
+    }
 };
 
 } // namespace solver
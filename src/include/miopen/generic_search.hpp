@@ -30,6 +30,7 @@
 #include <miopen/binary_cache.hpp>
 #include <miopen/config.hpp>
 #include <miopen/conv_solution.hpp>
+#include <miopen/db_record.hpp>
 #include <miopen/env.hpp>
 #include <miopen/execution_context.hpp>
 #include <miopen/handle.hpp>
@@ -38,6 +39,10 @@
 #include <miopen/timer.hpp>
 #include <miopen/mt_queue.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/tuning_space_index.hpp>
+#include <miopen/tuning_transfer.hpp>
+#include <miopen/tuning_trace.hpp>
 
 #include <algorithm>
 #include <vector>
@@ -46,7 +51,13 @@
 #include <iterator>
 #include <chrono>
 #include <cassert>
+#include <optional>
 #include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 
 namespace miopen {
 namespace solver {
@@ -284,6 +295,154 @@ auto GetAllConfigs(const Solver s, const Context& context, const Problem& proble
     return all_configs;
 }
 
+/// Walks the tuning space from PerformanceConfig(spare) and marks the valid configs.
+/// If concurrent is set, IsValid() is evaluated concurrently for batches of consecutive points,
+/// see SolverBase::IsTuningSpaceThreadSafe().
+template <class PerformanceConfig, class Context, class Problem>
+TuningSpaceMask ComputeTuningSpaceMask(const Context& context,
+                                       const Problem& problem,
+                                       bool spare,
+                                       bool concurrent)
+{
+    constexpr std::size_t batch_size = 4096;
+
+    auto mask   = TuningSpaceMask{};
+    auto batch  = std::vector<PerformanceConfig>{};
+    auto valid  = std::vector<char>{};
+    auto config = PerformanceConfig(spare);
+    auto more   = true;
+
+    mask.spare = spare;
+    batch.reserve(batch_size);
+
+    while(more)
+    {
+        batch.clear();
+        while(more && batch.size() < batch_size)
+        {
+            batch.push_back(config);
+            more = config.SetNextValue(problem);
+        }
+
+        valid.assign(batch.size(), 0);
+        const auto validate = [&](std::size_t i) {
+            valid[i] = batch[i].IsValid(context, problem) ? 1 : 0;
+        };
+        if(concurrent)
+        {
+            par_for(batch.size(), validate);
+        }
+        else
+        {
+            for(std::size_t i = 0; i < batch.size(); ++i)
+                validate(i);
+        }
+
+        const auto first = mask.size;
+        mask.Resize(first + batch.size());
+        for(std::size_t i = 0; i < batch.size(); ++i)
+        {
+            if(valid[i] != 0)
+                mask.Set(first + i);
+        }
+    }
+
+    return mask;
+}
+
+/// Rebuilds the valid configs marked in the mask. Returns nothing if the walk over the
+/// tuning space does not have the length recorded in the mask.
+template <class PerformanceConfig, class Problem>
+std::optional<std::vector<PerformanceConfig>> GetTuningSpaceConfigs(const TuningSpaceMask& mask,
+                                                                    const Problem& problem)
+{
+    auto configs  = std::vector<PerformanceConfig>{};
+    auto config   = PerformanceConfig(mask.spare);
+    std::size_t i = 0;
+
+    configs.reserve(mask.Count());
+    for(auto more = true; more; ++i)
+    {
+        if(i >= mask.size)
+            return std::nullopt;
+        if(mask.Test(i))
+            configs.push_back(config);
+        more = config.SetNextValue(problem);
+    }
+
+    if(i != mask.size)
+        return std::nullopt;
+    return configs;
+}
+
+/// Hashes the serialized configs of both walks over the tuning space, see TuningSpaceHash.
+template <class PerformanceConfig, class Problem>
+std::string HashTuningSpace(const Problem& problem)
+{
+    auto hash = TuningSpaceHash{};
+    auto ss   = std::ostringstream{};
+
+    for(const auto spare : {false, true})
+    {
+        hash.Add(spare ? "spare" : "main");
+        auto config = PerformanceConfig(spare);
+        do
+        {
+            ss.str({});
+            config.Serialize(ss);
+            hash.Add(ss.str());
+        } while(config.SetNextValue(problem));
+    }
+
+    return hash.ToString();
+}
+
+/// Returns the same configs as GetAllConfigs, in the same order. The valid points of the tuning
+/// space are looked up in the TuningSpaceIndex and only enumerated on a miss.
+template <class Solver, class Context, class Problem>
+auto GetValidConfigs(const Solver s, const Context& context, const Problem& problem)
+    -> std::vector<decltype(s.GetDefaultPerformanceConfig(context, problem))>
+{
+    using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
+
+    if(env::disabled(MIOPEN_DEBUG_TUNING_SPACE_INDEX))
+    {
+        const auto all_configs = GetAllConfigs(s, context, problem);
+        return {all_configs.begin(), all_configs.end()};
+    }
+
+    auto& index    = TuningSpaceIndex::Instance();
+    const auto key = s.SolverDbId() + ':' + context.GetStream().GetDbBasename() + ':' +
+                     DbRecord{DbKinds::PerfDb, problem}.GetKey() + ':' +
+                     HashTuningSpace<PerformanceConfig>(problem);
+    const auto concurrent = s.IsTuningSpaceThreadSafe();
+
+    auto spare   = false;
+    auto configs = std::optional<std::vector<PerformanceConfig>>{};
+
+    if(const auto mask = index.Find(key))
+    {
+        spare   = mask->spare;
+        configs = GetTuningSpaceConfigs<PerformanceConfig>(*mask, problem);
+        if(!configs)
+            MIOPEN_LOG_W(s.SolverDbId() << ": Tuning space index is outdated, rebuilding");
+    }
+
+    if(!configs)
+    {
+        auto mask = ComputeTuningSpaceMask<PerformanceConfig>(context, problem, false, concurrent);
+        if(mask.Count() == 0)
+            mask = ComputeTuningSpaceMask<PerformanceConfig>(context, problem, true, concurrent);
+        spare   = mask.spare;
+        configs = GetTuningSpaceConfigs<PerformanceConfig>(mask, problem);
+        index.Store(key, std::move(mask));
+    }
+
+    MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << configs->size()
+                                << (spare ? " (spare)" : "") << "...");
+    return std::move(*configs);
+}
+
 template <class Solver, class Context, class Problem>
 std::vector<ConvSolution>
 GetAllSolutions(const Solver s, const Context& context_, const Problem& problem)
@@ -291,7 +450,7 @@ GetAllSolutions(const Solver s, const Context& context_, const Problem& problem)
     auto context                  = context_;
     context.is_for_generic_search = true;
 
-    auto all_configs = GetAllConfigs(s, context, problem);
+    const auto all_configs = GetValidConfigs(s, context, problem);
 
     std::vector<ConvSolution> solutions;
     for(const auto& current_config : all_configs)
@@ -302,6 +461,69 @@ GetAllSolutions(const Solver s, const Context& context_, const Problem& problem)
     return solutions;
 }
 
+/// Problems providing "static double PerfDbKeyDistance(std::string_view, std::string_view)" may
+/// seed the search from the configs tuned for nearby problems.
+template <class Problem, class = void>
+struct HasPerfDbKeyDistance : std::false_type
+{
+};
+
+template <class Problem>
+struct HasPerfDbKeyDistance<
+    Problem,
+    std::void_t<decltype(Problem::PerfDbKeyDistance(std::string_view{}, std::string_view{}))>>
+    : std::true_type
+{
+};
+
+/// Moves the configs tuned for the nearest problems in the PerfDb to the front, followed by their
+/// neighbourhood in the tuning space, so these are measured before the randomly ordered rest.
+template <class Solver, class Context, class Problem, class PerformanceConfig>
+void SeedFromTunedNeighbours(const Solver& s,
+                             const Context& context,
+                             const Problem& problem,
+                             std::vector<PerformanceConfig>& configs)
+{
+    const auto k = env::value(MIOPEN_TUNING_TRANSFER_NEIGHBOURS);
+    if(k == 0 || configs.empty())
+        return;
+
+    std::vector<std::string> seeds;
+    if constexpr(HasPerfDbKeyDistance<Problem>{})
+    {
+        const auto key      = DbRecord{DbKinds::PerfDb, problem}.GetKey();
+        const auto distance = [&](std::string_view other) {
+            return Problem::PerfDbKeyDistance(key, other);
+        };
+        seeds = FindTunedNeighbours(context, distance, s.SolverDbId(), k);
+    }
+    else
+    {
+        std::ignore = context;
+        std::ignore = problem;
+    }
+    if(seeds.empty())
+        return;
+
+    std::vector<std::string> texts;
+    texts.reserve(configs.size());
+    for(const auto& config : configs)
+    {
+        std::ostringstream ss;
+        config.Serialize(ss);
+        texts.push_back(ss.str());
+    }
+
+    std::vector<PerformanceConfig> seeded;
+    seeded.reserve(configs.size());
+    for(const auto i : SeedOrder(texts, seeds))
+        seeded.push_back(std::move(configs[i]));
+    configs = std::move(seeded);
+
+    MIOPEN_LOG_I(s.SolverDbId() << ": Seeding the search with configs of " << seeds.size()
+                                << " tuned neighbours");
+}
+
 std::size_t GetTuningIterationsMax();
 std::chrono::milliseconds GetTuningTimeMax(); // returns the max allowed time in milliseconds
 std::size_t GetTuningThreadsMax();
@@ -320,6 +542,8 @@ void CompileAgent(size_t thread_index,
     const auto data_size   = data.size();
     const auto time_budget = GetTuningTimeMax();
     const auto& profile_h  = context.GetStream();
+    // Nothing is built for a replayed search.
+    const auto replay = dynamic_cast<const TuningReplayHandle*>(&profile_h) != nullptr;
     // start the counter
     for(auto idx = thread_index; idx < data_size; idx += total_threads)
     {
@@ -337,7 +561,7 @@ void CompileAgent(size_t thread_index,
         ConvSolution current_solution = s.GetSolution(context, problem, current_config);
         for(const auto& kernel : current_solution.construction_params)
         {
-            if(profile_h.HasProgram(kernel.kernel_file, kernel.comp_options))
+            if(replay || profile_h.HasProgram(kernel.kernel_file, kernel.comp_options))
                 continue;
             std::ignore = profile_h.LoadProgram(kernel.kernel_file, kernel.comp_options, "");
         }
@@ -370,15 +594,20 @@ auto GenericSearch(const Solver s,
 
     auto& profile_h = context.GetStream();
     const AutoEnableProfiling enableProfiling{profile_h};
-
-    auto tmp_all_configs = GetAllConfigs(s, context, problem);
-    // For random access
-    std::vector<PerformanceConfig> all_configs;
-    std::copy(tmp_all_configs.begin(), tmp_all_configs.end(), std::back_inserter(all_configs));
-    // shuffle the configs
+    auto measurement =
+        TuningMeasurement{profile_h, "search", DbRecord{DbKinds::PerfDb, problem}.GetKey()};
+    const auto serialize = [](const PerformanceConfig& config) {
+        std::ostringstream ss;
+        config.Serialize(ss);
+        return ss.str();
+    };
+
+    auto all_configs = GetValidConfigs(s, context, problem);
+    // shuffle the configs, in the same order on every replay
     std::random_device rd{};
-    auto rng = std::default_random_engine{rd()};
+    auto rng = std::default_random_engine{measurement.IsReplay() ? 0 : rd()};
     std::shuffle(all_configs.begin(), all_configs.end(), rng);
+    SeedFromTunedNeighbours(s, context, problem, all_configs);
     std::size_t n_runs_total = std::min(all_configs.size(), GetTuningIterationsMax());
     all_configs.resize(n_runs_total);
     std::size_t patience = env::value(MIOPEN_TUNING_PATIENCE);
@@ -479,10 +708,10 @@ auto GenericSearch(const Solver s,
                                      << " != " << current_solution.workspace_sz);
                 }
 
-                invoker = profile_h.PrepareInvoker(*current_solution.invoker_factory,
-                                                   current_solution.construction_params);
-                invoker(profile_h, invoke_ctx);
-                elapsed_time = profile_h.GetKernelTime();
+                measurement.Select(s.SolverDbId(), serialize(current_config));
+                invoker = measurement.Prepare(*current_solution.invoker_factory,
+                                              current_solution.construction_params);
+                elapsed_time = measurement.Run(invoker, invoke_ctx);
             }
             catch(const std::exception& e)
             {
@@ -515,10 +744,7 @@ auto GenericSearch(const Solver s,
                     try
                     {
                         for(int i = 1; i < N_RUNS; ++i)
-                        {
-                            invoker(profile_h, invoke_ctx);
-                            elapsed_time += profile_h.GetKernelTime();
-                        }
+                            elapsed_time += measurement.Run(invoker, invoke_ctx);
                     }
                     catch(...)
                     {
@@ -586,10 +812,11 @@ auto GenericSearch(const Solver s,
         MIOPEN_THROW("Search failed");
     // Run once with the default config and show score.
 
-    const auto& invoker = profile_h.PrepareInvoker(*default_solution.invoker_factory,
-                                                   default_solution.construction_params);
-    invoker(profile_h, invoke_ctx);
-    const auto default_time = profile_h.GetKernelTime();
+    measurement.Select(s.SolverDbId(),
+                       serialize(s.GetDefaultPerformanceConfig(context, problem)));
+    const auto invoker      = measurement.Prepare(*default_solution.invoker_factory,
+                                             default_solution.construction_params);
+    const auto default_time = measurement.Run(invoker, invoke_ctx);
     const auto score        = (best_time > 0.0f) ? default_time / best_time : 0.0f;
     MIOPEN_LOG_W("...Score: " << score << " (default time " << default_time << ')');
 
@@ -46,3 +46,6 @@ MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_COMPILE_PARALLEL_LEVEL,
                               std::thread::hardware_concurrency() / 2)
 #endif
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_COMPILE_ONLY)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_TUNING_SPACE_INDEX)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_TRANSFER_NEIGHBOURS,
+                              4) // Number of tuned problems to seed the search from, 0 disables
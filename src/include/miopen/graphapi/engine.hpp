@@ -33,6 +33,7 @@
 
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace miopen {
 
@@ -76,6 +77,17 @@ struct TensorInfo
 // int64_t is the graph tensor id
 using TensorInfoMap = std::unordered_map<int64_t, TensorInfo>;
 
+/// Memory an executor keeps a virtual tensor in. The buffer is live from
+/// firstStep to lastStep of the executor's own schedule, buffers whose steps
+/// do not overlap may share memory.
+struct VirtualTensorBuffer
+{
+    int64_t tensorId;
+    size_t size;
+    size_t firstStep;
+    size_t lastStep;
+};
+
 class MIOPEN_INTERNALS_EXPORT GraphPatternExecutor
 {
 
@@ -83,6 +95,17 @@ public:
     virtual void execute(miopenHandle_t handle, const VariantPack& vpk) = 0;
     virtual size_t getWorkspaceSize() const                             = 0;
     virtual ~GraphPatternExecutor();
+
+    /// Executors that keep virtual tensors of the graph in memory return true.
+    /// The ExecutionPlan then places the buffers returned by
+    /// getVirtualTensorBuffers() in its workspace, see MemoryPlan, and binds
+    /// them in the VariantPack given to execute(). getWorkspaceSize() only
+    /// covers the scratch memory on top of them.
+    virtual bool needsVirtualTensorBuffers() const { return false; }
+
+    /// Every virtual tensor of the graph by default, live from the node
+    /// producing it to the last node consuming it
+    virtual std::vector<VirtualTensorBuffer> getVirtualTensorBuffers(const OpGraph& graph) const;
 };
 
 // generic executor that uses Find 2.0 Solution
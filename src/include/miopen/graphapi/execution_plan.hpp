@@ -27,6 +27,7 @@
 #pragma once
 
 #include <miopen/graphapi/enginecfg.hpp>
+#include <miopen/graphapi/memory_planner.hpp>
 #include <miopen/graphapi/variant_pack.hpp>
 
 #include <cstdint>
@@ -47,9 +48,12 @@ private:
     EngineCfg mEngineCfg;
     miopenHandle_t mHandle = nullptr;
     std::vector<int64_t> mIntermediateIds;
+    MemoryPlan mMemoryPlan;
 
     friend class ExecutionPlanBuilder;
 
+    void initMemoryPlan();
+
 public:
     ExecutionPlan()                     = default;
     ExecutionPlan(const ExecutionPlan&) = default;
@@ -61,17 +65,35 @@ public:
     const EngineCfg& getEngineCfg() const noexcept { return mEngineCfg; }
     EngineCfg& getEngineCfg() noexcept { return mEngineCfg; }
     const std::vector<int64_t>& getIntermediateIds() const noexcept { return mIntermediateIds; }
+    const MemoryPlan& getMemoryPlan() const noexcept { return mMemoryPlan; }
     std::string getJsonRepresentation() const;
 
     void execute(miopenHandle_t handle, const VariantPack& variantPack)
     {
         checkPtr(handle);
-        mEngineCfg.getEngine().getExecutor()->execute(handle, variantPack);
+        auto* executor = mEngineCfg.getEngine().getExecutor();
+        if(mMemoryPlan.empty())
+        {
+            executor->execute(handle, variantPack);
+        }
+        else
+        {
+            executor->execute(handle, mMemoryPlan.bind(variantPack, getMemoryPlanOffset()));
+        }
     }
 
+    /// The executor's own workspace followed by the virtual tensors, if any
     size_t getWorkspaceSize() const
     {
-        return mEngineCfg.getEngine().getExecutor()->getWorkspaceSize();
+        return mMemoryPlan.empty() ? mEngineCfg.getEngine().getExecutor()->getWorkspaceSize()
+                                   : getMemoryPlanOffset() + mMemoryPlan.getSize();
+    }
+
+    size_t getMemoryPlanOffset() const
+    {
+        const auto alignment = mMemoryPlan.getAlignment();
+        const auto wsSize    = mEngineCfg.getEngine().getExecutor()->getWorkspaceSize();
+        return (wsSize + alignment - 1) / alignment * alignment;
     }
 };
 
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/variant_pack.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace miopen {
+
+namespace graphapi {
+
+/// Placement of the virtual tensors of an OpGraph inside one workspace buffer.
+///
+/// The nodes are put in a topological order and every virtual tensor lives from
+/// the step that produces it to the last step that consumes it. Tensors whose
+/// lifetimes do not overlap may share memory, so the buffers are assigned
+/// offsets by coloring the interval graph of lifetimes (greedy, largest tensor
+/// first), each block aligned to the plan alignment.
+class MIOPEN_INTERNALS_EXPORT MemoryPlan
+{
+public:
+    static constexpr size_t defaultAlignment = 256;
+
+    struct Block
+    {
+        int64_t tensorId;
+        size_t offset;
+        size_t size; // aligned
+        size_t firstStep;
+        size_t lastStep;
+    };
+
+private:
+    std::vector<Block> mBlocks;
+    size_t mSize      = 0;
+    size_t mNaiveSize = 0;
+    size_t mAlignment = defaultAlignment;
+
+public:
+    MemoryPlan() = default;
+
+    /// Plans every virtual tensor of the graph, see getVirtualTensorBuffers()
+    static MemoryPlan make(const OpGraph& graph, size_t alignment = defaultAlignment);
+
+    /// Plans the buffers an executor asked for, whose steps come from its own
+    /// schedule, see GraphPatternExecutor::getVirtualTensorBuffers()
+    static MemoryPlan make(const std::vector<VirtualTensorBuffer>& buffers,
+                           size_t alignment = defaultAlignment);
+
+    /// The virtual tensors of the graph with their lifetimes in terms of a
+    /// topological order of the nodes
+    static std::vector<VirtualTensorBuffer> getVirtualTensorBuffers(const OpGraph& graph);
+
+    bool empty() const noexcept { return mBlocks.empty(); }
+    const std::vector<Block>& getBlocks() const noexcept { return mBlocks; }
+    size_t getAlignment() const noexcept { return mAlignment; }
+
+    /// Peak memory of the plan, i.e. the workspace it needs
+    size_t getSize() const noexcept { return mSize; }
+
+    /// Memory needed if every virtual tensor got its own buffer
+    size_t getNaiveSize() const noexcept { return mNaiveSize; }
+
+    /// Throws if the tensor is not part of the plan
+    size_t getOffset(int64_t tensorId) const;
+
+    /// Returns a copy of vpk where every planned tensor points into the
+    /// workspace, starting baseOffset bytes into it. Throws if vpk already has
+    /// a pointer for a planned tensor.
+    VariantPack bind(const VariantPack& vpk, size_t baseOffset) const;
+};
+
+} // namespace graphapi
+
+} // namespace miopen
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/graphapi.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/variant_pack.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+namespace graphapi {
+
+/// Executes a DAG of OperationPointwise, OperationReduction and OperationReshape
+/// nodes as generated elementwise kernels. Virtual tensors stay in registers, so a
+/// chain like bias -> scale -> activation -> add touches HBM only for its
+/// non-virtual inputs and outputs.
+///
+/// A reduction result can only be consumed once the whole reduction is done, so
+/// its consumers run in the next kernel. Virtual tensors used across kernels,
+/// reduction results included, are kept in buffers requested from the
+/// ExecutionPlan, see needsVirtualTensorBuffers().
+///
+/// The kernel source is specialized for the graph (shapes, strides, data types and
+/// attributes are baked in) and is generated when the graph is finalized. It is
+/// compiled on the first execute() through Handle::AddKernel, so the binary goes
+/// through the regular LoadProgram path and lands in the kernel cache under a
+/// program name derived from the source hash. The source hash is also the network
+/// config the kernels are cached under in the handle, the k-th kernel at index k
+/// and the init kernel after them, so later executions only launch them.
+///
+/// Restrictions:
+///  - all tensors have the same rank; a dimension is either equal to the
+///    iteration space or is 1 (broadcast), see checkDimsWithPossibleBroadcasting();
+///  - tensors are fp32, fp16 or bf16, math is done in fp32;
+///  - a reshape must consume a non-virtual tensor (it is folded into the load);
+///  - a reduction must produce an fp32 tensor;
+///  - backward activations, ERF and GEN_INDEX modes are not supported.
+class PointwiseFusionExecutor : public GraphPatternExecutor
+{
+    std::vector<std::vector<Tensor*>> mArgTensors; // by kernel
+    std::vector<Tensor*> mInitArgTensors;
+    std::vector<VirtualTensorBuffer> mBuffers;
+    std::string mKernelSrc;
+    std::string mProgramName;
+    std::string mNetworkConfig;
+    size_t mElementCount     = 0;
+    size_t mInitElementCount = 0;
+
+public:
+    PointwiseFusionExecutor(std::vector<std::vector<Tensor*>>&& argTensors,
+                            std::vector<Tensor*>&& initArgTensors,
+                            std::vector<VirtualTensorBuffer>&& buffers,
+                            std::string&& kernelSrc,
+                            size_t elementCount,
+                            size_t initElementCount);
+
+    void execute(miopenHandle_t handle, const VariantPack& vpk) final;
+
+    size_t getWorkspaceSize() const final { return size_t{0}; }
+
+    bool needsVirtualTensorBuffers() const final { return !mBuffers.empty(); }
+
+    /// Steps of the schedule: 0 is the init kernel, k + 1 the k-th kernel
+    std::vector<VirtualTensorBuffer>
+    getVirtualTensorBuffers([[maybe_unused]] const OpGraph& graph) const final
+    {
+        return mBuffers;
+    }
+
+    const std::string& getKernelSource() const noexcept { return mKernelSrc; }
+    const std::string& getProgramName() const noexcept { return mProgramName; }
+    size_t getKernelCount() const noexcept { return mArgTensors.size(); }
+    const std::vector<Tensor*>& getArgTensors(size_t kernel = 0) const
+    {
+        return mArgTensors.at(kernel);
+    }
+    size_t getElementCount() const noexcept { return mElementCount; }
+    bool hasReductions() const noexcept { return !mInitArgTensors.empty(); }
+
+    /// Returns true if every node of the graph is supported, see the restrictions above.
+    /// The graph may still run as several kernels, see getKernelCount()
+    static bool isFusible(const OpGraph& graph);
+
+    /// Returns nullptr if the graph cannot be fused, see isFusible()
+    static std::unique_ptr<GraphPatternExecutor> make(const OpGraph& graph);
+};
+
+} // namespace graphapi
+
+} // namespace miopen
@@ -35,6 +35,8 @@
 #include <miopen/names.hpp>
 #include <miopen/object.hpp>
 #include <miopen/allocator.hpp>
+#include <miopen/buffer_pool.hpp>
+#include <miopen/check_numerics.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/stringutils.hpp>
@@ -179,6 +181,12 @@ public:
     void Copy(ConstData_t src, Data_t dest, std::size_t size) const;
 
     Allocator::ManageDataPtr Create(std::size_t sz) const;
+    /// Scratch buffer from the handle's BufferPool. Unlike Create() it does not
+    /// wait for the queue, so the buffer must only be used by work enqueued on
+    /// the current stream (or after a Finish()).
+    Allocator::ManageDataPtr CreateTemporary(std::size_t sz) const;
+    BufferPool& GetBufferPool() const;
+    CheckNumericsMonitor& GetNumericsMonitor() const;
     Allocator::ManageDataPtr&
     WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const;
     void ReadTo(void* data, const Allocator::ManageDataPtr& ddata, std::size_t sz) const;
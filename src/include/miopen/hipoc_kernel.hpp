@@ -35,6 +35,7 @@
 #include <array>
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 namespace miopen {
@@ -128,14 +129,16 @@ struct MIOPEN_INTERNALS_EXPORT HIPOCKernelInvoke
                       std::array<size_t, 3> pgdims,
                       std::string pname,
                       std::function<void(hipEvent_t, hipEvent_t)> pcallback,
-                      bool pcoop_launch)
+                      bool pcoop_launch,
+                      std::shared_ptr<const void> pmodule_pin = nullptr)
         : stream(pstream),
           fun(pfun),
           ldims(pldims),
           gdims(pgdims),
           name(pname),
           callback(pcallback),
-          coop_launch(pcoop_launch)
+          coop_launch(pcoop_launch),
+          module_pin(std::move(pmodule_pin))
     {
     }
 
@@ -195,6 +198,8 @@ private:
     std::string name;
     std::function<void(hipEvent_t, hipEvent_t)> callback;
     bool coop_launch;
+    /// Keeps the module of a lazy program, and thus fun, valid as long as the invoker exists.
+    std::shared_ptr<const void> module_pin;
 };
 
 struct MIOPEN_INTERNALS_EXPORT HIPOCKernel
@@ -222,7 +227,10 @@ struct MIOPEN_INTERNALS_EXPORT HIPOCKernel
         std::copy(global_dims.begin(), global_dims.end(), gdims.begin());
 
         kernel_module = name;
-        auto status   = hipModuleGetFunction(&fun, program.GetModule(), kernel_module.c_str());
+        // Functions of lazy programs are looked up on launch, as the module may be unloaded.
+        if(program.IsLazy())
+            return;
+        auto status = hipModuleGetFunction(&fun, program.GetModule(), kernel_module.c_str());
         if(hipSuccess != status)
         {
             MIOPEN_THROW_HIP_STATUS(status,
@@ -31,6 +31,7 @@
 #include <miopen/hipoc_program_impl.hpp>
 #include <miopen/filesystem.hpp>
 #include <hip/hip_runtime_api.h>
+#include <memory>
 #include <string>
 
 namespace miopen {
@@ -52,8 +53,22 @@ struct HIPOCProgram
     HIPOCProgram(const fs::path& program_name, const fs::path& hsaco);
     HIPOCProgram(const fs::path& program_name, const std::vector<char>& hsaco);
     HIPOCProgram(const fs::path& program_name, const std::vector<uint8_t>& hsaco);
+    /// Loads the module from a code object that only has to outlive this call. The code object is
+    /// not kept, so the program can not be serialized again.
+    static HIPOCProgram
+    FromImage(const fs::path& program_name, const void* image, std::size_t size);
+    /// Lazy program: the module is loaded on first use and is subject to eviction by
+    /// ModuleLru, so kernels have to look their functions up with GetFunction() on launch.
+    static HIPOCProgram Lazy(const fs::path& program_name, const fs::path& hsaco);
+    static HIPOCProgram Lazy(const fs::path& program_name, std::vector<char> hsaco);
     std::shared_ptr<HIPOCProgramImpl> impl;
     hipModule_t GetModule() const;
+    bool IsLazy() const;
+    /// Keeps the module of a lazy program resident until the returned token is released.
+    /// Returns nullptr for other programs, which keep their module for their whole lifetime.
+    std::shared_ptr<const void> PinModule() const;
+    /// \return The kernel function, loading the module of a lazy program if needed.
+    hipFunction_t GetFunction(const std::string& name) const;
     /// \return Pathname of CO file, if it resides on the filesystem.
     /// This function should not be called after FreeCodeObjectFileStorage().
     fs::path GetCodeObjectPathname() const;
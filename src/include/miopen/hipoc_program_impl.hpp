@@ -34,7 +34,9 @@
 #include <boost/optional.hpp>
 #include <hip/hip_runtime_api.h>
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace miopen {
@@ -49,17 +51,36 @@ struct HIPOCProgramImpl
 
     HIPOCProgramImpl(const fs::path& program_name, const std::vector<uint8_t>& blob);
 
+    /// Creates the module straight from a code object owned by the caller, without a copy.
+    HIPOCProgramImpl(const fs::path& program_name, const void* image, std::size_t size);
+
     HIPOCProgramImpl(const fs::path& program_name,
                      std::string params,
                      const TargetProperties& target_,
                      const std::string& kernel_src);
 
+    /// Lazy ctors keep the code object and only load the module on first use.
+    HIPOCProgramImpl(const fs::path& program_name, const fs::path& filespec, bool lazy_);
+    HIPOCProgramImpl(const fs::path& program_name, std::vector<char> blob, bool lazy_);
+
+    ~HIPOCProgramImpl();
+
     fs::path program;
     TargetProperties target;
     fs::path hsaco_file;
     hipModulePtr module;
     boost::optional<TmpDir> dir;
     std::vector<char> binary;
+    /// Module is loaded on demand and may be unloaded by ModuleLru.
+    bool lazy = false;
+    std::mutex module_mutex;
+    std::unordered_map<std::string, hipFunction_t> functions;
+
+    /// Loads the module of a lazy program if it is not resident.
+    /// \return true if the module has been loaded by this call.
+    bool LoadModule();
+    void UnloadModule();
+    hipFunction_t GetFunction(const std::string& name);
 
 #if !MIOPEN_USE_COMGR
     void BuildCodeObjectInFile(std::string& params, std::string_view src, const fs::path& filename);
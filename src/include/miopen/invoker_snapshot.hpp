@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_INVOKER_SNAPSHOT_HPP
+#define GUARD_MIOPEN_INVOKER_SNAPSHOT_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/solution.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_INVOKER_SNAPSHOT)
+
+namespace miopen {
+
+struct Handle;
+
+namespace conv {
+struct ProblemDescription;
+} // namespace conv
+
+namespace solver {
+struct KernelInfo;
+} // namespace solver
+
+/// Working set of the process: the convolution invokers prepared so far, each kept as a solution
+/// with its code objects attached. Recording is enabled by MIOPEN_INVOKER_SNAPSHOT.
+///
+/// The snapshot file is a single msgpack document holding all the solutions prepared on one kind
+/// of device. Loading it registers every invoker with the handle at once, so later calls neither
+/// search the kernel cache nor compile.
+class MIOPEN_INTERNALS_EXPORT InvokerSnapshot
+{
+public:
+    static InvokerSnapshot& Instance();
+
+    void Record(const Handle& handle,
+                const conv::ProblemDescription& problem,
+                solver::Id solver_id,
+                const std::string& perf_cfg,
+                const std::vector<Program>& programs,
+                const std::vector<solver::KernelInfo>& kernels);
+
+    /// Writes the solutions recorded for the device of the handle. Returns their number.
+    std::size_t Save(const Handle& handle, const fs::path& file) const;
+    /// Prepares and registers the invokers stored in the file. Returns their number.
+    static std::size_t Load(Handle& handle, const fs::path& file);
+
+private:
+    mutable std::mutex mutex;
+    // device -> network config and solver id -> solution
+    std::map<std::string, std::map<std::string, Solution>> solutions;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_INVOKER_SNAPSHOT_HPP
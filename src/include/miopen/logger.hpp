@@ -31,7 +31,9 @@
 #include <vector>
 #include <iostream>
 #include <sstream>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <chrono>
 
 #include <miopen/each_args.hpp>
@@ -222,6 +224,29 @@ MIOPEN_INTERNALS_EXPORT std::string LoggingLevelToCustomString(LoggingLevel leve
 MIOPEN_INTERNALS_EXPORT const char* LoggingLevelToCString(LoggingLevel level);
 MIOPEN_INTERNALS_EXPORT std::string LoggingPrefix();
 
+/// Prints a log message, or adds it to the LogBuffer of the current thread if there is one.
+MIOPEN_INTERNALS_EXPORT void LogWrite(const std::string& message);
+
+/// Collects the log messages of the current thread while alive, so that the messages of
+/// concurrent tasks can be printed in a deterministic order. Messages not taken are printed
+/// on destruction.
+class MIOPEN_INTERNALS_EXPORT LogBuffer
+{
+public:
+    LogBuffer();
+    ~LogBuffer();
+    LogBuffer(const LogBuffer&) = delete;
+    LogBuffer& operator=(const LogBuffer&) = delete;
+
+    std::string Take() { return std::exchange(text, {}); }
+
+private:
+    friend void LogWrite(const std::string& message);
+
+    LogBuffer* previous;
+    std::string text;
+};
+
 /// \return true if level is enabled.
 /// \param level - one of the values defined in LoggingLevel.
 MIOPEN_INTERNALS_EXPORT bool IsLogging(LoggingLevel level, bool disableQuieting = false);
@@ -372,7 +397,7 @@ constexpr std::string_view LoggingParseFunction(const std::string_view func,
             std::ostringstream miopen_log_ss;                                               \
             miopen_log_ss << miopen::LoggingPrefix() << category << " [" << fn_name << "] " \
                           << __VA_ARGS__ << std::endl;                                      \
-            std::cerr << miopen_log_ss.str();                                               \
+            miopen::LogWrite(miopen_log_ss.str());                                          \
         }                                                                                   \
     } while(false)
 
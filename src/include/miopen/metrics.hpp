@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_METRICS_HPP_
+#define GUARD_MIOPEN_METRICS_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/logger.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace miopen {
+namespace metrics {
+
+/// Registry of process-wide counters and latency histograms, readable through
+/// miopenGetMetricCounter() and miopenGetMetricLatency(), and written as JSON at exit when
+/// MIOPEN_METRICS_FILE is set.
+///
+/// Metrics are looked up by name once per probe site and then updated with relaxed atomics.
+
+class MIOPEN_INTERNALS_EXPORT Counter
+{
+public:
+    void Add(std::uint64_t value = 1) { count.fetch_add(value, std::memory_order_relaxed); }
+    std::uint64_t Get() const { return count.load(std::memory_order_relaxed); }
+    void Reset() { count.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> count{0};
+};
+
+/// Log-linear histogram of nanosecond values in the spirit of HdrHistogram: values below 16 have
+/// their own buckets, larger ones fall into 8 buckets per power of two, which bounds the
+/// relative error to 12.5%.
+class MIOPEN_INTERNALS_EXPORT Histogram
+{
+public:
+    static constexpr std::size_t sub_buckets = 8;
+    static constexpr std::size_t linear      = 2 * sub_buckets;
+    static constexpr std::size_t bucket_num  = linear + (64 - 4) * sub_buckets;
+
+    void Record(std::uint64_t ns);
+
+    std::uint64_t Count() const { return count.load(std::memory_order_relaxed); }
+    std::uint64_t Sum() const { return sum.load(std::memory_order_relaxed); }
+    std::uint64_t Min() const;
+    std::uint64_t Max() const { return max.load(std::memory_order_relaxed); }
+    /// \return The value at the percentile in [0, 100], 0 if there are no values.
+    std::uint64_t Percentile(double percentile) const;
+    void Reset();
+
+    static std::size_t BucketOf(std::uint64_t ns);
+    /// \return The smallest value falling into the bucket.
+    static std::uint64_t LowerBound(std::size_t bucket);
+
+private:
+    std::array<std::atomic<std::uint64_t>, bucket_num> buckets{};
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> min{UINT64_MAX};
+    std::atomic<std::uint64_t> max{0};
+};
+
+/// The returned references stay valid for the lifetime of the process.
+MIOPEN_INTERNALS_EXPORT Counter& GetCounter(const std::string& name);
+MIOPEN_INTERNALS_EXPORT Histogram& GetHistogram(const std::string& name);
+
+/// \return Null if no metric with the name has been created.
+MIOPEN_INTERNALS_EXPORT const Counter* FindCounter(const std::string& name);
+MIOPEN_INTERNALS_EXPORT const Histogram* FindHistogram(const std::string& name);
+
+/// Counts a find-db or perf-db lookup as "<db>.hits" or "<db>.misses".
+MIOPEN_INTERNALS_EXPORT void CountDbLookup(DbKinds kind, bool hit);
+
+MIOPEN_INTERNALS_EXPORT void Dump(std::ostream& stream);
+MIOPEN_INTERNALS_EXPORT void Dump(const fs::path& file);
+MIOPEN_INTERNALS_EXPORT void Reset();
+
+/// Records the time between its construction and destruction into a histogram.
+class LatencyScope
+{
+public:
+    explicit LatencyScope(Histogram& histogram_)
+        : histogram(histogram_), start(std::chrono::steady_clock::now())
+    {
+    }
+
+    LatencyScope(const LatencyScope&) = delete;
+    LatencyScope& operator=(const LatencyScope&) = delete;
+
+    ~LatencyScope()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        histogram.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    Histogram& histogram;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace metrics
+} // namespace miopen
+
+#define MIOPEN_METRICS_COUNT(name)                                 \
+    do                                                             \
+    {                                                              \
+        static auto& miopen_metrics_counter =                      \
+            miopen::metrics::GetCounter(name); /* NOLINT */        \
+        miopen_metrics_counter.Add();                              \
+    } while(false)
+
+/// Records the latency of the enclosing scope under the given name.
+#define MIOPEN_METRICS_LATENCY_OF(name)                                                   \
+    static auto& MIOPEN_PP_CAT(miopen_metrics_histogram_, __LINE__) =                     \
+        miopen::metrics::GetHistogram(name);                                              \
+    const miopen::metrics::LatencyScope MIOPEN_PP_CAT(miopen_metrics_latency_, __LINE__)( \
+        MIOPEN_PP_CAT(miopen_metrics_histogram_, __LINE__))
+
+/// Records the latency of the enclosing API function under its name.
+#define MIOPEN_METRICS_LATENCY() MIOPEN_METRICS_LATENCY_OF(__func__)
+
+#endif // GUARD_MIOPEN_METRICS_HPP_
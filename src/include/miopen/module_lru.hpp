@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_MODULE_LRU_HPP
+#define GUARD_MIOPEN_MODULE_LRU_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/env.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_LAZY_MODULE_BUDGET) // 0 means no limit
+
+namespace miopen {
+
+/// Tracks the resident modules of lazily loaded programs in the order of their last use and
+/// unloads the least recently used ones once there are more of them than the budget allows.
+///
+/// The unload callbacks are invoked without the internal lock held, so they may take locks
+/// of their own. Modules are pinned while a kernel invoker of theirs is alive and are never
+/// evicted then, so the number of resident modules may exceed the budget for a while.
+class MIOPEN_INTERNALS_EXPORT ModuleLru
+{
+public:
+    using Unloader = std::function<void()>;
+
+    /// \param budget_ maximum number of resident modules, 0 means no limit.
+    explicit ModuleLru(std::size_t budget_) : budget(budget_) {}
+
+    /// The process-wide instance, its budget is taken from MIOPEN_LAZY_MODULE_BUDGET.
+    static ModuleLru& Instance();
+
+    /// Marks the module identified by key as the most recently used one. A module not yet
+    /// known is registered together with the callback that unloads it. Evicts the least
+    /// recently used modules when the budget is exceeded; key itself is never evicted.
+    void Touch(const void* key, Unloader unload);
+    /// Touch() that also keeps the module resident until the matching Unpin().
+    /// Pins are counted, a module is pinned as long as any of them is held.
+    void Pin(const void* key, Unloader unload);
+    /// Releases a pin and evicts the modules that exceed the budget and are no longer pinned.
+    void Unpin(const void* key);
+    /// Stops tracking the module without unloading it, e.g. when its owner is destroyed.
+    void Forget(const void* key);
+
+    std::size_t Size() const;
+    std::size_t GetBudget() const { return budget; }
+
+private:
+    struct Entry
+    {
+        const void* key;
+        Unloader unload;
+        std::size_t pins = 0;
+    };
+
+    std::list<Entry>::iterator TouchUnsafe(const void* key, Unloader& unload);
+    /// Moves the unloaders of the evicted modules to the output, except the one of keep.
+    void EvictUnsafe(const void* keep, std::vector<Unloader>& evicted);
+    void Unload(std::vector<Unloader>& evicted) const;
+
+    std::size_t budget;
+    mutable std::mutex mutex;
+    std::list<Entry> order; // Most recently used first
+    std::unordered_map<const void*, std::list<Entry>::iterator> index;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_MODULE_LRU_HPP
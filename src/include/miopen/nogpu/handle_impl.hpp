@@ -61,9 +61,11 @@ struct HandleImpl
     std::size_t warp_size          = 64;
     std::size_t max_mem_alloc_size = 0;
     Allocator allocator{};
+    BufferPool buffer_pool;
     KernelCache cache;
     std::int64_t ctx;
     TargetProperties target_properties;
+    CheckNumericsMonitor numerics_monitor;
 };
 } // namespace miopen
 #endif // GUARD_MIOPEN_NOGPU_HANDLE_IMPL_HPP_
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_PACKED_VALUES_HPP
+#define GUARD_MIOPEN_PACKED_VALUES_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+/// Packed VALUES are the binary counterpart of the comma-separated perf-db VALUES.
+///
+/// A packed string starts with the marker, followed by varints: the schema version,
+/// the number of fields and the fields themselves, zigzag-encoded. Each varint digit carries
+/// 5 bits and a continuation bit, and is written as one character of a 64-character alphabet,
+/// so packed VALUES never contain the separators of the text db format. Schema version 0
+/// denotes VALUES written by early conversion tools, which are only accepted by the tools.
+///
+/// This header only depends on the standard library, so that tools can use it standalone.
+
+namespace miopen {
+namespace solver {
+namespace serialize {
+
+constexpr char packed_marker = '~';
+
+/// Schema version of configs which never changed the meaning of their fields.
+constexpr unsigned default_schema_version = 1;
+
+namespace detail {
+
+constexpr std::string_view packed_digits =
+    "0123456789ABCDEFGHIJKLMNOPQRSTUVabcdefghijklmnopqrstuvwxyz-_WXYZ";
+
+constexpr std::array<std::int8_t, 128> MakePackedDigitValues()
+{
+    auto values = std::array<std::int8_t, 128>{};
+    for(auto& value : values)
+        value = -1;
+    for(std::size_t i = 0; i < packed_digits.size(); ++i)
+        values[static_cast<unsigned char>(packed_digits[i])] = static_cast<std::int8_t>(i);
+    return values;
+}
+
+constexpr auto packed_digit_values = MakePackedDigitValues();
+
+} // namespace detail
+
+/// Whether T reads packed VALUES in its Deserialize() and can write them.
+template <class T, class = void>
+struct SupportsPacked : std::false_type
+{
+};
+
+template <class T>
+struct SupportsPacked<
+    T,
+    std::void_t<decltype(std::declval<const T&>().SerializePacked(std::declval<std::string&>()))>>
+    : std::true_type
+{
+};
+
+inline bool IsPacked(std::string_view values)
+{
+    return !values.empty() && values.front() == packed_marker;
+}
+
+class PackedWriter
+{
+public:
+    explicit PackedWriter(std::string& out_) : out(out_) { out.push_back(packed_marker); }
+
+    void Put(std::uint64_t value)
+    {
+        while(value >= 32)
+        {
+            out.push_back(detail::packed_digits[32 | (value & 31)]);
+            value >>= 5;
+        }
+        out.push_back(detail::packed_digits[value]);
+    }
+
+    void PutSigned(std::int64_t value)
+    {
+        Put((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+private:
+    std::string& out;
+};
+
+class PackedReader
+{
+public:
+    explicit PackedReader(std::string_view in_) : in(in_), pos(IsPacked(in_) ? 1 : in_.size()) {}
+
+    bool Get(std::uint64_t& value)
+    {
+        value          = 0;
+        unsigned shift = 0;
+        while(pos < in.size() && shift < 64)
+        {
+            const auto c = static_cast<unsigned char>(in[pos++]);
+            if(c >= detail::packed_digit_values.size() || detail::packed_digit_values[c] < 0)
+                return false;
+            const auto digit = static_cast<std::uint64_t>(detail::packed_digit_values[c]);
+            value |= (digit & 31) << shift;
+            if((digit & 32) == 0)
+                return true;
+            shift += 5;
+        }
+        return false;
+    }
+
+    bool GetSigned(std::int64_t& value)
+    {
+        auto raw = std::uint64_t{};
+        if(!Get(raw))
+            return false;
+        value = static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+        return true;
+    }
+
+    bool AtEnd() const { return pos == in.size(); }
+
+private:
+    std::string_view in;
+    std::size_t pos;
+};
+
+/// Reads the schema version of packed VALUES.
+inline bool GetSchemaVersion(std::string_view packed, std::uint64_t& version)
+{
+    auto reader = PackedReader{packed};
+    return IsPacked(packed) && reader.Get(version);
+}
+
+/// Converts text VALUES to packed ones with the given schema version. Fails, leaving the result
+/// untouched, unless every field is an integer in its canonical form, so the conversion
+/// can always be reverted exactly.
+inline bool PackText(std::string_view text,
+                     std::string& packed,
+                     char separator         = ',',
+                     std::uint64_t version = default_schema_version)
+{
+    const auto count =
+        text.empty() ? 0 : std::count(text.begin(), text.end(), separator) + std::size_t{1};
+
+    auto result = std::string{};
+    auto writer = PackedWriter{result};
+    writer.Put(version);
+    writer.Put(count);
+
+    for(std::size_t begin = 0, i = 0; i < count; ++i)
+    {
+        auto end = text.find(separator, begin);
+        if(end == std::string_view::npos)
+            end = text.size();
+
+        const auto field = text.substr(begin, end - begin);
+        auto value       = std::int64_t{0};
+        const auto res   = std::from_chars(field.data(), field.data() + field.size(), value);
+        if(res.ec != std::errc{} || res.ptr != field.data() + field.size() ||
+           std::to_string(value) != field)
+            return false;
+
+        writer.PutSigned(value);
+        begin = end + 1;
+    }
+
+    packed = std::move(result);
+    return true;
+}
+
+/// Converts packed VALUES of any schema version back to text.
+inline bool UnpackToText(std::string_view packed, std::string& text, char separator = ',')
+{
+    auto reader  = PackedReader{packed};
+    auto version = std::uint64_t{};
+    auto count   = std::uint64_t{};
+    auto result  = std::string{};
+
+    if(!IsPacked(packed) || !reader.Get(version) || !reader.Get(count))
+        return false;
+
+    for(std::uint64_t i = 0; i < count; ++i)
+    {
+        auto value = std::int64_t{};
+        if(!reader.GetSigned(value))
+            return false;
+        if(i != 0)
+            result.push_back(separator);
+        result += std::to_string(value);
+    }
+
+    if(!reader.AtEnd())
+        return false;
+    text = std::move(result);
+    return true;
+}
+
+} // namespace serialize
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PACKED_VALUES_HPP
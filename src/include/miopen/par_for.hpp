@@ -27,13 +27,9 @@
 #ifndef MIOPEN_GUARD_MLOPEN_PAR_FOR_HPP
 #define MIOPEN_GUARD_MLOPEN_PAR_FOR_HPP
 
-#include <algorithm>
-#include <cassert>
-#include <cmath>
-#include <functional>
-#include <numeric>
-#include <vector>
+#include <miopen/thread_pool.hpp>
 
+#include <algorithm>
 #include <thread>
 
 namespace miopen {
@@ -55,24 +51,9 @@ struct joinable_thread : std::thread
     }
 };
 
-struct thread_factory
-{
-    template <class F>
-    joinable_thread operator()(std::size_t& work, std::size_t n, std::size_t grainsize, F f) const
-    {
-        auto result = joinable_thread([=] {
-            std::size_t start = work;
-            std::size_t last  = std::min(n, work + grainsize);
-            for(std::size_t i = start; i < last; i++)
-            {
-                f(i);
-            }
-        });
-        work += grainsize;
-        return result;
-    }
-};
-
+/// Runs f(i) for i in [0, n) on at most threadsize threads. The indices are handed out in ranges
+/// of several per thread, so items of uneven cost balance out. The loops run on the shared
+/// ThreadPool, so no threads are started per call.
 template <class F>
 void par_for_impl(std::size_t n, std::size_t threadsize, F f)
 {
@@ -80,18 +61,15 @@ void par_for_impl(std::size_t n, std::size_t threadsize, F f)
     {
         for(std::size_t i = 0; i < n; i++)
             f(i);
+        return;
     }
-    else
-    {
-        std::vector<joinable_thread> threads(threadsize);
-        const std::size_t grainsize = std::ceil(static_cast<double>(n) / threads.size());
-
-        std::size_t work = 0;
-        std::generate(threads.begin(),
-                      threads.end(),
-                      std::bind(thread_factory{}, std::ref(work), n, grainsize, f));
-        assert(work >= n);
-    }
+
+    const auto grainsize = std::max<std::size_t>(n / (threadsize * 8), 1);
+    ThreadPool::Global().ParallelFor(
+        n, grainsize, threadsize, [&](std::size_t first, std::size_t last) {
+            for(std::size_t i = first; i < last; i++)
+                f(i);
+        });
 }
 
 template <class F>
@@ -67,6 +67,11 @@ struct PerfConfigBase : PerfConfig
     {
         return serialize::SerDes<>::Deserialize(static_cast<Derived&>(*this), s);
     }
+
+    bool SerializePacked(std::string& s) const
+    {
+        return serialize::SerDes<>::SerializePacked(static_cast<const Derived&>(*this), s);
+    }
 };
 
 template <class Derived>
@@ -31,6 +31,7 @@
 #include <boost/optional.hpp>
 
 #include <chrono>
+#include <functional>
 #include <map>
 #include <string>
 #include <sstream>
@@ -94,6 +95,10 @@ public:
         return record->GetValues(id, value);
     }
 
+    /// Calls the visitor with the key and the contents of each record.
+    void VisitRecords(
+        const std::function<void(const std::string& key, const std::string& contents)>& visitor);
+
     bool StoreRecord(const DbRecord& record);
     bool UpdateRecord(DbRecord& record);
     bool RemoveRecord(const std::string& key);
@@ -118,7 +123,7 @@ public:
     Update(const T& problem_config, const std::string& id, const V& values)
     {
         DbRecord record(db_kind, problem_config);
-        record.SetValues(id, values);
+        record.SetPackableValues(id, values);
         const auto ok = UpdateRecord(record);
         if(ok)
             return record;
@@ -154,8 +159,10 @@ class DbTimer<RamDb>
     RamDb& inner;
 
     template <class TFunc>
-    static auto Measure(const std::string& funcName, TFunc&& func)
+    static auto Measure(const char* funcName, TFunc&& func)
     {
+        MIOPEN_TRACE_SCOPE("db", funcName);
+
         if(!miopen::IsLogging(LoggingLevel::Info2))
             return func();
 
@@ -28,6 +28,7 @@
 
 #include <miopen/db_record.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/metrics.hpp>
 
 #include <boost/optional.hpp>
 
@@ -53,6 +54,7 @@ public:
     {
         MIOPEN_LOG_I2("Looking for key " << problem << " in file " << db_path);
         const auto it = cache.find(problem);
+        metrics::CountDbLookup(db_kind, it != cache.end());
 
         if(it == cache.end())
             return boost::none;
@@ -31,6 +31,7 @@
 #include <miopen/common.hpp>
 #include <miopen/find_controls.hpp>
 #include <miopen/object.hpp>
+#include <miopen/selection_policy.hpp>
 
 #include <limits>
 #include <unordered_map>
@@ -53,6 +54,7 @@ struct FindOptions : miopenFindOptions
     std::optional<Workspace> preallocated_workspace;
     std::optional<FindEnforce> find_enforce;
     bool attach_binaries = false;
+    std::optional<SelectionPolicy> selection_policy;
 };
 
 } // namespace miopen
@@ -68,6 +70,8 @@ inline std::ostream& operator<<(std::ostream& stream, const miopen::FindOptions&
     case miopenFindResultsOrderByWorkspaceSize: stream << "by workspace size"; break;
     }
     stream << ", workspace limit: " << options.workspace_limit;
+    if(options.selection_policy)
+        stream << ", selection policy: pareto";
     stream << ")";
     return stream;
 }
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SELECTION_POLICY_HPP
+#define GUARD_MIOPEN_SELECTION_POLICY_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/miopen.h>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+/// Objectives a solution is selected by.
+struct SolutionCost
+{
+    float time;
+    std::size_t workspace;
+    bool deterministic;
+};
+
+/// Selects solutions that trade speed for workspace or determinism. Only Pareto-optimal solutions
+/// are kept, i.e. those that no other solution beats in all of time, workspace and determinism.
+/// The cost function orders them, the cheapest first. Without a cost function they are ordered by
+/// time.
+struct MIOPEN_INTERNALS_EXPORT SelectionPolicy
+{
+    using CostFunction = std::function<double(const SolutionCost&)>;
+
+    CostFunction cost;
+
+    /// Indices of the Pareto-optimal entries in their original order.
+    static std::vector<std::size_t> ParetoFront(const std::vector<SolutionCost>& costs);
+    /// Indices of the Pareto-optimal entries ordered by cost.
+    std::vector<std::size_t> Select(const std::vector<SolutionCost>& costs) const;
+
+    template <class T, class GetCost>
+    void Apply(std::vector<T>& items, GetCost&& get_cost) const
+    {
+        auto costs = std::vector<SolutionCost>{};
+        costs.reserve(items.size());
+        for(const auto& item : items)
+            costs.push_back(get_cost(item));
+
+        auto selected = std::vector<T>{};
+        for(const auto i : Select(costs))
+            selected.emplace_back(std::move(items[i]));
+        items = std::move(selected);
+    }
+};
+
+/// Wraps a cost function of the C API. Null means no policy.
+MIOPEN_INTERNALS_EXPORT std::optional<SelectionPolicy>
+MakeSelectionPolicy(miopenSolutionCostFunction_t cost, void* user_data);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SELECTION_POLICY_HPP
@@ -29,10 +29,14 @@
 
 #include <ciso646>
 #include <miopen/config.h>
+#include <miopen/packed_values.hpp>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <functional>
+#include <type_traits>
 
 namespace miopen {
 namespace solver {
@@ -50,6 +54,19 @@ struct Parse
     }
 };
 
+/// Version of the packed VALUES layout of a config. A config bumps its
+/// "static constexpr unsigned serialization_version" when it changes the meaning of its fields.
+template <class T, class = void>
+struct SchemaVersion : std::integral_constant<unsigned, default_schema_version>
+{
+};
+
+template <class T>
+struct SchemaVersion<T, std::void_t<decltype(T::serialization_version)>>
+    : std::integral_constant<unsigned, T::serialization_version>
+{
+};
+
 template <char Separator = ','>
 struct SerDes
 {
@@ -95,9 +112,110 @@ public:
             std::bind(SerializeField{}, std::ref(stream), std::ref(sep), std::placeholders::_1));
     }
 
+    template <class Self>
+    static bool IsIntegral(const Self& self, std::uint64_t& count)
+    {
+        auto integral = true;
+        count         = 0;
+        Self::Visit(self, [&](const auto& x, auto&&...) {
+            integral = integral && std::is_integral_v<std::decay_t<decltype(x)>>;
+            ++count;
+        });
+        return integral;
+    }
+
+    /// Fails, leaving the output untouched, if some field is not an integer or does not fit
+    /// into int64_t.
+    template <class Self>
+    static bool SerializePacked(const Self& self, std::string& out)
+    {
+        auto count = std::uint64_t{};
+        if(!IsIntegral(self, count))
+            return false;
+
+        auto packed = std::string{};
+        auto writer = PackedWriter{packed};
+        auto fits   = true;
+        writer.Put(SchemaVersion<Self>::value);
+        writer.Put(count);
+        Self::Visit(self, [&](const auto& x, auto&&...) {
+            using T = std::decay_t<decltype(x)>;
+            if constexpr(std::is_integral_v<T>)
+            {
+                if constexpr(std::is_unsigned_v<T>)
+                    fits = fits && static_cast<std::uint64_t>(x) <=
+                                       std::numeric_limits<std::int64_t>::max();
+                writer.PutSigned(static_cast<std::int64_t>(x));
+            }
+        });
+        if(!fits)
+            return false;
+        out += packed;
+        return true;
+    }
+
+    template <class Self>
+    static bool DeserializePacked(Self& self, const std::string& s)
+    {
+        auto out     = self;
+        auto reader  = PackedReader{s};
+        auto version = std::uint64_t{};
+        auto count   = std::uint64_t{};
+        auto fields  = std::uint64_t{};
+
+        if(!IsIntegral(out, fields) || !reader.Get(version) || !reader.Get(count) ||
+           count != fields || version != SchemaVersion<Self>::value)
+            return false;
+
+        auto ok = true;
+        Self::Visit(out, [&](auto& x, auto&&...) {
+            using T = std::decay_t<decltype(x)>;
+            if constexpr(std::is_integral_v<T>)
+            {
+                auto value = std::int64_t{};
+                if(!ok || !reader.GetSigned(value))
+                {
+                    ok = false;
+                    return;
+                }
+                if constexpr(std::is_same_v<T, bool>)
+                    ok = value == 0 || value == 1;
+                else if constexpr(std::is_signed_v<T>)
+                    ok = value >= std::numeric_limits<T>::min() &&
+                         value <= std::numeric_limits<T>::max();
+                else
+                    ok = value >= 0 && static_cast<std::uint64_t>(value) <=
+                                           std::numeric_limits<T>::max();
+                x = static_cast<T>(value);
+            }
+            else
+            {
+                ok = false;
+            }
+        });
+
+        if(!ok || !reader.AtEnd())
+            return false;
+
+        self = out;
+        return true;
+    }
+
     template <class Self>
     static bool Deserialize(Self& self, const std::string& s)
     {
+        if(IsPacked(s))
+        {
+            auto count = std::uint64_t{};
+            if(IsIntegral(self, count))
+                return DeserializePacked(self, s);
+            // Values packed by a conversion tool, read them back as text.
+            auto version = std::uint64_t{};
+            auto text    = std::string{};
+            return GetSchemaVersion(s, version) && version == SchemaVersion<Self>::value &&
+                   UnpackToText(s, text, Separator) && Deserialize(self, text);
+        }
+
         auto out = self;
         bool ok  = true;
         std::istringstream ss(s);
@@ -126,6 +244,11 @@ struct Serializable
     {
         return serialize::SerDes<>::Deserialize(static_cast<Derived&>(*this), s);
     }
+
+    bool SerializePacked(std::string& s) const
+    {
+        return serialize::SerDes<>::SerializePacked(static_cast<const Derived&>(*this), s);
+    }
 };
 
 } // namespace solver
@@ -105,6 +105,7 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
     void SetWorkspaceSize(std::size_t value) { workspace_required = value; }
     const solver::Id& GetSolver() const { return solver; }
     void SetSolver(solver::Id value) { solver = value; }
+    const std::optional<std::string>& GetPerfConfig() const { return perf_cfg; }
     void SetPerfConfig(const std::optional<std::string>& cfg) { perf_cfg = cfg; }
     const ProblemContainer& GetProblem() const { return problem; }
     void SetProblem(ProblemContainer value) { problem = std::move(value); }
@@ -119,6 +120,10 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
     friend void to_json(nlohmann::json& json, const Solution& solution);
     friend void from_json(const nlohmann::json& json, Solution& solution);
 
+    /// Everything but the kernels and their binaries.
+    void SerializeMetadata(nlohmann::json& json) const;
+    void DeserializeMetadata(const nlohmann::json& json);
+
     void SetInvoker(Invoker invoker_,
                     const std::vector<Program>& programs            = {},
                     const std::vector<solver::KernelInfo>& kernels_ = {})
@@ -147,6 +152,7 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 
     const std::optional<Invoker>& GetInvoker() const { return invoker; }
     const std::vector<KernelInfo>& GetKernels() const { return kernels; }
+    void SetKernels(std::vector<KernelInfo> value) { kernels = std::move(value); }
 
 private:
     float time                     = 0;
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SOLUTION_ARCHIVE_HPP
+#define GUARD_MIOPEN_SOLUTION_ARCHIVE_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/solution.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace miopen {
+namespace solution_archive {
+
+/// Binary container for one or more serialized solutions.
+///
+/// The file starts with a fixed 64-byte header and a table with one entry per solution. Each entry
+/// points at a small msgpack document with the solution metadata (problem, solver, perf config),
+/// at a table of kernels and at a table of programs. The code objects follow as raw sections
+/// aligned to 64 bytes, shared by all the solutions that use them. Loading does not parse or copy
+/// the code objects: the modules are created straight from the buffer, which can be a read-only
+/// mapping of the file.
+///
+/// All numbers are stored little-endian.
+
+constexpr std::uint32_t Version        = 1;
+constexpr std::size_t SectionAlignment = 64;
+
+/// Returns true if the data starts with the archive signature.
+MIOPEN_INTERNALS_EXPORT bool IsArchive(const void* data, std::size_t size);
+
+MIOPEN_INTERNALS_EXPORT std::vector<std::uint8_t>
+Write(const std::vector<const Solution*>& solutions);
+
+/// The tables of each solution are validated before its modules are created. Solutions saved
+/// without kernels are restored without them as well.
+MIOPEN_INTERNALS_EXPORT std::vector<Solution> Read(const void* data, std::size_t size);
+
+/// Returns the number of solutions without loading them.
+MIOPEN_INTERNALS_EXPORT std::size_t Count(const void* data, std::size_t size);
+
+MIOPEN_INTERNALS_EXPORT void Save(const std::vector<const Solution*>& solutions,
+                                  const fs::path& file);
+MIOPEN_INTERNALS_EXPORT std::vector<Solution> Load(const fs::path& file);
+MIOPEN_INTERNALS_EXPORT std::size_t Count(const fs::path& file);
+
+} // namespace solution_archive
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SOLUTION_ARCHIVE_HPP
@@ -88,6 +88,11 @@ struct SolverBase
     /// Must return true if a Solver has its own implementation of GetWorkspaceSize().
     virtual bool MayNeedWorkspace() const { return false; }
 
+    /// Must return true only if the IsValid() of the performance configs is reentrant, so
+    /// the tuning space can be enumerated concurrently. Solvers that validate through MLIR
+    /// or CK instances are not.
+    virtual bool IsTuningSpaceThreadSafe() const { return false; }
+
 protected:
     template <class Solver>
     static const std::string& GetSolverDbId()
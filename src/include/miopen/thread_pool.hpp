@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_THREAD_POOL_HPP
+#define GUARD_MIOPEN_THREAD_POOL_HPP
+
+#include <miopen/config.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+
+/// Persistent work-stealing thread pool behind par_for.
+///
+/// Every worker owns a task deque. Tasks submitted from a worker go to the
+/// back of its own deque and are taken LIFO, idle workers steal from the front
+/// of the others. Tasks submitted from outside the pool are spread over the
+/// deques round-robin.
+///
+/// ParallelFor hands out index ranges dynamically, so uneven work items do not
+/// leave threads idle, and the calling thread processes ranges too. Because of
+/// the latter a ParallelFor issued from inside a task (nested parallelism)
+/// always makes progress even when every worker is busy.
+///
+/// par_for is header-only and used by the tests and the driver too, so the pool
+/// is exported from the library regardless of MIOPEN_BUILD_TESTING.
+class MIOPEN_EXPORT ThreadPool
+{
+public:
+    using Task  = std::function<void()>;
+    using Range = std::function<void(std::size_t first, std::size_t last)>;
+
+    explicit ThreadPool(std::size_t workers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Process-wide pool, created on first use with a worker per hardware
+    /// thread other than the calling one
+    static ThreadPool& Global();
+
+    std::size_t GetWorkerCount() const { return threads.size(); }
+
+    /// Calls f on consecutive ranges of at most `grain` indices covering
+    /// [0, n), on at most `concurrency` threads at a time including the
+    /// calling one. Returns when all ranges are done and rethrows the first
+    /// exception thrown by f; the ranges not started by then are skipped.
+    void ParallelFor(std::size_t n, std::size_t grain, std::size_t concurrency, const Range& f);
+
+    /// Queues a task. The returned future becomes ready when the task is done and
+    /// rethrows the exception the task threw, if any.
+    std::future<void> Submit(Task task);
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void Enqueue(Task task);
+    bool TryPop(Task& task);
+    void WorkerLoop(std::size_t id);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::size_t queued     = 0; // guarded by mutex
+    std::size_t next_queue = 0; // guarded by mutex
+    bool stop              = false;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_THREAD_POOL_HPP
@@ -27,6 +27,7 @@
 #define GUARD_MIOPEN_TIMER_HPP_
 
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 
 namespace miopen {
 
@@ -53,6 +54,8 @@ class CompileTimer
 #if MIOPEN_BUILD_DEV
     Timer timer;
 #endif
+    std::uint64_t trace_start = trace::IsEnabled() ? trace::Now() : 0;
+
 public:
     CompileTimer()
     {
@@ -62,6 +65,8 @@ public:
     }
     void Log(const std::string& s1, const std::string& s2 = {})
     {
+        if(trace_start != 0)
+            trace::Record("build", "Compile", trace_start, s2.empty() ? s1 : s1 + " " + s2);
 #if MIOPEN_BUILD_DEV
         MIOPEN_LOG_I2(s1 << (s2.empty() ? "" : " ") << s2
                          << " Compile Time, ms: " << timer.elapsed_ms());
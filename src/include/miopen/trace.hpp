@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TRACE_HPP_
+#define GUARD_MIOPEN_TRACE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace miopen {
+namespace trace {
+
+/// Tracing of library internals in the Chrome trace event format, which both chrome://tracing
+/// and Perfetto open. It is enabled by setting MIOPEN_TRACE_FILE to the file the trace is
+/// written to at exit.
+///
+/// Each thread records into its own ring buffer, which keeps the most recent
+/// MIOPEN_TRACE_BUFFER_EVENTS events, so recording takes no locks. A disabled probe costs one
+/// relaxed atomic load.
+
+/// A finished scope, exported as a complete ("X") event.
+struct Event
+{
+    const char* category;
+    const char* name;
+    std::uint64_t start_ns;
+    std::uint64_t duration_ns;
+    char detail[64]; // Zero terminated, truncated
+};
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+MIOPEN_INTERNALS_EXPORT extern std::atomic<bool> enabled;
+
+inline bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+MIOPEN_INTERNALS_EXPORT void SetEnabled(bool value);
+
+/// Nanoseconds of a monotonic clock.
+MIOPEN_INTERNALS_EXPORT std::uint64_t Now();
+
+/// Records the event of a scope which started at start_ns and ends now.
+/// category and name must be string literals, detail is copied.
+MIOPEN_INTERNALS_EXPORT void
+Record(const char* category, const char* name, std::uint64_t start_ns, std::string_view detail = {});
+
+/// Writes the events recorded by all threads as Chrome trace JSON.
+/// Threads should not be recording while their events are written.
+MIOPEN_INTERNALS_EXPORT void Export(std::ostream& stream);
+MIOPEN_INTERNALS_EXPORT void Export(const fs::path& file);
+/// Drops the events recorded so far.
+MIOPEN_INTERNALS_EXPORT void Clear();
+
+/// Records the time between its construction and destruction.
+class Scope
+{
+public:
+    Scope(const char* category_, const char* name_) : category(category_), name(name_)
+    {
+        if(IsEnabled())
+            start = Now();
+    }
+
+    Scope(const char* category_, const char* name_, std::string_view detail_)
+        : category(category_), name(name_)
+    {
+        if(IsEnabled())
+        {
+            // Copied, as the detail is often built by the caller in a temporary string.
+            detail_size = std::min(detail_.size(), sizeof(detail));
+            std::copy_n(detail_.data(), detail_size, detail);
+            start = Now();
+        }
+    }
+
+    /// The path is converted only if tracing is enabled.
+    template <class Path, std::enable_if_t<std::is_same_v<Path, fs::path>, bool> = true>
+    Scope(const char* category_, const char* name_, const Path& detail_)
+        : Scope(category_,
+                name_,
+                std::string_view{IsEnabled() ? detail_.string() : std::string{}})
+    {
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope()
+    {
+        if(start != 0)
+            Record(category, name, start, {detail, detail_size});
+    }
+
+private:
+    const char* category;
+    const char* name;
+    char detail[sizeof(Event::detail) - 1];
+    std::size_t detail_size = 0;
+    std::uint64_t start     = 0;
+};
+
+} // namespace trace
+} // namespace miopen
+
+#define MIOPEN_TRACE_SCOPE(category, ...) \
+    const miopen::trace::Scope MIOPEN_PP_CAT(miopen_trace_scope_, __LINE__)(category, __VA_ARGS__)
+
+#endif // GUARD_MIOPEN_TRACE_HPP_
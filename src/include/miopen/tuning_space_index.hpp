@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+/// Marks the valid performance configs of a tuning space with one bit per point of the
+/// SetNextValue() walk over it, so the space can be rebuilt without calling IsValid().
+struct MIOPEN_INTERNALS_EXPORT TuningSpaceMask
+{
+    bool spare       = false; // The walk starts from PerformanceConfig(spare)
+    std::size_t size = 0;     // Number of points in the walk
+    std::vector<std::uint64_t> bits;
+
+    void Resize(std::size_t new_size);
+    void Set(std::size_t i) { bits[i / 64] |= std::uint64_t{1} << (i % 64); }
+    bool Test(std::size_t i) const { return ((bits[i / 64] >> (i % 64)) & 1) != 0; }
+    std::size_t Count() const;
+
+    void Write(std::ostream& stream) const;
+    bool Read(std::istream& stream);
+};
+
+/// Hashes the serialized performance configs of a tuning space walk. Part of the index key,
+/// so a mask is not applied to a space whose points have changed but not their number.
+class MIOPEN_INTERNALS_EXPORT TuningSpaceHash
+{
+public:
+    void Add(std::string_view value);
+    std::string ToString() const;
+
+private:
+    std::uint64_t hash = 0xcbf29ce484222325; // FNV-1a offset basis
+};
+
+/// Remembers the tuning space masks by (solver, device, problem) key, both in memory and as
+/// files in the user cache directory, so the valid configs are enumerated once.
+class MIOPEN_INTERNALS_EXPORT TuningSpaceIndex
+{
+public:
+    /// An empty directory keeps the masks in memory only.
+    explicit TuningSpaceIndex(fs::path dir_);
+
+    static TuningSpaceIndex& Instance();
+
+    std::shared_ptr<const TuningSpaceMask> Find(const std::string& key);
+    void Store(const std::string& key, TuningSpaceMask mask);
+    void Clear();
+
+    fs::path GetPath(const std::string& key) const;
+
+private:
+    fs::path dir;
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const TuningSpaceMask>> masks;
+};
+
+} // namespace solver
+} // namespace miopen
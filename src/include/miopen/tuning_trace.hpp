@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/invoke_params.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace miopen {
+
+/// Identifies one tuning measurement: where it has been taken ("search" for GenericSearch,
+/// "find" for the Find benchmarking), the problem key, the solver and the perf config.
+struct TuningSampleKey
+{
+    std::string kind;
+    std::string problem;
+    std::string solver;
+    std::string perf_cfg;
+
+    friend bool operator<(const TuningSampleKey& l, const TuningSampleKey& r)
+    {
+        return std::tie(l.kind, l.problem, l.solver, l.perf_cfg) <
+               std::tie(r.kind, r.problem, r.solver, r.perf_cfg);
+    }
+};
+
+/// Kernel times measured by the tuning loops, as a text file with one tab-separated
+/// "kind problem solver perf_cfg time" line per measurement.
+///
+/// Recording is enabled by MIOPEN_TUNING_TRACE_RECORD=<file> and appends every measurement.
+/// Replaying serves the recorded times of a key in the order they were recorded, starting over
+/// when they run out, so a replayed search sees the same times on every run.
+class MIOPEN_INTERNALS_EXPORT TuningTrace
+{
+public:
+    TuningTrace() = default;
+
+    /// The recorder configured by MIOPEN_TUNING_TRACE_RECORD, if any.
+    static TuningTrace* Recorder();
+
+    void Record(const TuningSampleKey& key, float time);
+    std::optional<float> Next(const TuningSampleKey& key);
+    std::size_t Size() const;
+
+    void Write(std::ostream& stream) const;
+    void Read(std::istream& stream);
+    void Save(const fs::path& file) const;
+    void Load(const fs::path& file);
+
+private:
+    struct Samples
+    {
+        std::vector<float> times;
+        std::size_t next = 0;
+    };
+
+    mutable std::mutex mutex;
+    std::map<TuningSampleKey, Samples> samples;
+    std::size_t count = 0;
+    fs::path file; // recorded samples are appended to it, if set
+};
+
+/// Serves the time of a measurement instead of building and running its kernels.
+using TuningTimeSource = std::function<float(const TuningSampleKey&)>;
+
+/// Virtual handle for the development of search strategies on machines without a GPU. The
+/// tuning loops neither build nor launch kernels on it and take the times of its trace instead.
+class MIOPEN_INTERNALS_EXPORT TuningReplayHandle final : public Handle
+{
+public:
+    explicit TuningReplayHandle(const fs::path& trace_file);
+
+    /// The returned source throws if the trace has no time for a measurement.
+    /// It must not outlive the handle.
+    TuningTimeSource GetTimeSource() const;
+
+private:
+    mutable TuningTrace trace;
+};
+
+/// Takes the kernel time measurements of a tuning loop. With a time source, given explicitly or
+/// taken from a TuningReplayHandle, the kernels are neither built nor run and the times come from
+/// the source. Otherwise the measured times are also recorded if MIOPEN_TUNING_TRACE_RECORD is set.
+class MIOPEN_INTERNALS_EXPORT TuningMeasurement
+{
+public:
+    TuningMeasurement(const Handle& handle_,
+                      std::string kind,
+                      std::string problem,
+                      TuningTimeSource time_source_ = {});
+
+    bool IsReplay() const { return static_cast<bool>(time_source); }
+
+    /// Selects the solver and perf config the following measurements belong to.
+    void Select(std::string solver, std::string perf_cfg);
+    /// Returns an empty invoker when replaying.
+    Invoker Prepare(const InvokerFactory& factory,
+                    const std::vector<solver::KernelInfo>& kernels,
+                    std::vector<Program>* programs_out = nullptr) const;
+    /// Runs the invoker once and returns the kernel time.
+    float Run(const Invoker& invoker, const AnyInvokeParams& params) const;
+
+private:
+    const Handle& handle;
+    TuningTimeSource time_source;
+    TuningTrace* recorder;
+    TuningSampleKey key;
+};
+
+} // namespace miopen
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace solver {
+
+/// Distance between the problem being tuned and the one stored under a PerfDb key, negative if
+/// the problems cannot share performance configs.
+using PerfDbKeyDistance = std::function<double(std::string_view key)>;
+
+/// Returns the values tuned by the solver for up to k problems closest to the given one, nearest
+/// first. Both the system and the user PerfDb are searched, packed values are returned as text.
+MIOPEN_INTERNALS_EXPORT std::vector<std::string>
+FindTunedNeighbours(const ExecutionContext& ctx,
+                    const PerfDbKeyDistance& distance,
+                    const std::string& solver_id,
+                    std::size_t k);
+
+/// Returns the order in which to measure configs, given their text form: first the configs equal
+/// to a seed, in the order of the seeds, then the ones differing from a seed in a single field,
+/// then the rest. The order within each group is kept.
+MIOPEN_INTERNALS_EXPORT std::vector<std::size_t>
+SeedOrder(const std::vector<std::string>& configs, const std::vector<std::string>& seeds);
+
+} // namespace solver
+} // namespace miopen
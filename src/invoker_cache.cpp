@@ -26,19 +26,34 @@
 
 #include <miopen/invoker_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 
 namespace miopen {
 
+static std::nullopt_t CountMiss()
+{
+    static auto& misses = metrics::GetCounter("invoker_cache.misses");
+    misses.Add();
+    return std::nullopt;
+}
+
+static const Invoker& CountHit(const Invoker& invoker)
+{
+    static auto& hits = metrics::GetCounter("invoker_cache.hits");
+    hits.Add();
+    return invoker;
+}
+
 std::optional<Invoker> InvokerCache::operator[](const Key& key) const
 {
     const auto item = invokers.find(key.first);
     if(item == invokers.end())
-        return std::nullopt;
+        return CountMiss();
     const auto& item_invokers = item->second.invokers;
     const auto invoker        = item_invokers.find(key.second);
     if(invoker == item_invokers.end())
-        return std::nullopt;
-    return invoker->second;
+        return CountMiss();
+    return CountHit(invoker->second);
 }
 
 std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_config,
@@ -48,13 +63,13 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
     if(item == invokers.end())
     {
         MIOPEN_LOG_I2("No invokers found for " << network_config);
-        return std::nullopt;
+        return CountMiss();
     }
     if(item->second.found_1_0.empty())
     {
         MIOPEN_LOG_I2("Invokers found for " << network_config
                                             << " but there is no find 1.0 result.");
-        return std::nullopt;
+        return CountMiss();
     }
     const auto& item_invokers = item->second.invokers;
     const auto& found_1_0_ids = item->second.found_1_0;
@@ -63,7 +78,7 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
     {
         MIOPEN_LOG_I2("Invokers found for "
                       << network_config << " but there is no one with an algorithm " << algorithm);
-        return std::nullopt;
+        return CountMiss();
     }
     const auto invoker = item_invokers.find(found_1_0_id->second);
     if(invoker == item_invokers.end())
@@ -71,7 +86,7 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
         MIOPEN_THROW("No invoker with solver_id of " + found_1_0_id->second +
                      " was registered for " + network_config);
     }
-    return invoker->second;
+    return CountHit(invoker->second);
 }
 
 std::optional<std::string> InvokerCache::GetFound1_0SolverId(const std::string& network_config,
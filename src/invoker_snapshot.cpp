@@ -0,0 +1,193 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/invoker_snapshot.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/find_refinement.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/names.hpp>
+#include <miopen/problem.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <fstream>
+
+namespace miopen {
+
+namespace {
+
+namespace fields {
+inline constexpr const char* Validation = "validation";
+inline constexpr const char* Version    = "version";
+inline constexpr const char* Device     = "device";
+inline constexpr const char* Solutions  = "solutions";
+} // namespace fields
+
+constexpr std::uint64_t ValidationNumber = 0x5AB5407F1A7E5E75;
+constexpr std::uint64_t Version          = 1;
+
+} // namespace
+
+InvokerSnapshot& InvokerSnapshot::Instance()
+{
+    static InvokerSnapshot snapshot;
+    return snapshot;
+}
+
+void InvokerSnapshot::Record(const Handle& handle,
+                             const conv::ProblemDescription& problem,
+                             solver::Id solver_id,
+                             const std::string& perf_cfg,
+                             const std::vector<Program>& programs,
+                             const std::vector<solver::KernelInfo>& kernels)
+{
+    // Transposed convolutions are described by Find 2.0 problems differently.
+    if(problem.GetConv().mode == miopenTranspose)
+        return;
+
+    auto solution = Solution{solver_id, 0, 0};
+    solution.SetProblem({conv::FindRefinement::AsFindProblem(problem)});
+    if(!perf_cfg.empty())
+        solution.SetPerfConfig(perf_cfg);
+    solution.SetInvoker({}, programs, kernels);
+
+    const auto key = problem.MakeNetworkConfig().ToString() + '/' + solver_id.ToString();
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    solutions[handle.GetDbBasename()].insert_or_assign(key, std::move(solution));
+}
+
+std::size_t InvokerSnapshot::Save(const Handle& handle, const fs::path& file) const
+{
+    const auto device = handle.GetDbBasename();
+    auto json         = nlohmann::json{
+        {fields::Validation, ValidationNumber},
+        {fields::Version, Version},
+        {fields::Device, device},
+        {fields::Solutions, nlohmann::json::array()},
+    };
+
+    {
+        const auto lock  = std::lock_guard<std::mutex>{mutex};
+        const auto found = solutions.find(device);
+        if(found != solutions.end())
+        {
+            for(const auto& pair : found->second)
+                json[fields::Solutions].push_back(pair.second);
+        }
+    }
+
+    const auto count = json[fields::Solutions].size();
+    const auto data  = nlohmann::json::to_msgpack(json);
+
+    // Write next to the target and rename, so concurrent loads never see a partial snapshot.
+    auto tmp = file;
+    tmp += ".tmp";
+    {
+        auto stream = std::ofstream{tmp, std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+        if(!stream)
+            MIOPEN_THROW(miopenStatusInternalError, "Unable to write " + tmp.string());
+    }
+    fs::rename(tmp, file);
+
+    MIOPEN_LOG_I("Saved " << count << " solutions to " << file);
+    return count;
+}
+
+std::size_t InvokerSnapshot::Load(Handle& handle, const fs::path& file)
+{
+    if(!fs::exists(file))
+        MIOPEN_THROW(miopenStatusInvalidValue, file.string() + " does not exist");
+
+    auto json = nlohmann::json{};
+    {
+        namespace ipc = boost::interprocess;
+        const auto mapping = ipc::file_mapping{file.string().c_str(), ipc::read_only};
+        const auto region  = ipc::mapped_region{mapping, ipc::read_only};
+        const auto begin   = static_cast<const std::uint8_t*>(region.get_address());
+        json = nlohmann::json::from_msgpack(begin, begin + region.get_size(), true, false);
+    }
+
+    if(json.is_discarded() || !json.is_object() ||
+       json.value(fields::Validation, std::uint64_t{0}) != ValidationNumber)
+    {
+        MIOPEN_THROW(miopenStatusInvalidValue, file.string() + " is not an invoker snapshot");
+    }
+    if(json.at(fields::Version).get<std::uint64_t>() != Version)
+    {
+        MIOPEN_THROW(miopenStatusVersionMismatch,
+                     file.string() + " has been saved by an incompatible version");
+    }
+    if(json.at(fields::Device).get<std::string>() != handle.GetDbBasename())
+    {
+        MIOPEN_THROW(miopenStatusInvalidValue,
+                     file.string() + " has been saved for another device: " +
+                         json.at(fields::Device).get<std::string>());
+    }
+
+    auto loaded = std::size_t{0};
+    for(const auto& item : json.at(fields::Solutions))
+    {
+        try
+        {
+            const auto solution     = item.get<Solution>();
+            const auto& problem     = std::get<Problem>(solution.GetProblem().item);
+            const auto conv_problem = problem.AsConvolution();
+            const auto& solver_id   = solution.GetSolver();
+
+            auto ctx = ExecutionContext{&handle};
+            conv_problem.SetupFloats(ctx);
+
+            const auto factory = solver_id.GetSolver().GetInvokeFactory(
+                ctx, conv_problem, solution.GetPerfConfig().value_or(""));
+            const auto& kernels = solution.GetKernels();
+            const auto invoker  = factory(std::vector<Kernel>{kernels.begin(), kernels.end()});
+            const auto algo     = AlgorithmName{solver_id.GetAlgo(conv_problem.GetDirection())};
+
+            handle.RegisterInvoker(
+                invoker, conv_problem.MakeNetworkConfig(), solver_id.ToString(), algo);
+            ++loaded;
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Skipping a solution of " << file << ": " << ex.what());
+        }
+    }
+
+    MIOPEN_LOG_I("Loaded " << loaded << " invokers from " << file);
+    return loaded;
+}
+
+} // namespace miopen
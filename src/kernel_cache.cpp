@@ -43,6 +43,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/stringutils.hpp>
 
 #include <iostream>
@@ -111,6 +112,7 @@ Kernel KernelCache::AddKernel(const Handle& h,
         auto program_it = program_map.find(std::make_pair(program_name, params));
         if(program_it != program_map.end())
         {
+            MIOPEN_METRICS_COUNT("kernel_cache.hits");
             auto& program = program_it->second;
 
             if(program_out != nullptr && !program.IsCodeObjectInMemory() &&
@@ -126,6 +128,7 @@ Kernel KernelCache::AddKernel(const Handle& h,
         }
         else
         {
+            MIOPEN_METRICS_COUNT("kernel_cache.misses");
             auto program = h.LoadProgram(program_name, params, kernel_src, program_out != nullptr);
 
             program_map[std::make_pair(program_name, params)] = program;
@@ -49,6 +49,8 @@ struct CheckNumericsResult
     int hasZero;
     int hasNan;
     int hasInf;
+
+    float absMax;
 };
 
 __device__ void thread_redux(Numerics* stats, size_t wid)
@@ -72,6 +74,7 @@ check_numerics(const T* C_d, size_t sz, CheckNumericsResult* abnormal, bool comp
     U absSum = 0;
     T minV   = std::numeric_limits<T>::max();
     T maxV   = std::numeric_limits<T>::min();
+    U absMax = 0;
 
     size_t offset = (blockIdx.x * blockDim.x + threadIdx.x);
     size_t stride = blockDim.x * gridDim.x;
@@ -84,6 +87,8 @@ check_numerics(const T* C_d, size_t sz, CheckNumericsResult* abnormal, bool comp
         absSum += abs_val;
         minV = min(minV, val);
         maxV = max(maxV, val);
+        if(abs_val > absMax)
+            absMax = abs_val;
         if(abs_val <= static_cast<U>(0.0f))
             abnormal->hasZero = 1;
         if(isnan(static_cast<U>(val)))
@@ -91,6 +96,10 @@ check_numerics(const T* C_d, size_t sz, CheckNumericsResult* abnormal, bool comp
         if(isinf(static_cast<U>(val)))
             abnormal->hasInf = 1;
     }
+    // absMax is never negative or NaN, so its bits are ordered like unsigned integers.
+    if(absMax > static_cast<U>(0.0f))
+        atomicMax(reinterpret_cast<unsigned int*>(&abnormal->absMax),
+                  __float_as_uint(static_cast<float>(absMax)));
     if(computeStats)
     {
         stats[threadIdx.x].sum    = static_cast<float>(sum);
@@ -31,7 +31,9 @@
 #include <chrono>
 #include <ios>
 #include <iomanip>
+#include <iostream>
 #include <sstream>
+#include <utility>
 
 #ifdef __linux__
 #include <unistd.h>
@@ -176,6 +178,28 @@ const char* LoggingLevelToCString(const LoggingLevel level)
 
 bool IsLoggingCmd() { return env::enabled(MIOPEN_ENABLE_LOGGING_CMD) && !IsLoggingDebugQuiet(); }
 
+namespace {
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+thread_local LogBuffer* current_log_buffer = nullptr;
+} // namespace
+
+LogBuffer::LogBuffer() : previous(std::exchange(current_log_buffer, this)) {}
+
+LogBuffer::~LogBuffer()
+{
+    current_log_buffer = previous;
+    if(!text.empty())
+        LogWrite(text);
+}
+
+void LogWrite(const std::string& message)
+{
+    if(current_log_buffer != nullptr)
+        current_log_buffer->text += message;
+    else
+        std::cerr << message;
+}
+
 std::string LoggingPrefix()
 {
     std::stringstream ss;
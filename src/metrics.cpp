@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/metrics.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+
+/// File the metrics are written to at exit. Nothing is written when empty.
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_METRICS_FILE)
+
+namespace miopen {
+namespace metrics {
+
+namespace {
+
+int Log2(std::uint64_t value)
+{
+    auto log = 0;
+    while(value >>= 1)
+        ++log;
+    return log;
+}
+
+struct Registry
+{
+    std::mutex mutex;
+    // Node based, so references handed out stay valid when other metrics are added.
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+
+    static Registry& Instance()
+    {
+        static Registry instance;
+        return instance;
+    }
+};
+
+template <class TMetric>
+TMetric& GetOrCreate(std::map<std::string, std::unique_ptr<TMetric>>& metrics,
+                     const std::string& name)
+{
+    auto& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& metric = metrics[name];
+    if(!metric)
+        metric = std::make_unique<TMetric>();
+    return *metric;
+}
+
+template <class TMetric>
+const TMetric* Find(const std::map<std::string, std::unique_ptr<TMetric>>& metrics,
+                    const std::string& name)
+{
+    auto& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const auto it = metrics.find(name);
+    return it == metrics.end() ? nullptr : it->second.get();
+}
+
+/// Writes the metrics to MIOPEN_METRICS_FILE at exit.
+struct AtExit
+{
+    // Constructed before the registry is used, so the registry outlives it.
+    AtExit() { std::ignore = Registry::Instance(); }
+
+    ~AtExit()
+    {
+        const auto& file = env::value(MIOPEN_METRICS_FILE);
+        if(file.empty())
+            return;
+        try
+        {
+            Dump(fs::path{file});
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_E("Failed to write the metrics to " << file << ": " << ex.what());
+        }
+    }
+};
+
+// NOLINTNEXTLINE (cert-err58-cpp)
+const AtExit at_exit;
+
+} // namespace
+
+std::size_t Histogram::BucketOf(std::uint64_t ns)
+{
+    if(ns < linear)
+        return ns;
+    const auto log = Log2(ns);
+    const auto sub = (ns >> (log - 3)) & (sub_buckets - 1);
+    return linear + (log - 4) * sub_buckets + sub;
+}
+
+std::uint64_t Histogram::LowerBound(std::size_t bucket)
+{
+    if(bucket < linear)
+        return bucket;
+    const auto log = 4 + (bucket - linear) / sub_buckets;
+    const auto sub = (bucket - linear) % sub_buckets;
+    return (sub_buckets + sub) << (log - 3);
+}
+
+void Histogram::Record(std::uint64_t ns)
+{
+    buckets[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(ns, std::memory_order_relaxed);
+
+    auto prev_min = min.load(std::memory_order_relaxed);
+    while(ns < prev_min && !min.compare_exchange_weak(prev_min, ns, std::memory_order_relaxed)) {}
+    auto prev_max = max.load(std::memory_order_relaxed);
+    while(ns > prev_max && !max.compare_exchange_weak(prev_max, ns, std::memory_order_relaxed)) {}
+}
+
+std::uint64_t Histogram::Min() const
+{
+    return Count() == 0 ? 0 : min.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::Percentile(double percentile) const
+{
+    const auto total = Count();
+    if(total == 0)
+        return 0;
+
+    const auto clamped = std::clamp(percentile, 0., 100.);
+    const auto target  = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(clamped / 100. * static_cast<double>(total))));
+
+    auto seen = std::uint64_t{0};
+    for(auto i = std::size_t{0}; i < bucket_num; ++i)
+    {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if(seen < target)
+            continue;
+        // Middle of the bucket, kept within the values actually seen.
+        const auto lower = LowerBound(i);
+        const auto upper = i + 1 < bucket_num ? LowerBound(i + 1) : Max() + 1;
+        return std::clamp(lower + (upper - lower - 1) / 2, Min(), Max());
+    }
+    return Max();
+}
+
+void Histogram::Reset()
+{
+    for(auto& bucket : buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    min.store(UINT64_MAX, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+Counter& GetCounter(const std::string& name)
+{
+    return GetOrCreate(Registry::Instance().counters, name);
+}
+
+Histogram& GetHistogram(const std::string& name)
+{
+    return GetOrCreate(Registry::Instance().histograms, name);
+}
+
+const Counter* FindCounter(const std::string& name)
+{
+    return Find(Registry::Instance().counters, name);
+}
+
+const Histogram* FindHistogram(const std::string& name)
+{
+    return Find(Registry::Instance().histograms, name);
+}
+
+void CountDbLookup(DbKinds kind, bool hit)
+{
+    static auto& find_db_hits   = GetCounter("find_db.hits");
+    static auto& find_db_misses = GetCounter("find_db.misses");
+    static auto& perf_db_hits   = GetCounter("perf_db.hits");
+    static auto& perf_db_misses = GetCounter("perf_db.misses");
+
+    switch(kind)
+    {
+    case DbKinds::FindDb: (hit ? find_db_hits : find_db_misses).Add(); break;
+    case DbKinds::PerfDb: (hit ? perf_db_hits : perf_db_misses).Add(); break;
+    case DbKinds::KernelDb: break; // Counted by LoadBinary
+    }
+}
+
+void Dump(std::ostream& stream)
+{
+    auto counters   = nlohmann::json::object();
+    auto histograms = nlohmann::json::object();
+
+    {
+        auto& registry = Registry::Instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for(const auto& [name, counter] : registry.counters)
+            counters[name] = counter->Get();
+
+        for(const auto& [name, histogram] : registry.histograms)
+        {
+            // Milliseconds, like the other timings reported by the library.
+            const auto ms = [](std::uint64_t ns) { return static_cast<double>(ns) * 1e-6; };
+            histograms[name] = {
+                {"count", histogram->Count()},
+                {"total_ms", ms(histogram->Sum())},
+                {"min_ms", ms(histogram->Min())},
+                {"p50_ms", ms(histogram->Percentile(50))},
+                {"p90_ms", ms(histogram->Percentile(90))},
+                {"p99_ms", ms(histogram->Percentile(99))},
+                {"max_ms", ms(histogram->Max())},
+            };
+        }
+    }
+
+    stream << nlohmann::json{{"counters", counters}, {"latencies", histograms}}.dump(2)
+           << std::endl;
+}
+
+void Dump(const fs::path& file)
+{
+    auto stream = std::ofstream{file};
+    if(!stream)
+        MIOPEN_THROW("Unable to open " + file);
+    Dump(stream);
+}
+
+void Reset()
+{
+    auto& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for(auto& counter : registry.counters)
+        counter.second->Reset();
+    for(auto& histogram : registry.histograms)
+        histogram.second->Reset();
+}
+
+} // namespace metrics
+} // namespace miopen
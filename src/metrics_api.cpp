@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/miopen.h>
+
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
+
+extern "C" miopenStatus_t miopenGetMetricCounter(const char* name, size_t* value)
+{
+    MIOPEN_LOG_FUNCTION(name, value);
+
+    return miopen::try_([&] {
+        if(name == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Metric name must not be null");
+        const auto counter   = miopen::metrics::FindCounter(name);
+        miopen::deref(value) = counter != nullptr ? counter->Get() : 0;
+    });
+}
+
+extern "C" miopenStatus_t
+miopenGetMetricLatency(const char* name, float percentile, float* latency, size_t* count)
+{
+    MIOPEN_LOG_FUNCTION(name, percentile, latency, count);
+
+    return miopen::try_([&] {
+        if(name == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Metric name must not be null");
+        if(percentile < 0.f || percentile > 100.f)
+            MIOPEN_THROW(miopenStatusBadParm, "Percentile must be in the [0, 100] range");
+
+        const auto histogram   = miopen::metrics::FindHistogram(name);
+        const auto ns          = histogram != nullptr ? histogram->Percentile(percentile) : 0;
+        miopen::deref(latency) = static_cast<float>(ns) * 1e-6f;
+        if(count != nullptr)
+            *count = histogram != nullptr ? histogram->Count() : 0;
+    });
+}
+
+extern "C" miopenStatus_t miopenDumpMetrics(const char* path)
+{
+    MIOPEN_LOG_FUNCTION(path);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Path must not be null");
+        miopen::metrics::Dump(miopen::fs::path{path});
+    });
+}
+
+extern "C" miopenStatus_t miopenResetMetrics()
+{
+    return miopen::try_([&] { miopen::metrics::Reset(); });
+}
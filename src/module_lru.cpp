@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/module_lru.hpp>
+#include <miopen/logger.hpp>
+
+namespace miopen {
+
+ModuleLru& ModuleLru::Instance()
+{
+    static ModuleLru instance{env::value(MIOPEN_LAZY_MODULE_BUDGET)};
+    return instance;
+}
+
+std::list<ModuleLru::Entry>::iterator ModuleLru::TouchUnsafe(const void* key, Unloader& unload)
+{
+    const auto found = index.find(key);
+    if(found != index.end())
+    {
+        order.splice(order.begin(), order, found->second);
+        return found->second;
+    }
+
+    order.push_front(Entry{key, std::move(unload)});
+    index.emplace(key, order.begin());
+    return order.begin();
+}
+
+void ModuleLru::EvictUnsafe(const void* keep, std::vector<Unloader>& evicted)
+{
+    if(budget == 0)
+        return;
+
+    for(auto it = order.end(); order.size() > budget && it != order.begin();)
+    {
+        --it;
+        if(it->pins != 0 || it->key == keep)
+            continue;
+        evicted.push_back(std::move(it->unload));
+        index.erase(it->key);
+        it = order.erase(it);
+    }
+}
+
+void ModuleLru::Unload(std::vector<Unloader>& evicted) const
+{
+    if(!evicted.empty())
+        MIOPEN_LOG_I2("Evicting " << evicted.size() << " module(s), budget: " << budget);
+
+    for(auto& unloader : evicted)
+    {
+        if(unloader)
+            unloader();
+    }
+}
+
+void ModuleLru::Touch(const void* key, Unloader unload)
+{
+    std::vector<Unloader> evicted;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        TouchUnsafe(key, unload);
+        EvictUnsafe(key, evicted);
+    }
+
+    Unload(evicted);
+}
+
+void ModuleLru::Pin(const void* key, Unloader unload)
+{
+    std::vector<Unloader> evicted;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++TouchUnsafe(key, unload)->pins;
+        EvictUnsafe(key, evicted);
+    }
+
+    Unload(evicted);
+}
+
+void ModuleLru::Unpin(const void* key)
+{
+    std::vector<Unloader> evicted;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto found = index.find(key);
+        if(found == index.end() || found->second->pins == 0)
+            return;
+        --found->second->pins;
+        EvictUnsafe(key, evicted);
+    }
+
+    Unload(evicted);
+}
+
+void ModuleLru::Forget(const void* key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto found = index.find(key);
+    if(found == index.end())
+        return;
+    order.erase(found->second);
+    index.erase(found);
+}
+
+std::size_t ModuleLru::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return order.size();
+}
+
+} // namespace miopen
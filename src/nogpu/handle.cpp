@@ -65,11 +65,26 @@ Handle::Handle(miopenAcceleratorQueue_t /* stream */) : Handle::Handle() {}
 
 Handle::Handle() : impl(new HandleImpl())
 {
+    this->impl->buffer_pool.SetAllocator(this->impl->allocator);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
 }
 
-Handle::~Handle() {}
+Handle::~Handle()
+{
+    if(!impl)
+        return;
+    // Report the deferred numerics checks of a batch that was not filled up.
+    // A destructor must not throw or abort, so the results are only logged.
+    try
+    {
+        flushNumericsChecks(*this, true);
+    }
+    catch(...)
+    {
+        MIOPEN_LOG_W("Unable to report the deferred numerics checks");
+    }
+}
 
 void Handle::SetStream(miopenAcceleratorQueue_t /* streamID */) const {}
 
@@ -90,6 +105,18 @@ float Handle::GetKernelTime() const { return this->impl->profiling_result; }
 
 Allocator::ManageDataPtr Handle::Create(std::size_t sz) const { return this->impl->allocator(sz); }
 
+Allocator::ManageDataPtr Handle::CreateTemporary(std::size_t sz) const
+{
+    return this->impl->buffer_pool.Acquire(sz, this->GetStream());
+}
+
+BufferPool& Handle::GetBufferPool() const { return this->impl->buffer_pool; }
+
+CheckNumericsMonitor& Handle::GetNumericsMonitor() const
+{
+    return this->impl->numerics_monitor;
+}
+
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* /* data */, Allocator::ManageDataPtr& ddata, std::size_t /* sz */) const
 {
@@ -28,7 +28,10 @@
 
 #include <miopen/algorithm.hpp>
 #include <miopen/conv_algo_name.hpp>
+#include <miopen/conv/applicability_index.hpp>
+#include <miopen/conv/find_refinement.hpp>
 #include <miopen/conv/solver_finders.hpp>
+#include <miopen/conv/tuning_queue.hpp>
 #include <miopen/check_numerics.hpp>
 #include <miopen/config.h>
 #include <miopen/db.hpp>
@@ -39,10 +42,13 @@
 #include <miopen/float_equal.hpp>
 #include <miopen/generic_search_controls.hpp>
 #include <miopen/invoker.hpp>
+#include <miopen/invoker_snapshot.hpp>
 #include <miopen/kernel.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/solution.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <miopen/tensor.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/util.hpp>
 #include <miopen/visit_float.hpp>
 #include <miopen/datatype.hpp>
@@ -54,7 +60,9 @@
 #include <miopen/conv/wrw_invoke_params.hpp>
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <functional>
 #include <type_traits>
 
@@ -92,8 +100,19 @@ static Invoker PrepareInvoker(ExecutionContext ctx,
     auto db           = GetDb(ctx);
     auto solution     = solver.FindSolution(ctx, problem, db, {}); // auto tune is not expected here
     auto& handle      = ctx.GetStream();
-    auto invoker = handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
-    const auto algo = AlgorithmName{solver_id.GetAlgo(problem.GetDirection())};
+    const auto record = env::enabled(MIOPEN_INVOKER_SNAPSHOT);
+    auto programs     = std::vector<Program>{};
+    auto invoker      = handle.PrepareInvoker(*solution.invoker_factory,
+                                              solution.construction_params,
+                                              record ? &programs : nullptr);
+    const auto algo   = AlgorithmName{solver_id.GetAlgo(problem.GetDirection())};
+
+    if(record)
+    {
+        const auto perf_cfg = solver.IsTunable() ? solver.GetPerfCfgParams(ctx, problem, db) : "";
+        InvokerSnapshot::Instance().Record(
+            handle, problem, solver_id, perf_cfg, programs, solution.construction_params);
+    }
 
     handle.RegisterInvoker(invoker, config, solver_id.ToString(), algo);
     return invoker;
@@ -140,12 +159,36 @@ static void ShrinkToFind10Results(std::vector<Solution>& found)
     found = std::move(out);
 }
 
+/// Whether the solver would still be applicable if deterministic results were requested.
+static bool IsDeterministic(const ExecutionContext& ctx,
+                            const conv::ProblemDescription& problem,
+                            solver::Id solver_id)
+{
+    if(problem.GetConv().attribute.deterministic)
+        return true;
+
+    auto conv = problem.GetConv();
+    conv.attribute.Set(MIOPEN_CONVOLUTION_ATTRIB_DETERMINISTIC, 1);
+    const auto deterministic_problem = conv::ProblemDescription{problem.GetIn(),
+                                                                problem.GetWeights(),
+                                                                problem.GetOut(),
+                                                                conv,
+                                                                problem.GetDirection(),
+                                                                problem.GetBias(),
+                                                                problem.GetAlpha(),
+                                                                problem.GetBeta()};
+    return solver_id.GetSolver().IsApplicable(ctx, deterministic_problem);
+}
+
 std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
                                       const conv::ProblemDescription& problem,
                                       const AnyInvokeParams& invoke_ctx,
                                       int requestAlgoCount,
-                                      bool force_attach_binary)
+                                      bool force_attach_binary,
+                                      const SelectionPolicy* policy)
 {
+    MIOPEN_TRACE_SCOPE("find", "FindConvolution");
+
     auto results         = std::vector<Solution>{};
     auto sol             = boost::optional<miopenConvSolution_t>{};
     const auto& conv     = problem.GetConv();
@@ -196,7 +239,22 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
             "MIOPEN_DEBUG_COMPILE_ONLY is enabled, escaping forward convolution. Search skipped.");
     }
 
-    ShrinkToFind10Results(results);
+    if(policy == nullptr && conv.selection_policy)
+        policy = &*conv.selection_policy;
+
+    if(policy != nullptr)
+    {
+        policy->Apply(results, [&](const Solution& solution) {
+            const auto solver_id = solution.GetSolver();
+            return SolutionCost{solution.GetTime(),
+                                solution.GetWorkspaceSize(),
+                                IsDeterministic(ctx, problem, solver_id)};
+        });
+    }
+    else
+    {
+        ShrinkToFind10Results(results);
+    }
     results.resize(std::min<std::size_t>(results.size(), requestAlgoCount));
 
     for(const auto& entry : results)
@@ -645,22 +703,18 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
             return 10.0f / wti; // Assume WTI == 1.0 (100%) is 10 ms.
         };
 
-        for(const auto& solver_id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+        // Applicability, workspace and WTI of every dynamic solver are memoized per problem.
+        for(const auto& applicable : conv::ApplicabilityIndex::Instance().Get(ctx, problem))
         {
-            // solver_id is always valid here, because taken from registry.
-            // Validity check is not required.
-            const auto algo = solver_id.GetAlgo();
+            const auto& solver_id = applicable.id;
+            const auto algo       = solver_id.GetAlgo();
             if(conv::IsAlgorithmDisabled(algo)) // Algos can be disabled globally.
                 continue;
-            const auto& s = solver_id.GetSolver();
-            // Let's allow non-dynamic later, if necessary.
-            if(s.IsEmpty() || !s.IsDynamic() || !s.IsApplicable(ctx, problem))
-                continue;
-            const auto ws = s.GetWorkspaceSize(ctx, problem);
+            const auto ws = applicable.workspace;
             if(!conv::IsEnoughWorkspace("GetSolutionsFallback WTI", solver_id, ws, invokeParams))
                 continue;
 
-            const auto wti = s.GetWti(ctx, problem);
+            const auto wti = applicable.wti;
             MIOPEN_LOG_I2(solver_id.ToString() << " Estimated WTI = " << wti);
             if(wti < 0.0f) // Skip unknown WTIs.
                 continue;
@@ -682,7 +736,8 @@ namespace {
 std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
                                                const conv::ProblemDescription& problem,
                                                const size_t maxSolutionCount,
-                                               const AnyInvokeParams* const invokeParams)
+                                               const AnyInvokeParams* const invokeParams,
+                                               bool& approximate)
 {
     auto algo_resolver = std::function<int(const std::string&)>{};
 
@@ -700,6 +755,10 @@ std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
     if(fdb_record.empty())
         return {};
 
+    // Times measured for another problem are reported as estimations, i.e. negative.
+    approximate       = fdb_record.IsApproximate();
+    const auto factor = approximate ? -1.0f : 1.0f;
+
     auto interim = std::vector<miopenConvSolution_t>{};
     interim.reserve(20); // Heuristic for speed.
 
@@ -720,8 +779,8 @@ std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
             continue;
         }
 
-        interim.emplace_back(
-            miopenConvSolution_t{pair.second.time, pair.second.workspace, solver_id.Value(), algo});
+        interim.emplace_back(miopenConvSolution_t{
+            factor * pair.second.time, pair.second.workspace, solver_id.Value(), algo});
     }
 
     /// Non-zero InvokeParams means that this function is used in Find to optimize host-side
@@ -739,6 +798,33 @@ std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
     /// MIIR compiler, which is very slow.
     ///
     /// The loop below does all the above at once.
+    if(const auto& policy = problem.GetConv().selection_policy)
+    {
+        // The whole front is needed, so all the solutions are checked.
+        interim.erase(std::remove_if(begin(interim),
+                                     end(interim),
+                                     [&](const auto& s) {
+                                         const auto solver_id = solver::Id{s.solution_id};
+                                         return !solver_id.GetSolver().IsApplicable(ctx, problem) ||
+                                                !conv::IsEnoughWorkspace("GetSolutions",
+                                                                         solver_id,
+                                                                         s.workspace_size,
+                                                                         invokeParams);
+                                     }),
+                      end(interim));
+        policy->Apply(interim, [&](const miopenConvSolution_t& s) {
+            return SolutionCost{std::abs(s.time),
+                                s.workspace_size,
+                                IsDeterministic(ctx, problem, solver::Id{s.solution_id})};
+        });
+        interim.resize(std::min(interim.size(), maxSolutionCount));
+
+        for(const auto& s : interim)
+            MIOPEN_LOG_I2(s);
+
+        return interim;
+    }
+
     std::sort(begin(interim), end(interim), SolutionTimeComparator{});
     auto out = std::vector<miopenConvSolution_t>{};
     out.reserve(maxSolutionCount);
@@ -775,10 +861,28 @@ ConvolutionDescriptor::GetSolutions(const ExecutionContext& ctx,
                                     const AnyInvokeParams* const invokeParams) const
 {
     MIOPEN_LOG_I("");
-    auto solutions = miopen::GetSolutions(ctx, problem, maxSolutionCount, invokeParams);
+    auto approximate = false;
+    auto solutions =
+        miopen::GetSolutions(ctx, problem, maxSolutionCount, invokeParams, approximate);
+
+    if(approximate && !env::disabled(MIOPEN_DEBUG_FIND_DB_REFINEMENT))
+        conv::FindRefinement::Instance().Enqueue(problem);
+
+    // Find calls this with invoke params and records the measured results itself.
+    if(invokeParams == nullptr && env::enabled(MIOPEN_BACKGROUND_TUNING))
+    {
+        auto& tuning_queue = conv::TuningQueue::Instance();
+        tuning_queue.NotifyActivity();
+        if(solutions.empty())
+            tuning_queue.Enqueue(problem);
+    }
+
+    if(solutions.empty())
+        MIOPEN_METRICS_COUNT("immediate.fallbacks");
 
+    // Hybrid Find modes run Normal Find rather than trusting records of other problems.
     if(fallbackPathTaken != nullptr)
-        *fallbackPathTaken = solutions.empty();
+        *fallbackPathTaken = solutions.empty() || approximate;
 
     if(!solutions.empty())
         return solutions;
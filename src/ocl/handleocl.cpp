@@ -35,6 +35,7 @@
 #include <miopen/kernel_cache.hpp>
 #include <miopen/load_file.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 #include <miopen/manage_ptr.hpp>
 #include <miopen/ocldeviceinfo.hpp>
 #include <miopen/timer.hpp>
@@ -79,10 +80,12 @@ struct HandleImpl
     AqPtr queue         = nullptr;
     cl_device_id device = nullptr; // NOLINT
     Allocator allocator{};
+    BufferPool buffer_pool;
     KernelCache cache;
     bool enable_profiling  = false;
     float profiling_result = 0.0;
     TargetProperties target_properties;
+    CheckNumericsMonitor numerics_monitor;
 
     std::string get_device_name() const
     {
@@ -265,7 +268,22 @@ Handle::Handle() : impl(new HandleImpl())
 }
 
 Handle::Handle(Handle&&) noexcept = default;
-Handle::~Handle()                 = default;
+
+Handle::~Handle()
+{
+    if(!impl)
+        return;
+    // Report the deferred numerics checks of a batch that was not filled up.
+    // A destructor must not throw or abort, so the results are only logged.
+    try
+    {
+        flushNumericsChecks(*this, true);
+    }
+    catch(...)
+    {
+        MIOPEN_LOG_W("Unable to report the deferred numerics checks");
+    }
+}
 
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 {
@@ -301,6 +319,7 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
 
     this->impl->allocator.context =
         allocatorContext == nullptr ? this->impl->context.get() : allocatorContext;
+    this->impl->buffer_pool.SetAllocator(this->impl->allocator);
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -401,12 +420,15 @@ Program Handle::LoadProgram(const std::string& program_name,
     if(hsaco.empty())
     {
         CompileTimer ct;
-        auto p = miopen::LoadProgram(miopen::GetContext(this->GetStream()),
-                                     miopen::GetDevice(this->GetStream()),
-                                     this->GetTargetProperties(),
-                                     program_name,
-                                     params,
-                                     kernel_src);
+        auto p = [&]() {
+            MIOPEN_METRICS_LATENCY_OF("Compile");
+            return miopen::LoadProgram(miopen::GetContext(this->GetStream()),
+                                       miopen::GetDevice(this->GetStream()),
+                                       this->GetTargetProperties(),
+                                       program_name,
+                                       params,
+                                       kernel_src);
+        }();
         ct.Log("Kernel", program_name);
 
 // Save to cache
@@ -515,6 +537,18 @@ Allocator::ManageDataPtr Handle::Create(std::size_t sz) const
     return this->impl->allocator(sz);
 }
 
+Allocator::ManageDataPtr Handle::CreateTemporary(std::size_t sz) const
+{
+    return this->impl->buffer_pool.Acquire(sz, this->GetStream());
+}
+
+BufferPool& Handle::GetBufferPool() const { return this->impl->buffer_pool; }
+
+CheckNumericsMonitor& Handle::GetNumericsMonitor() const
+{
+    return this->impl->numerics_monitor;
+}
+
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const
 {
@@ -47,6 +47,7 @@
 #include <miopen/solution.hpp>
 #include <miopen/search_options.hpp>
 #include <miopen/tensor_ops.hpp>
+#include <miopen/trace.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -134,6 +135,7 @@ static Data_t AllocateTensor(Handle& handle,
     if((id & miopenTensorArgumentIsScalar) == miopenTensorArgumentIsScalar)
         return &owned_scalars.emplace_back(0);
 
+    // Find buffers are large and allocated once, so they bypass the handle's buffer pool
     const auto element_size = get_data_size(descriptor.GetType());
     auto buffer             = handle.Create(descriptor.GetElementSpace() * element_size);
 
@@ -144,6 +146,14 @@ static Data_t AllocateTensor(Handle& handle,
 
 static void SortFindResults(const FindOptions& options, std::vector<Solution>& results)
 {
+    if(options.selection_policy)
+    {
+        options.selection_policy->Apply(results, [](const Solution& solution) {
+            return SolutionCost{solution.GetTime(), solution.GetWorkspaceSize(), true};
+        });
+        return;
+    }
+
     std::sort(results.begin(),
               results.end(),
               [&]() -> std::function<bool(const Solution&, const Solution&)> {
@@ -163,6 +173,8 @@ static void SortFindResults(const FindOptions& options, std::vector<Solution>& r
 std::vector<Solution>
 Problem::FindSolutions(Handle& handle, const FindOptions& options, std::size_t max_solutions) const
 {
+    MIOPEN_TRACE_SCOPE("find", "Problem::FindSolutions");
+
     auto owned_buffers = std::vector<Allocator::ManageDataPtr>{};
     auto owned_scalars = std::vector<std::uint64_t>{};
     auto buffers       = std::unordered_map<miopenTensorArgumentId_t, Data_t>{};
@@ -203,7 +215,12 @@ Problem::FindSolutions(Handle& handle, const FindOptions& options, std::size_t m
         operator_descriptor);
 
     owned_buffers.resize(0);
-    SortFindResults(options, ret);
+
+    // Convolutions apply the selection policy on their own, as only they tell deterministic
+    // solutions apart.
+    if(!options.selection_policy ||
+       !std::holds_alternative<ConvolutionDescriptor>(operator_descriptor))
+        SortFindResults(options, ret);
     return ret;
 }
 
@@ -513,8 +530,9 @@ std::vector<Solution> Problem::FindSolutionsImpl(Handle& handle,
     const auto invoke_ctx =
         MakeConvInvokeParams(x_desc, x, w_desc, w, y_desc, y, workspace, workspace_size);
 
-    auto results =
-        FindConvolution(ctx, conv_problem, invoke_ctx, max_solutions, options.attach_binaries);
+    const auto policy = options.selection_policy ? &*options.selection_policy : nullptr;
+    auto results      = FindConvolution(
+        ctx, conv_problem, invoke_ctx, max_solutions, options.attach_binaries, policy);
 
     for(auto& result : results)
     {
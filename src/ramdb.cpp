@@ -29,6 +29,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/metrics.hpp>
 
 #include <miopen/filesystem.hpp>
 
@@ -127,7 +128,25 @@ boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
         Prefetch();
     }
 
-    return FindRecordUnsafe(problem);
+    auto record = FindRecordUnsafe(problem);
+    metrics::CountDbLookup(db_kind, static_cast<bool>(record));
+    return record;
+}
+
+void RamDb::VisitRecords(
+    const std::function<void(const std::string& key, const std::string& contents)>& visitor)
+{
+    const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+
+    if(!ValidateUnsafe())
+    {
+        MIOPEN_LOG_I2("RamDb file is newer than cache, prefetching");
+        Prefetch();
+    }
+
+    for(const auto& [key, item] : cache)
+        visitor(key, item.content);
 }
 
 bool RamDb::StoreRecord(const DbRecord& record)
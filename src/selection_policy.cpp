@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/selection_policy.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace miopen {
+
+namespace {
+
+bool Dominates(const SolutionCost& l, const SolutionCost& r)
+{
+    const auto not_worse = l.time <= r.time && l.workspace <= r.workspace &&
+                           (l.deterministic || !r.deterministic);
+    const auto better =
+        l.time < r.time || l.workspace < r.workspace || (l.deterministic && !r.deterministic);
+    return not_worse && better;
+}
+
+} // namespace
+
+std::vector<std::size_t> SelectionPolicy::ParetoFront(const std::vector<SolutionCost>& costs)
+{
+    auto front = std::vector<std::size_t>{};
+
+    for(auto i = std::size_t{0}; i < costs.size(); ++i)
+    {
+        const auto dominated = std::any_of(costs.begin(), costs.end(), [&](const auto& other) {
+            return Dominates(other, costs[i]);
+        });
+        if(!dominated)
+            front.push_back(i);
+    }
+
+    return front;
+}
+
+std::vector<std::size_t> SelectionPolicy::Select(const std::vector<SolutionCost>& costs) const
+{
+    auto front = ParetoFront(costs);
+
+    auto keys = std::vector<double>(costs.size());
+    for(const auto i : front)
+        keys[i] = cost ? cost(costs[i]) : static_cast<double>(costs[i].time);
+
+    std::stable_sort(front.begin(), front.end(), [&](auto l, auto r) {
+        // NaN costs go last.
+        if(std::isnan(keys[r]))
+            return !std::isnan(keys[l]);
+        return keys[l] < keys[r];
+    });
+
+    return front;
+}
+
+std::optional<SelectionPolicy> MakeSelectionPolicy(miopenSolutionCostFunction_t cost,
+                                                   void* user_data)
+{
+    if(cost == nullptr)
+        return std::nullopt;
+
+    return SelectionPolicy{[=](const SolutionCost& solution) {
+        return cost(solution.time, solution.workspace, solution.deterministic ? 1 : 0, user_data);
+    }};
+}
+
+} // namespace miopen
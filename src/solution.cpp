@@ -731,18 +731,53 @@ struct SerializedSolutionKernelInfo
     }
 };
 
-void to_json(nlohmann::json& json, const Solution& solution)
+void Solution::SerializeMetadata(nlohmann::json& json) const
 {
     json = nlohmann::json{
         {fields::Header, Solution::SerializationMetadata::Current()},
-        {fields::Time, solution.time},
-        {fields::Workspace, solution.workspace_required},
-        {fields::Solver, solution.solver.ToString()},
-        {fields::Problem, solution.problem},
+        {fields::Time, time},
+        {fields::Workspace, workspace_required},
+        {fields::Solver, solver.ToString()},
+        {fields::Problem, problem},
     };
 
-    if(solution.perf_cfg.has_value())
-        json[fields::PerfCfg] = *solution.perf_cfg;
+    if(perf_cfg.has_value())
+        json[fields::PerfCfg] = *perf_cfg;
+}
+
+void Solution::DeserializeMetadata(const nlohmann::json& json)
+{
+    {
+        const auto header = json.at(fields::Header).get<Solution::SerializationMetadata>();
+        constexpr const auto check_header = Solution::SerializationMetadata::Current();
+
+        if(header.validation_number != check_header.validation_number)
+        {
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Invalid buffer has been passed to the solution deserialization.");
+        }
+        if(header.version != check_header.version)
+        {
+            MIOPEN_THROW(
+                miopenStatusVersionMismatch,
+                "Data from wrong version has been passed to the solution deserialization.");
+        }
+    }
+
+    json.at(fields::Time).get_to(time);
+    json.at(fields::Workspace).get_to(workspace_required);
+    solver = json.at(fields::Solver).get<std::string>();
+    json.at(fields::Problem).get_to(problem);
+
+    const auto perf_cfg_json = json.find(fields::PerfCfg);
+    perf_cfg                 = perf_cfg_json != json.end()
+                                   ? std::optional{perf_cfg_json->get<std::string>()}
+                                   : std::nullopt;
+}
+
+void to_json(nlohmann::json& json, const Solution& solution)
+{
+    solution.SerializeMetadata(json);
 
     if(solution.kernels.empty())
     {
@@ -832,32 +867,7 @@ void to_json(nlohmann::json& json, const Solution& solution)
 
 void from_json(const nlohmann::json& json, Solution& solution)
 {
-    {
-        const auto header = json.at(fields::Header).get<Solution::SerializationMetadata>();
-        constexpr const auto check_header = Solution::SerializationMetadata::Current();
-
-        if(header.validation_number != check_header.validation_number)
-        {
-            MIOPEN_THROW(miopenStatusInvalidValue,
-                         "Invalid buffer has been passed to the solution deserialization.");
-        }
-        if(header.version != check_header.version)
-        {
-            MIOPEN_THROW(
-                miopenStatusVersionMismatch,
-                "Data from wrong version has been passed to the solution deserialization.");
-        }
-    }
-
-    json.at(fields::Time).get_to(solution.time);
-    json.at(fields::Workspace).get_to(solution.workspace_required);
-    solution.solver = json.at(fields::Solver).get<std::string>();
-    json.at(fields::Problem).get_to(solution.problem);
-
-    const auto perf_cfg_json = json.find(fields::PerfCfg);
-    solution.perf_cfg        = perf_cfg_json != json.end()
-                                   ? std::optional{perf_cfg_json->get<std::string>()}
-                                   : std::nullopt;
+    solution.DeserializeMetadata(json);
 
     solution.kernels.clear();
     if(const auto binaries_json = json.find(fields::Binaries); binaries_json != json.end())
@@ -0,0 +1,453 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/solution_archive.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace miopen {
+namespace solution_archive {
+
+namespace {
+
+constexpr std::array<char, 8> Signature = {'M', 'I', 'O', 'P', 'S', 'O', 'L', '\0'};
+constexpr std::size_t MaxWorkDims       = 3;
+
+struct FileHeader
+{
+    std::array<char, 8> signature;
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t file_size;
+    std::uint64_t solution_count;
+    std::uint64_t solutions_offset;
+    std::uint64_t reserved[3];
+};
+
+struct SolutionEntry
+{
+    std::uint64_t metadata_offset;
+    std::uint64_t metadata_size;
+    std::uint64_t kernels_offset;
+    std::uint64_t kernel_count;
+    std::uint64_t programs_offset;
+    std::uint64_t program_count;
+};
+
+struct KernelEntry
+{
+    std::uint32_t program; // index into the program table of the solution
+    std::uint32_t local_dims;
+    std::uint32_t global_dims;
+    std::uint32_t reserved;
+    std::uint64_t local_work_dims[MaxWorkDims];
+    std::uint64_t global_work_dims[MaxWorkDims];
+    std::uint64_t name_offset;
+    std::uint64_t name_size;
+    std::uint64_t file_offset;
+    std::uint64_t file_size;
+};
+
+struct ProgramEntry
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+static_assert(sizeof(FileHeader) == 64);
+static_assert(sizeof(SolutionEntry) == 48);
+static_assert(sizeof(KernelEntry) == 96);
+static_assert(sizeof(ProgramEntry) == 16);
+
+std::size_t Align(std::size_t offset, std::size_t alignment = SectionAlignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+class Writer
+{
+public:
+    std::size_t Reserve(std::size_t size, std::size_t alignment = alignof(std::uint64_t))
+    {
+        const auto offset = Align(data.size(), alignment);
+        data.resize(offset + size);
+        return offset;
+    }
+
+    template <class T>
+    std::size_t ReserveTable(std::size_t count)
+    {
+        return Reserve(count * sizeof(T));
+    }
+
+    std::size_t Append(const void* bytes, std::size_t size, std::size_t alignment = 1)
+    {
+        const auto offset = Reserve(size, alignment);
+        if(size != 0)
+            std::memcpy(&data[offset], bytes, size);
+        return offset;
+    }
+
+    template <class T>
+    void Put(std::size_t offset, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::memcpy(&data[offset], &value, sizeof(T));
+    }
+
+    std::vector<std::uint8_t> data;
+};
+
+std::vector<char> ReadCodeObject(const Program& program)
+{
+    if(program.IsCodeObjectInMemory())
+        return program.GetCodeObjectBlob();
+
+    if(program.IsCodeObjectInFile())
+    {
+        const auto path = program.GetCodeObjectPathname();
+        auto file       = std::ifstream(path, std::ios::binary);
+        auto bytes      = std::vector<char>{std::istreambuf_iterator<char>{file}, {}};
+        if(!file.eof() && file.fail())
+            MIOPEN_THROW(miopenStatusInternalError, "Unable to read " + path.string());
+        return bytes;
+    }
+
+    MIOPEN_THROW(miopenStatusInvalidValue,
+                 "Subsequent serialization of a deserialized solution is not supported.");
+}
+
+std::uint32_t PutWorkDims(const std::vector<size_t>& dims, std::uint64_t (&out)[MaxWorkDims])
+{
+    if(dims.size() > MaxWorkDims)
+        MIOPEN_THROW(miopenStatusInternalError, "Unsupported number of work dimensions");
+    std::fill(std::begin(out), std::end(out), 0);
+    std::copy(dims.begin(), dims.end(), std::begin(out));
+    return static_cast<std::uint32_t>(dims.size());
+}
+
+class Reader
+{
+public:
+    Reader(const void* data_, std::size_t size_)
+        : data(static_cast<const std::uint8_t*>(data_)), size(size_)
+    {
+    }
+
+    const std::uint8_t* At(std::uint64_t offset, std::uint64_t length) const
+    {
+        if(offset > size || length > size - offset)
+            MIOPEN_THROW(miopenStatusInvalidValue, "Solution archive is truncated or corrupted.");
+        return data + offset;
+    }
+
+    template <class T>
+    T Get(std::uint64_t offset) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto value = T{};
+        std::memcpy(&value, At(offset, sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    template <class T>
+    std::uint64_t Table(std::uint64_t offset, std::uint64_t count) const
+    {
+        if(count > size / sizeof(T))
+            MIOPEN_THROW(miopenStatusInvalidValue, "Solution archive is truncated or corrupted.");
+        At(offset, count * sizeof(T));
+        return offset;
+    }
+
+    std::string String(std::uint64_t offset, std::uint64_t length) const
+    {
+        const auto chars = reinterpret_cast<const char*>(At(offset, length));
+        return {chars, chars + length};
+    }
+
+private:
+    const std::uint8_t* data;
+    std::size_t size;
+};
+
+FileHeader ReadHeader(const Reader& reader)
+{
+    const auto header = reader.Get<FileHeader>(0);
+    if(header.signature != Signature)
+        MIOPEN_THROW(miopenStatusInvalidValue, "The data is not a solution archive.");
+    if(header.version != Version)
+    {
+        MIOPEN_THROW(miopenStatusVersionMismatch,
+                     "Solution archive of version " + std::to_string(header.version) +
+                         " is not supported.");
+    }
+    return header;
+}
+
+std::vector<Solution::KernelInfo> ReadKernels(const Reader& reader, const SolutionEntry& entry)
+{
+    if(entry.kernel_count == 0)
+        return {};
+
+    // Validate the tables first, so a corrupted archive does not load modules.
+    const auto programs_offset =
+        reader.Table<ProgramEntry>(entry.programs_offset, entry.program_count);
+    const auto kernels_offset = reader.Table<KernelEntry>(entry.kernels_offset, entry.kernel_count);
+
+    auto entries = std::vector<KernelEntry>{};
+    entries.reserve(entry.kernel_count);
+    for(std::uint64_t i = 0; i < entry.kernel_count; ++i)
+    {
+        const auto kernel = reader.Get<KernelEntry>(kernels_offset + i * sizeof(KernelEntry));
+        if(kernel.program >= entry.program_count || kernel.local_dims > MaxWorkDims ||
+           kernel.global_dims > MaxWorkDims)
+        {
+            MIOPEN_THROW(miopenStatusInvalidValue, "Solution archive is corrupted.");
+        }
+        entries.push_back(kernel);
+    }
+
+    auto programs = std::vector<Program>{};
+    programs.reserve(entry.program_count);
+    for(std::uint64_t i = 0; i < entry.program_count; ++i)
+    {
+        const auto program = reader.Get<ProgramEntry>(programs_offset + i * sizeof(ProgramEntry));
+        const auto image   = reader.At(program.offset, program.size);
+        MIOPEN_LOG_I2("Loading code object from solution archive, " << program.size << " bytes");
+        programs.push_back(HIPOCProgram::FromImage("", image, program.size));
+    }
+
+    auto kernels = std::vector<Solution::KernelInfo>{};
+    kernels.reserve(entries.size());
+    for(const auto& kernel : entries)
+    {
+        const auto& local  = kernel.local_work_dims;
+        const auto& global = kernel.global_work_dims;
+
+        auto info             = Solution::KernelInfo{};
+        info.program          = programs[kernel.program];
+        info.local_work_dims  = {local, local + kernel.local_dims};
+        info.global_work_dims = {global, global + kernel.global_dims};
+        info.kernel_name      = reader.String(kernel.name_offset, kernel.name_size);
+        info.program_name     = reader.String(kernel.file_offset, kernel.file_size);
+        kernels.emplace_back(std::move(info));
+    }
+    return kernels;
+}
+
+template <class F>
+auto WithMapping(const fs::path& file, F&& f)
+{
+    if(!fs::exists(file))
+        MIOPEN_THROW(miopenStatusInvalidValue, file.string() + " does not exist");
+
+    namespace ipc      = boost::interprocess;
+    const auto mapping = ipc::file_mapping{file.string().c_str(), ipc::read_only};
+    const auto region  = ipc::mapped_region{mapping, ipc::read_only};
+    return f(region.get_address(), region.get_size());
+}
+
+} // namespace
+
+bool IsArchive(const void* data, std::size_t size)
+{
+    return size >= sizeof(FileHeader) &&
+           std::memcmp(data, Signature.data(), Signature.size()) == 0;
+}
+
+std::vector<std::uint8_t> Write(const std::vector<const Solution*>& solutions)
+{
+    auto writer = Writer{};
+    writer.Reserve(sizeof(FileHeader));
+    const auto solutions_offset = writer.ReserveTable<SolutionEntry>(solutions.size());
+
+    // Code objects shared by several solutions are stored once.
+    auto programs = std::vector<std::pair<Program, ProgramEntry>>{};
+
+    for(std::size_t s = 0; s < solutions.size(); ++s)
+    {
+        const auto& solution = *solutions[s];
+        auto entry           = SolutionEntry{};
+
+        auto metadata_json = nlohmann::json{};
+        solution.SerializeMetadata(metadata_json);
+        const auto metadata   = nlohmann::json::to_msgpack(metadata_json);
+        entry.metadata_size   = metadata.size();
+        entry.metadata_offset = writer.Append(metadata.data(), metadata.size());
+
+        const auto& kernels = solution.GetKernels();
+        if(kernels.empty())
+        {
+            MIOPEN_LOG_I2("Solution lacks kernels information. This would slowdown the first "
+                          "miopenRunSolution call after miopenLoadSolution.");
+            writer.Put(solutions_offset + s * sizeof(SolutionEntry), entry);
+            continue;
+        }
+
+        auto local_programs = std::vector<std::pair<Program, ProgramEntry>>{};
+        auto kernel_entries = std::vector<KernelEntry>{};
+
+        for(const auto& kernel : kernels)
+        {
+            const auto same = [&](auto&& item) { return item.first == kernel.program; };
+            auto local      = std::find_if(local_programs.begin(), local_programs.end(), same);
+            if(local == local_programs.end())
+            {
+                auto known = std::find_if(programs.begin(), programs.end(), same);
+                if(known == programs.end())
+                {
+                    const auto binary = ReadCodeObject(kernel.program);
+                    auto program      = ProgramEntry{};
+                    program.size      = binary.size();
+                    program.offset = writer.Append(binary.data(), binary.size(), SectionAlignment);
+                    MIOPEN_LOG_I2("Serialized binary to solution archive, " << binary.size()
+                                                                            << " bytes");
+                    programs.emplace_back(kernel.program, program);
+                    known = std::prev(programs.end());
+                }
+                local_programs.push_back(*known);
+                local = std::prev(local_programs.end());
+            }
+
+            const auto& name = kernel.kernel_name;
+            const auto file  = kernel.program_name.string();
+
+            auto kernel_entry    = KernelEntry{};
+            kernel_entry.program = static_cast<std::uint32_t>(local - local_programs.begin());
+            kernel_entry.local_dims =
+                PutWorkDims(kernel.local_work_dims, kernel_entry.local_work_dims);
+            kernel_entry.global_dims =
+                PutWorkDims(kernel.global_work_dims, kernel_entry.global_work_dims);
+            kernel_entry.name_size   = name.size();
+            kernel_entry.name_offset = writer.Append(name.data(), name.size());
+            kernel_entry.file_size   = file.size();
+            kernel_entry.file_offset = writer.Append(file.data(), file.size());
+            kernel_entries.push_back(kernel_entry);
+        }
+
+        entry.kernel_count   = kernel_entries.size();
+        entry.kernels_offset = writer.ReserveTable<KernelEntry>(kernel_entries.size());
+        for(std::size_t k = 0; k < kernel_entries.size(); ++k)
+            writer.Put(entry.kernels_offset + k * sizeof(KernelEntry), kernel_entries[k]);
+
+        entry.program_count   = local_programs.size();
+        entry.programs_offset = writer.ReserveTable<ProgramEntry>(local_programs.size());
+        for(std::size_t p = 0; p < local_programs.size(); ++p)
+            writer.Put(entry.programs_offset + p * sizeof(ProgramEntry), local_programs[p].second);
+
+        writer.Put(solutions_offset + s * sizeof(SolutionEntry), entry);
+    }
+
+    auto header             = FileHeader{};
+    header.signature        = Signature;
+    header.version          = Version;
+    header.header_size      = sizeof(FileHeader);
+    header.file_size        = writer.data.size();
+    header.solution_count   = solutions.size();
+    header.solutions_offset = solutions_offset;
+    writer.Put(0, header);
+
+    return std::move(writer.data);
+}
+
+std::size_t Count(const void* data, std::size_t size)
+{
+    return ReadHeader(Reader{data, size}).solution_count;
+}
+
+std::vector<Solution> Read(const void* data, std::size_t size)
+{
+    const auto reader = Reader{data, size};
+    const auto header = ReadHeader(reader);
+    if(header.file_size != size)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Solution archive is truncated or corrupted.");
+
+    const auto solutions_offset =
+        reader.Table<SolutionEntry>(header.solutions_offset, header.solution_count);
+
+    auto solutions = std::vector<Solution>{};
+    solutions.reserve(header.solution_count);
+    for(std::uint64_t s = 0; s < header.solution_count; ++s)
+    {
+        const auto entry = reader.Get<SolutionEntry>(solutions_offset + s * sizeof(SolutionEntry));
+        const auto metadata = reader.At(entry.metadata_offset, entry.metadata_size);
+
+        auto solution = Solution{};
+        solution.DeserializeMetadata(
+            nlohmann::json::from_msgpack(metadata, metadata + entry.metadata_size));
+        solution.SetKernels(ReadKernels(reader, entry));
+        solutions.emplace_back(std::move(solution));
+    }
+    return solutions;
+}
+
+void Save(const std::vector<const Solution*>& solutions, const fs::path& file)
+{
+    const auto data = Write(solutions);
+
+    // Write next to the target and rename, so concurrent loads never see a partial archive.
+    auto tmp = file;
+    tmp += ".tmp";
+    {
+        auto stream = std::ofstream{tmp, std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+        if(!stream)
+            MIOPEN_THROW(miopenStatusInternalError, "Unable to write " + tmp.string());
+    }
+    fs::rename(tmp, file);
+
+    MIOPEN_LOG_I("Saved " << solutions.size() << " solutions to " << file);
+}
+
+std::vector<Solution> Load(const fs::path& file)
+{
+    auto solutions = WithMapping(file, [](auto data, auto size) { return Read(data, size); });
+    MIOPEN_LOG_I("Loaded " << solutions.size() << " solutions from " << file);
+    return solutions;
+}
+
+std::size_t Count(const fs::path& file)
+{
+    return WithMapping(file, [](auto data, auto size) { return Count(data, size); });
+}
+
+} // namespace solution_archive
+} // namespace miopen
@@ -54,6 +54,8 @@
 #include <miopen/timer.hpp>
 
 #include <boost/range/adaptor/transformed.hpp>
+#include <condition_variable>
+#include <mutex>
 #include <ostream>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_DEPRECATED_SOLVERS)
@@ -80,19 +82,71 @@ std::ostream& operator<<(std::ostream& os, const KernelInfo& k)
     return os << "} '" << k.comp_options << '\'';
 }
 
+namespace {
+
+/// Limits the number of kernels compiled at the same time by the whole process to
+/// MIOPEN_COMPILE_PARALLEL_LEVEL, as several solvers may precompile their kernels concurrently
+/// on the shared thread pool.
+class CompileSlot
+{
+public:
+    CompileSlot()
+    {
+        const auto limit = std::max<std::size_t>(GetTuningThreadsMax(), 1);
+        std::unique_lock<std::mutex> lock(mutex());
+        released().wait(lock, [&]() { return used() < limit; });
+        ++used();
+    }
+
+    ~CompileSlot()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex());
+            --used();
+        }
+        released().notify_all();
+    }
+
+    CompileSlot(const CompileSlot&) = delete;
+    CompileSlot& operator=(const CompileSlot&) = delete;
+
+private:
+    static std::mutex& mutex()
+    {
+        static std::mutex instance;
+        return instance;
+    }
+
+    static std::condition_variable& released()
+    {
+        static std::condition_variable instance;
+        return instance;
+    }
+
+    static std::size_t& used()
+    {
+        static std::size_t instance = 0;
+        return instance;
+    }
+};
+
+} // namespace
+
 std::vector<Program>
 PrecompileKernels(const Handle& h, const std::vector<KernelInfo>& kernels, bool force_attach_binary)
 {
     CompileTimer ct;
     std::vector<Program> programs(kernels.size());
 
+    // Kernels are handed out dynamically, as their compile times vary widely
     // clang-format off
-    par_for_strided(kernels.size(),
-                    max_threads{GetTuningThreadsMax()},
-                    [&](auto i) {
-                        const KernelInfo& k = kernels[i];
-                        programs[i]         = h.LoadProgram(k.kernel_file, k.comp_options, "", force_attach_binary);
-                    });
+    par_for(kernels.size(),
+            max_threads{GetTuningThreadsMax()},
+            [&](auto i) {
+                const CompileSlot slot;
+                const KernelInfo& k = kernels[i];
+                programs[i]         = h.LoadProgram(k.kernel_file, k.comp_options, "", force_attach_binary);
+            });
     // clang-format on
     ct.Log("PrecompileKernels");
     return programs;
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace miopen {
+
+namespace {
+
+// Identifies the pool worker running on the current thread, if any
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local std::size_t current_worker     = 0;
+
+/// Shared by the caller of ParallelFor and the helper tasks it queued.
+/// Helpers may start after the caller returned, they keep the state alive
+/// and then find no range left, so f is not touched anymore.
+struct ParallelForState
+{
+    ParallelForState(std::size_t n_, std::size_t grain_, const ThreadPool::Range& f_)
+        : n(n_), grain(grain_), ranges((n_ + grain_ - 1) / grain_), f(&f_)
+    {
+    }
+
+    const std::size_t n;
+    const std::size_t grain;
+    const std::size_t ranges;
+    const ThreadPool::Range* f;
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error; // guarded by mutex
+    std::mutex mutex;
+    std::condition_variable finished;
+
+    void Run()
+    {
+        for(auto r = next++; r < ranges; r = next++)
+        {
+            if(!failed)
+            {
+                try
+                {
+                    (*f)(r * grain, std::min(n, (r + 1) * grain));
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!error)
+                        error = std::current_exception();
+                    failed = true;
+                }
+            }
+
+            if(++done == ranges)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&]() { return done == ranges; });
+        if(error)
+            std::rethrow_exception(error);
+    }
+};
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t workers)
+{
+    queues.reserve(workers);
+    for(std::size_t i = 0; i < workers; ++i)
+        queues.emplace_back(std::make_unique<Queue>());
+
+    threads.reserve(workers);
+    for(std::size_t i = 0; i < workers; ++i)
+        threads.emplace_back([this, i]() { WorkerLoop(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    wakeup.notify_all();
+    for(auto& thread : threads)
+        thread.join();
+}
+
+ThreadPool& ThreadPool::Global()
+{
+    // The calling thread takes part in ParallelFor, so it is not counted
+    static ThreadPool pool{std::max<std::size_t>(std::thread::hardware_concurrency(), 1) - 1};
+    return pool;
+}
+
+std::future<void> ThreadPool::Submit(Task task)
+{
+    // std::function needs a copyable target
+    auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+    auto result   = packaged->get_future();
+    Enqueue([packaged]() { (*packaged)(); });
+    return result;
+}
+
+void ThreadPool::Enqueue(Task task)
+{
+    if(threads.empty())
+    {
+        task();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto idx = next_queue;
+    if(current_pool == this)
+        idx = current_worker;
+    else
+        next_queue = (next_queue + 1) % queues.size();
+    ++queued;
+    lock.unlock();
+
+    {
+        auto& queue = *queues[idx];
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    wakeup.notify_one();
+}
+
+bool ThreadPool::TryPop(Task& task)
+{
+    const auto self  = current_pool == this ? current_worker : 0;
+    const auto count = queues.size();
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        const auto idx = (self + i) % count;
+        auto& queue    = *queues[idx];
+        {
+            std::lock_guard<std::mutex> queue_lock(queue.mutex);
+            if(queue.tasks.empty())
+                continue;
+            // The owner takes its most recent task, thieves the oldest one
+            if(i == 0 && current_pool == this)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        --queued;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(std::size_t id)
+{
+    current_pool   = this;
+    current_worker = id;
+
+    for(;;)
+    {
+        Task task;
+        if(TryPop(task))
+        {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeup.wait(lock, [&]() { return stop || queued > 0; });
+        if(stop && queued == 0)
+            return;
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t n,
+                             std::size_t grain,
+                             std::size_t concurrency,
+                             const Range& f)
+{
+    if(n == 0)
+        return;
+
+    grain             = std::max<std::size_t>(grain, 1);
+    const auto ranges = (n + grain - 1) / grain;
+    concurrency       = std::min({concurrency, ranges, threads.size() + 1});
+
+    if(concurrency <= 1)
+    {
+        f(0, n);
+        return;
+    }
+
+    const auto state = std::make_shared<ParallelForState>(n, grain, f);
+    for(std::size_t i = 1; i < concurrency; ++i)
+        Enqueue([state]() { state->Run(); });
+
+    state->Run();
+    state->Wait();
+}
+
+} // namespace miopen
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/trace.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h> /* For SYS_xxx definitions */
+#endif
+
+/// File the Chrome trace is written to at exit. Tracing is disabled when empty.
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TRACE_FILE)
+/// Capacity of the per-thread ring buffers, older events are overwritten.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TRACE_BUFFER_EVENTS, 16384)
+
+namespace miopen {
+namespace trace {
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> enabled{false};
+
+namespace {
+
+int GetProcessId()
+{
+#ifdef __linux__
+    return ::getpid();
+#else
+    return 0; // Not implemented.
+#endif
+}
+
+int GetThreadId()
+{
+#ifdef __linux__
+    return syscall(SYS_gettid); // NOLINT
+#else
+    return 0; // Not implemented.
+#endif
+}
+
+/// Written only by the owning thread. head counts all events ever written and is published
+/// with release semantics after the slot is filled; the exporter reads it with acquire.
+struct ThreadBuffer
+{
+    explicit ThreadBuffer(std::size_t capacity)
+        : events(std::max<std::size_t>(capacity, 1)), tid(GetThreadId())
+    {
+    }
+
+    std::vector<Event> events;
+    std::atomic<std::uint64_t> head{0};
+    std::atomic<std::uint64_t> tail{0}; // Events before it have been cleared
+    int tid;
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    // Buffers outlive their threads, so events of finished threads are exported too.
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    static Registry& Instance()
+    {
+        static Registry instance;
+        return instance;
+    }
+};
+
+ThreadBuffer& LocalBuffer()
+{
+    thread_local const auto buffer = [] {
+        auto created = std::make_shared<ThreadBuffer>(env::value(MIOPEN_TRACE_BUFFER_EVENTS));
+        auto& registry = Registry::Instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+/// Enables tracing when MIOPEN_TRACE_FILE is set and writes the trace at exit.
+struct AtExit
+{
+    AtExit()
+    {
+        // Constructed before the registry is used, so the registry outlives it.
+        std::ignore = Registry::Instance();
+        if(!env::value(MIOPEN_TRACE_FILE).empty())
+            SetEnabled(true);
+    }
+
+    ~AtExit()
+    {
+        const auto& file = env::value(MIOPEN_TRACE_FILE);
+        if(file.empty())
+            return;
+        try
+        {
+            Export(fs::path{file});
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_E("Failed to write the trace to " << file << ": " << ex.what());
+        }
+    }
+};
+
+// NOLINTNEXTLINE (cert-err58-cpp)
+const AtExit at_exit;
+
+} // namespace
+
+void SetEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+
+std::uint64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void Record(const char* category, const char* name, std::uint64_t start_ns, std::string_view detail)
+{
+    const auto now = Now();
+    auto& buffer   = LocalBuffer();
+    const auto idx = buffer.head.load(std::memory_order_relaxed);
+    auto& event    = buffer.events[idx % buffer.events.size()];
+
+    event.category    = category;
+    event.name        = name;
+    event.start_ns    = start_ns;
+    event.duration_ns = now - start_ns;
+
+    const auto size = std::min(detail.size(), sizeof(event.detail) - 1);
+    std::memcpy(event.detail, detail.data(), size);
+    event.detail[size] = '\0';
+
+    buffer.head.store(idx + 1, std::memory_order_release);
+}
+
+void Export(std::ostream& stream)
+{
+    auto events    = nlohmann::json::array();
+    const auto pid = GetProcessId();
+
+    auto& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for(const auto& buffer : registry.buffers)
+    {
+        const auto head     = buffer->head.load(std::memory_order_acquire);
+        const auto capacity = buffer->events.size();
+        auto first          = buffer->tail.load(std::memory_order_relaxed);
+        if(head - first > capacity)
+            first = head - capacity;
+
+        for(auto i = first; i < head; ++i)
+        {
+            const auto& event = buffer->events[i % capacity];
+            auto json         = nlohmann::json{
+                {"name", event.name},
+                {"cat", event.category},
+                {"ph", "X"},
+                // Microseconds are the unit of the format
+                {"ts", static_cast<double>(event.start_ns) / 1000.},
+                {"dur", static_cast<double>(event.duration_ns) / 1000.},
+                {"pid", pid},
+                {"tid", buffer->tid},
+            };
+            if(event.detail[0] != '\0')
+                json["args"] = {{"detail", event.detail}};
+            events.push_back(std::move(json));
+        }
+    }
+
+    stream << nlohmann::json{{"traceEvents", std::move(events)}, {"displayTimeUnit", "ns"}};
+}
+
+void Export(const fs::path& file)
+{
+    auto stream = std::ofstream{file};
+    if(!stream)
+        MIOPEN_THROW("Unable to open " + file);
+    Export(stream);
+}
+
+void Clear()
+{
+    auto& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for(const auto& buffer : registry.buffers)
+        buffer->tail.store(buffer->head.load(std::memory_order_acquire),
+                           std::memory_order_relaxed);
+}
+
+} // namespace trace
+} // namespace miopen
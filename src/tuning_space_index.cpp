@@ -0,0 +1,219 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tuning_space_index.hpp>
+
+#include <miopen/binary_cache.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+constexpr char magic[]          = {'M', 'I', 'O', 'T', 'S', 'I'};
+constexpr std::uint32_t version = 1;
+
+template <class T>
+void WritePod(std::ostream& stream, const T& value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <class T>
+bool ReadPod(std::istream& stream, T& value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+} // namespace
+
+void TuningSpaceHash::Add(std::string_view value)
+{
+    constexpr std::uint64_t prime = 0x100000001b3;
+    for(const auto c : value)
+        hash = (hash ^ static_cast<unsigned char>(c)) * prime;
+    // Terminate each value, so "1,2" + "3" differs from "1" + "2,3".
+    hash = (hash ^ 0xff) * prime;
+}
+
+std::string TuningSpaceHash::ToString() const
+{
+    std::ostringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return ss.str();
+}
+
+void TuningSpaceMask::Resize(std::size_t new_size)
+{
+    size = new_size;
+    bits.resize((new_size + 63) / 64);
+}
+
+std::size_t TuningSpaceMask::Count() const
+{
+    return std::accumulate(bits.begin(), bits.end(), std::size_t{0}, [](auto sum, auto word) {
+        return sum + std::bitset<64>{word}.count();
+    });
+}
+
+void TuningSpaceMask::Write(std::ostream& stream) const
+{
+    WritePod(stream, static_cast<std::uint8_t>(spare));
+    WritePod(stream, static_cast<std::uint64_t>(size));
+    stream.write(reinterpret_cast<const char*>(bits.data()),
+                 static_cast<std::streamsize>(bits.size() * sizeof(std::uint64_t)));
+}
+
+bool TuningSpaceMask::Read(std::istream& stream)
+{
+    auto spare_in = std::uint8_t{};
+    auto size_in  = std::uint64_t{};
+    if(!ReadPod(stream, spare_in) || !ReadPod(stream, size_in))
+        return false;
+
+    spare = spare_in != 0;
+    Resize(size_in);
+    return static_cast<bool>(
+        stream.read(reinterpret_cast<char*>(bits.data()),
+                    static_cast<std::streamsize>(bits.size() * sizeof(std::uint64_t))));
+}
+
+TuningSpaceIndex::TuningSpaceIndex(fs::path dir_) : dir(std::move(dir_)) {}
+
+TuningSpaceIndex& TuningSpaceIndex::Instance()
+{
+    static TuningSpaceIndex index{IsCacheDisabled() || GetCachePath(false).empty()
+                                      ? fs::path{}
+                                      : GetCachePath(false) / "tuning_space"};
+    return index;
+}
+
+fs::path TuningSpaceIndex::GetPath(const std::string& key) const
+{
+    if(dir.empty())
+        return {};
+    return dir / (md5(key) + ".tsi");
+}
+
+std::shared_ptr<const TuningSpaceMask> TuningSpaceIndex::Find(const std::string& key)
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        const auto it = masks.find(key);
+        if(it != masks.end())
+            return it->second;
+    }
+
+    const auto path = GetPath(key);
+    if(path.empty() || !fs::exists(path))
+        return nullptr;
+
+    std::ifstream file{path, std::ios::binary};
+    char magic_in[sizeof(magic)] = {};
+    auto version_in              = std::uint32_t{};
+    auto key_size                = std::uint64_t{};
+
+    file.read(magic_in, sizeof(magic_in));
+    if(!file || !std::equal(std::begin(magic), std::end(magic), magic_in) ||
+       !ReadPod(file, version_in) || version_in != version || !ReadPod(file, key_size))
+    {
+        MIOPEN_LOG_W("Ignoring malformed tuning space index: " << path);
+        return nullptr;
+    }
+
+    auto key_in = std::string(key_size, '\0');
+    auto mask   = std::make_shared<TuningSpaceMask>();
+    if(!file.read(key_in.data(), static_cast<std::streamsize>(key_size)) || key_in != key ||
+       !mask->Read(file))
+    {
+        MIOPEN_LOG_W("Ignoring malformed tuning space index: " << path);
+        return nullptr;
+    }
+
+    MIOPEN_LOG_I2("Tuning space index loaded: " << path);
+    const std::lock_guard<std::mutex> lock{mutex};
+    return masks.emplace(key, std::move(mask)).first->second;
+}
+
+void TuningSpaceIndex::Store(const std::string& key, TuningSpaceMask mask)
+{
+    const auto shared = std::make_shared<const TuningSpaceMask>(std::move(mask));
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        masks[key] = shared;
+    }
+
+    const auto path = GetPath(key);
+    if(path.empty())
+        return;
+
+    // Write to a unique file first, so concurrent processes never see a partial index.
+    const auto tmp_path = fs::path{path.string() + "." + std::to_string(std::random_device{}())};
+    try
+    {
+        fs::create_directories(path.parent_path());
+        {
+            std::ofstream file{tmp_path, std::ios::binary};
+            file.write(magic, sizeof(magic));
+            WritePod(file, version);
+            WritePod(file, static_cast<std::uint64_t>(key.size()));
+            file.write(key.data(), static_cast<std::streamsize>(key.size()));
+            shared->Write(file);
+            if(!file)
+                MIOPEN_THROW("Failed to write " + tmp_path.string());
+        }
+        fs::rename(tmp_path, path);
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to save tuning space index " << path << ": " << ex.what());
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+        boost::system::error_code error_code;
+#else
+        std::error_code error_code;
+#endif
+        fs::remove(tmp_path, error_code);
+    }
+}
+
+void TuningSpaceIndex::Clear()
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    masks.clear();
+}
+
+} // namespace solver
+} // namespace miopen
@@ -0,0 +1,212 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tuning_trace.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TUNING_TRACE_RECORD)
+
+namespace miopen {
+
+namespace {
+
+void WriteLine(std::ostream& stream, const TuningSampleKey& key, float time)
+{
+    stream << std::setprecision(std::numeric_limits<float>::max_digits10) << key.kind << '\t' << key.problem << '\t' << key.solver << '\t' << key.perf_cfg
+           << '\t' << time << '\n';
+}
+
+} // namespace
+
+TuningTrace* TuningTrace::Recorder()
+{
+    static TuningTrace* const recorder = []() -> TuningTrace* {
+        const auto& path = env::value(MIOPEN_TUNING_TRACE_RECORD);
+        if(path.empty())
+            return nullptr;
+        // Leaked, samples may be recorded until exit.
+        auto trace  = new TuningTrace{}; // NOLINT(cppcoreguidelines-owning-memory)
+        trace->file = path;
+        MIOPEN_LOG_I("Recording tuning measurements to " << path);
+        return trace;
+    }();
+    return recorder;
+}
+
+void TuningTrace::Record(const TuningSampleKey& key, float time)
+{
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    samples[key].times.push_back(time);
+    ++count;
+
+    if(!file.empty())
+    {
+        auto stream = std::ofstream{file, std::ios::app};
+        WriteLine(stream, key, time);
+        if(!stream)
+            MIOPEN_LOG_W("Unable to append a tuning measurement to " << file);
+    }
+}
+
+std::optional<float> TuningTrace::Next(const TuningSampleKey& key)
+{
+    const auto lock  = std::lock_guard<std::mutex>{mutex};
+    const auto found = samples.find(key);
+    if(found == samples.end())
+        return std::nullopt;
+
+    auto& entry      = found->second;
+    const auto time  = entry.times[entry.next];
+    entry.next       = (entry.next + 1) % entry.times.size();
+    return time;
+}
+
+std::size_t TuningTrace::Size() const
+{
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    return count;
+}
+
+void TuningTrace::Write(std::ostream& stream) const
+{
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    for(const auto& [key, entry] : samples)
+    {
+        for(const auto time : entry.times)
+            WriteLine(stream, key, time);
+    }
+}
+
+void TuningTrace::Read(std::istream& stream)
+{
+    auto line   = std::string{};
+    auto number = std::size_t{0};
+    while(std::getline(stream, line))
+    {
+        ++number;
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        auto fields = std::vector<std::string>{};
+        auto field  = std::string{};
+        auto ss     = std::istringstream{line};
+        while(std::getline(ss, field, '\t'))
+            fields.push_back(field);
+
+        auto time = 0.0f;
+        if(fields.size() != 5 || !(std::istringstream{fields[4]} >> time))
+        {
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Malformed tuning trace line " + std::to_string(number));
+        }
+
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        samples[{fields[0], fields[1], fields[2], fields[3]}].times.push_back(time);
+        ++count;
+    }
+}
+
+void TuningTrace::Save(const fs::path& path) const
+{
+    auto stream = std::ofstream{path};
+    Write(stream);
+    if(!stream)
+        MIOPEN_THROW(miopenStatusInternalError, "Unable to write " + path.string());
+}
+
+void TuningTrace::Load(const fs::path& path)
+{
+    auto stream = std::ifstream{path};
+    if(!stream)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Unable to read " + path.string());
+    Read(stream);
+    MIOPEN_LOG_I("Loaded " << Size() << " tuning measurements from " << path);
+}
+
+TuningReplayHandle::TuningReplayHandle(const fs::path& trace_file) { trace.Load(trace_file); }
+
+TuningTimeSource TuningReplayHandle::GetTimeSource() const
+{
+    return [this](const TuningSampleKey& key) {
+        if(const auto time = trace.Next(key))
+            return *time;
+        MIOPEN_THROW(miopenStatusInvalidValue,
+                     "No recorded time for " + key.kind + " of " + key.solver + " (" +
+                         key.perf_cfg + ") on " + key.problem);
+    };
+}
+
+TuningMeasurement::TuningMeasurement(const Handle& handle_,
+                                     std::string kind,
+                                     std::string problem,
+                                     TuningTimeSource time_source_)
+    : handle(handle_), time_source(std::move(time_source_))
+{
+    if(!time_source)
+    {
+        if(const auto replay = dynamic_cast<const TuningReplayHandle*>(&handle))
+            time_source = replay->GetTimeSource();
+    }
+    recorder    = time_source ? nullptr : TuningTrace::Recorder();
+    key.kind    = std::move(kind);
+    key.problem = std::move(problem);
+}
+
+void TuningMeasurement::Select(std::string solver, std::string perf_cfg)
+{
+    key.solver   = std::move(solver);
+    key.perf_cfg = std::move(perf_cfg);
+}
+
+Invoker TuningMeasurement::Prepare(const InvokerFactory& factory,
+                                   const std::vector<solver::KernelInfo>& kernels,
+                                   std::vector<Program>* programs_out) const
+{
+    if(time_source)
+        return {};
+    return handle.PrepareInvoker(factory, kernels, programs_out);
+}
+
+float TuningMeasurement::Run(const Invoker& invoker, const AnyInvokeParams& params) const
+{
+    if(time_source)
+        return time_source(key);
+
+    invoker(handle, params);
+    const auto time = handle.GetKernelTime();
+    if(recorder != nullptr)
+        recorder->Record(key, time);
+    return time;
+}
+
+} // namespace miopen
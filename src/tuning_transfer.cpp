@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tuning_transfer.hpp>
+
+#include <miopen/execution_context.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/packed_values.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/readonlyramdb.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+std::vector<std::string_view> Split(std::string_view s, char separator)
+{
+    auto parts = std::vector<std::string_view>{};
+    for(std::size_t begin = 0;;)
+    {
+        const auto end = s.find(separator, begin);
+        parts.push_back(s.substr(begin, end == std::string_view::npos ? end : end - begin));
+        if(end == std::string_view::npos)
+            return parts;
+        begin = end + 1;
+    }
+}
+
+/// Looks for ID:VALUES among the contents of a record, i.e. ID:VALUES{;ID:VALUES}.
+std::optional<std::string> FindValues(std::string_view contents, std::string_view id)
+{
+    for(const auto pair : Split(contents, ';'))
+    {
+        const auto colon = pair.find(':');
+        if(colon == std::string_view::npos || pair.substr(0, colon) != id)
+            continue;
+
+        const auto values = pair.substr(colon + 1);
+        auto text         = std::string{};
+        if(!serialize::IsPacked(values))
+            return std::string{values};
+        if(serialize::UnpackToText(values, text))
+            return text;
+        return std::nullopt;
+    }
+    return std::nullopt;
+}
+
+struct Neighbour
+{
+    double distance;
+    std::string values;
+};
+
+class NeighbourSet
+{
+public:
+    NeighbourSet(const PerfDbKeyDistance& distance_, const std::string& solver_id_)
+        : distance(distance_), solver_id(solver_id_)
+    {
+    }
+
+    void Add(const std::string& key, std::string_view contents)
+    {
+        const auto d = distance(key);
+        if(d < 0)
+            return;
+        if(auto values = FindValues(contents, solver_id))
+            found[key] = {d, std::move(*values)};
+    }
+
+    /// Distinct values of the k nearest problems.
+    std::vector<std::string> Nearest(std::size_t k) const
+    {
+        auto sorted = std::vector<std::pair<std::string, Neighbour>>(found.begin(), found.end());
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return std::tie(a.second.distance, a.first) < std::tie(b.second.distance, b.first);
+        });
+
+        auto nearest = std::vector<std::string>{};
+        for(auto& [key, neighbour] : sorted)
+        {
+            if(nearest.size() == k)
+                break;
+            if(std::find(nearest.begin(), nearest.end(), neighbour.values) != nearest.end())
+                continue;
+            MIOPEN_LOG_I2("Tuned neighbour " << key << ", distance " << neighbour.distance << ": "
+                                             << neighbour.values);
+            nearest.push_back(std::move(neighbour.values));
+        }
+        return nearest;
+    }
+
+private:
+    const PerfDbKeyDistance& distance;
+    const std::string& solver_id;
+    std::unordered_map<std::string, Neighbour> found;
+};
+
+} // namespace
+
+std::vector<std::string> FindTunedNeighbours(const ExecutionContext& ctx,
+                                             const PerfDbKeyDistance& distance,
+                                             const std::string& solver_id,
+                                             std::size_t k)
+{
+    auto neighbours = NeighbourSet{distance, solver_id};
+
+#if !(MIOPEN_ENABLE_SQLITE && MIOPEN_USE_SQLITE_PERFDB)
+    // The system db goes first, so the values of the user db win for the same key.
+    const auto& system_db = ReadonlyRamDb::GetCached(DbKinds::PerfDb, ctx.GetPerfDbPath(), false);
+    for(const auto& [key, item] : system_db.GetCacheMap())
+        neighbours.Add(key, item.content);
+
+    const auto user_db = ctx.GetUserPerfDbPath();
+    if(!user_db.empty() && fs::exists(user_db))
+    {
+        // Read under the file lock, so records being written by another process are not seen
+        // half done.
+        auto& db = RamDb::GetCached(DbKinds::PerfDb, user_db, false);
+        db.VisitRecords([&](const std::string& key, const std::string& contents) {
+            neighbours.Add(key, contents);
+        });
+    }
+#else
+    std::ignore = ctx;
+#endif
+
+    return neighbours.Nearest(k);
+}
+
+std::vector<std::size_t> SeedOrder(const std::vector<std::string>& configs,
+                                   const std::vector<std::string>& seeds)
+{
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+    auto seed_fields = std::vector<std::vector<std::string_view>>{};
+    for(const auto& seed : seeds)
+        seed_fields.push_back(Split(seed, ','));
+
+    // The rank of each config: index of the matching seed, seeds.size() for the neighbourhood.
+    auto ranks = std::vector<std::size_t>(configs.size(), none);
+    for(std::size_t i = 0; i < configs.size(); ++i)
+    {
+        const auto fields = Split(configs[i], ',');
+        for(std::size_t j = 0; j < seeds.size() && ranks[i] > j; ++j)
+        {
+            if(fields.size() != seed_fields[j].size())
+                continue;
+            const auto differ = std::inner_product(fields.begin(),
+                                                   fields.end(),
+                                                   seed_fields[j].begin(),
+                                                   std::size_t{0},
+                                                   std::plus<>{},
+                                                   std::not_equal_to<>{});
+            if(differ == 0)
+                ranks[i] = j;
+            else if(differ == 1)
+                ranks[i] = std::min(ranks[i], seeds.size());
+        }
+    }
+
+    auto order = std::vector<std::size_t>(configs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(), order.end(), [&](auto a, auto b) { return ranks[a] < ranks[b]; });
+    return order;
+}
+
+} // namespace solver
+} // namespace miopen
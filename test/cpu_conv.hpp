@@ -36,6 +36,7 @@
 #include <miopen/tensor.hpp>
 #include <utility>
 
+#include "cpu_conv_gemm.hpp"
 #include "tensor_holder.hpp"
 #include <miopen/stringutils.hpp>
 #include <miopen/functional.hpp>
@@ -375,6 +376,94 @@ void cpu_convolution_backward_weight_impl(const tensor<Tin>& in,
         });
 }
 
+// im2col + GEMM where the layout allows it, the direct loops otherwise
+template <std::size_t ConvDim,
+          typename Tacc,
+          typename FI,
+          typename FW,
+          typename Tin,
+          typename Twei,
+          typename Tout,
+          typename Range>
+void cpu_convolution_forward_gemm(const tensor<Tin>& in,
+                                  const tensor<Twei>& wei,
+                                  tensor<Tout>& out,
+                                  const Range& pads,
+                                  const Range& strides,
+                                  const Range& dilations,
+                                  std::size_t group_count,
+                                  FI fi,
+                                  FW fw)
+{
+    if(!cpu_conv_gemm::is_applicable(ConvDim, in, wei, out))
+    {
+        cpu_convolution_forward_impl<ConvDim, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fw);
+        return;
+    }
+    const cpu_conv_gemm::geometry<ConvDim> geo{
+        in, wei, out, pads, strides, dilations, group_count};
+    cpu_conv_gemm::forward<Tacc>(geo, in, wei, out, fi, fw);
+}
+
+template <std::size_t ConvDim,
+          typename Tacc,
+          typename FW,
+          typename FO,
+          typename Tin,
+          typename Twei,
+          typename Tout,
+          typename Range>
+void cpu_convolution_backward_data_gemm(tensor<Tin>& in,
+                                        const tensor<Twei>& wei,
+                                        const tensor<Tout>& out,
+                                        const Range& pads,
+                                        const Range& strides,
+                                        const Range& dilations,
+                                        std::size_t group_count,
+                                        FW fw,
+                                        FO fo)
+{
+    if(!cpu_conv_gemm::is_applicable(ConvDim, in, wei, out))
+    {
+        cpu_convolution_backward_data_impl<ConvDim, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fw, fo);
+        return;
+    }
+    const cpu_conv_gemm::geometry<ConvDim> geo{
+        in, wei, out, pads, strides, dilations, group_count};
+    cpu_conv_gemm::backward_data<Tacc>(geo, in, wei, out, fw, fo);
+}
+
+template <std::size_t ConvDim,
+          typename Tacc,
+          typename FI,
+          typename FO,
+          typename Tin,
+          typename Twei,
+          typename Tout,
+          typename Range>
+void cpu_convolution_backward_weight_gemm(const tensor<Tin>& in,
+                                          tensor<Twei>& wei,
+                                          const tensor<Tout>& out,
+                                          const Range& pads,
+                                          const Range& strides,
+                                          const Range& dilations,
+                                          std::size_t group_count,
+                                          FI fi,
+                                          FO fo)
+{
+    if(!cpu_conv_gemm::is_applicable(ConvDim, in, wei, out))
+    {
+        cpu_convolution_backward_weight_impl<ConvDim, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fo);
+        return;
+    }
+    const cpu_conv_gemm::geometry<ConvDim> geo{
+        in, wei, out, pads, strides, dilations, group_count};
+    cpu_conv_gemm::backward_weights<Tacc>(geo, in, wei, out, fi, fo);
+}
+
 template <typename Tin,
           typename Twei,
           typename Tout,
@@ -396,22 +485,22 @@ void cpu_convolution_forward(std::size_t spatial_dim,
     switch(spatial_dim)
     {
     case 1: {
-        cpu_convolution_forward_impl<1, Tacc>(
+        cpu_convolution_forward_gemm<1, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fw);
         break;
     }
     case 2: {
-        cpu_convolution_forward_impl<2, Tacc>(
+        cpu_convolution_forward_gemm<2, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fw);
         break;
     }
     case 3: {
-        cpu_convolution_forward_impl<3, Tacc>(
+        cpu_convolution_forward_gemm<3, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fw);
         break;
     }
     case 4: {
-        cpu_convolution_forward_impl<4, Tacc>(
+        cpu_convolution_forward_gemm<4, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fw);
         break;
     }
@@ -442,22 +531,22 @@ void cpu_convolution_backward_data(std::size_t spatial_dim,
     switch(spatial_dim)
     {
     case 1: {
-        cpu_convolution_backward_data_impl<1, Tacc>(
+        cpu_convolution_backward_data_gemm<1, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fw, fo);
         break;
     }
     case 2: {
-        cpu_convolution_backward_data_impl<2, Tacc>(
+        cpu_convolution_backward_data_gemm<2, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fw, fo);
         break;
     }
     case 3: {
-        cpu_convolution_backward_data_impl<3, Tacc>(
+        cpu_convolution_backward_data_gemm<3, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fw, fo);
         break;
     }
     case 4: {
-        cpu_convolution_backward_data_impl<4, Tacc>(
+        cpu_convolution_backward_data_gemm<4, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fw, fo);
         break;
     }
@@ -488,22 +577,22 @@ void cpu_convolution_backward_weight(std::size_t spatial_dim,
     switch(spatial_dim)
     {
     case 1: {
-        cpu_convolution_backward_weight_impl<1, Tacc>(
+        cpu_convolution_backward_weight_gemm<1, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fo);
         break;
     }
     case 2: {
-        cpu_convolution_backward_weight_impl<2, Tacc>(
+        cpu_convolution_backward_weight_gemm<2, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fo);
         break;
     }
     case 3: {
-        cpu_convolution_backward_weight_impl<3, Tacc>(
+        cpu_convolution_backward_weight_gemm<3, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fo);
         break;
     }
     case 4: {
-        cpu_convolution_backward_weight_impl<4, Tacc>(
+        cpu_convolution_backward_weight_gemm<4, Tacc>(
             in, wei, out, pads, strides, dilations, group_count, fi, fo);
         break;
     }
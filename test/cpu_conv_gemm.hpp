@@ -0,0 +1,476 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_CONV_GEMM_HPP
+#define GUARD_CPU_CONV_GEMM_HPP
+
+#include "ford.hpp"
+#include "tensor_holder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// im2col + blocked GEMM implementation of the CPU reference convolution.
+///
+/// Operands are converted to the accumulator type once while they are packed
+/// into row-major panels, so the GEMM inner loop runs over contiguous memory
+/// and is left to the compiler to vectorize. The output spatial dimension is
+/// processed in chunks to bound the size of the column buffer, which keeps
+/// large 3D problems in memory.
+///
+/// Work is split either across (batch, group) pairs, when there are enough of
+/// them to keep all threads busy, or across the tiles of each GEMM.
+namespace cpu_conv_gemm {
+
+// Elements of the accumulator type per column buffer
+constexpr std::size_t chunk_budget = std::size_t{1} << 21;
+
+constexpr std::size_t tile_m = 32;
+constexpr std::size_t tile_n = 256;
+constexpr std::size_t tile_k = 128;
+
+inline std::size_t num_threads()
+{
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+template <class F>
+void maybe_par_for(std::size_t n, bool parallel, F f)
+{
+    if(parallel && n > 1)
+    {
+        par_for(n, miopen::min_grain{1}, f);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            f(i);
+    }
+}
+
+/// C[m x n] += A[m x k] * B[k x n], all row-major and densely packed
+template <class Tacc>
+void gemm(std::size_t m,
+          std::size_t n,
+          std::size_t k,
+          const Tacc* a,
+          const Tacc* b,
+          Tacc* c,
+          bool parallel)
+{
+    const auto tiles_m = (m + tile_m - 1) / tile_m;
+    const auto tiles_n = (n + tile_n - 1) / tile_n;
+
+    maybe_par_for(tiles_m * tiles_n, parallel, [&](std::size_t tile) {
+        const auto i0 = (tile / tiles_n) * tile_m;
+        const auto j0 = (tile % tiles_n) * tile_n;
+        const auto i1 = std::min(m, i0 + tile_m);
+        const auto nj = std::min(n, j0 + tile_n) - j0;
+
+        for(std::size_t k0 = 0; k0 < k; k0 += tile_k)
+        {
+            const auto k1 = std::min(k, k0 + tile_k);
+            for(auto i = i0; i < i1; ++i)
+            {
+                Tacc* c_row = c + i * n + j0;
+                for(auto kk = k0; kk < k1; ++kk)
+                {
+                    const Tacc a_ik   = a[i * k + kk];
+                    const Tacc* b_row = b + kk * n + j0;
+                    for(std::size_t j = 0; j < nj; ++j)
+                        c_row[j] += a_ik * b_row[j];
+                }
+            }
+        }
+    });
+}
+
+template <std::size_t ConvDim>
+struct geometry
+{
+    std::size_t n       = 0;
+    std::size_t groups  = 0;
+    std::size_t c       = 0; // per group
+    std::size_t k       = 0; // per group
+    std::size_t in_sp   = 1;
+    std::size_t wei_sp  = 1;
+    std::size_t out_sp  = 1;
+    std::size_t chunk   = 1;
+    std::array<std::size_t, ConvDim> in_len{};
+    std::array<std::size_t, ConvDim> wei_len{};
+    std::array<std::size_t, ConvDim> out_len{};
+    // strides of the n, c and spatial dimensions of each tensor
+    std::array<std::size_t, ConvDim + 2> in_str{};
+    std::array<std::size_t, ConvDim + 2> wei_str{};
+    std::array<std::size_t, ConvDim + 2> out_str{};
+    // per filter tap: offset from the scaled output position (dilation - pad)
+    std::vector<std::array<std::ptrdiff_t, ConvDim>> taps;
+    std::array<std::ptrdiff_t, ConvDim> conv_strides{};
+
+    template <class Tin, class Twei, class Tout, class Range>
+    geometry(const tensor<Tin>& in,
+             const tensor<Twei>& wei,
+             const tensor<Tout>& out,
+             const Range& pads,
+             const Range& strides,
+             const Range& dilations,
+             std::size_t group_count)
+    {
+        const auto& wei_lens = wei.desc.GetLengths();
+        n                    = in.desc.GetLengths()[0];
+        groups               = group_count;
+        c                    = wei_lens[1];
+        k                    = wei_lens[0] / group_count;
+
+        std::copy_n(in.desc.GetLengths().begin() + 2, ConvDim, in_len.begin());
+        std::copy_n(wei_lens.begin() + 2, ConvDim, wei_len.begin());
+        std::copy_n(out.desc.GetLengths().begin() + 2, ConvDim, out_len.begin());
+        std::copy_n(in.desc.GetStrides().begin(), ConvDim + 2, in_str.begin());
+        std::copy_n(wei.desc.GetStrides().begin(), ConvDim + 2, wei_str.begin());
+        std::copy_n(out.desc.GetStrides().begin(), ConvDim + 2, out_str.begin());
+
+        for(std::size_t i = 0; i < ConvDim; ++i)
+        {
+            in_sp *= in_len[i];
+            wei_sp *= wei_len[i];
+            out_sp *= out_len[i];
+            conv_strides[i] = static_cast<std::ptrdiff_t>(strides[i]);
+        }
+
+        taps.resize(wei_sp);
+        for(std::size_t r = 0; r < wei_sp; ++r)
+        {
+            auto rem = r;
+            for(std::size_t i = ConvDim; i-- > 0;)
+            {
+                const auto idx = static_cast<std::ptrdiff_t>(rem % wei_len[i]);
+                rem /= wei_len[i];
+                taps[r][i] = idx * static_cast<std::ptrdiff_t>(dilations[i]) -
+                             static_cast<std::ptrdiff_t>(pads[i]);
+            }
+        }
+
+        const auto rows = std::max<std::size_t>({c * wei_sp, k, 1});
+        chunk           = std::max<std::size_t>(std::min(chunk_budget / rows, out_sp), 1);
+    }
+
+    /// Scaled input coordinates of output positions [p0, p0 + np)
+    std::vector<std::array<std::ptrdiff_t, ConvDim>> out_coords(std::size_t p0,
+                                                                std::size_t np) const
+    {
+        std::vector<std::array<std::ptrdiff_t, ConvDim>> coords(np);
+        for(std::size_t p = 0; p < np; ++p)
+        {
+            auto rem = p0 + p;
+            for(std::size_t i = ConvDim; i-- > 0;)
+            {
+                coords[p][i] = static_cast<std::ptrdiff_t>(rem % out_len[i]) * conv_strides[i];
+                rem /= out_len[i];
+            }
+        }
+        return coords;
+    }
+
+    /// Offset of the input element read by tap r at the given output
+    /// coordinates, or -1 when it falls into the padding
+    std::ptrdiff_t in_offset(const std::array<std::ptrdiff_t, ConvDim>& coord, std::size_t r) const
+    {
+        std::ptrdiff_t offset = 0;
+        for(std::size_t i = 0; i < ConvDim; ++i)
+        {
+            const auto x = coord[i] + taps[r][i];
+            if(x < 0 || x >= static_cast<std::ptrdiff_t>(in_len[i]))
+                return -1;
+            offset += x * static_cast<std::ptrdiff_t>(in_str[i + 2]);
+        }
+        return offset;
+    }
+
+    std::size_t spatial_offset(std::size_t p,
+                               const std::array<std::size_t, ConvDim>& len,
+                               const std::array<std::size_t, ConvDim + 2>& str) const
+    {
+        std::size_t offset = 0;
+        for(std::size_t i = ConvDim; i-- > 0;)
+        {
+            offset += (p % len[i]) * str[i + 2];
+            p /= len[i];
+        }
+        return offset;
+    }
+
+    std::size_t wei_offset(std::size_t k_id, std::size_t c_id, std::size_t r) const
+    {
+        return k_id * wei_str[0] + c_id * wei_str[1] + spatial_offset(r, wei_len, wei_str);
+    }
+
+    /// (batch, group) pairs are worth spreading across threads
+    bool parallel_jobs() const { return n * groups >= num_threads(); }
+};
+
+/// col[(c * R + r) * np + p] or, if transposed, col[p * (C * R) + c * R + r]
+template <class Tacc, std::size_t ConvDim, class Tin, class FI>
+void im2col(const geometry<ConvDim>& geo,
+            const tensor<Tin>& in,
+            std::size_t n_id,
+            std::size_t g_id,
+            std::size_t p0,
+            std::size_t np,
+            bool transposed,
+            bool parallel,
+            Tacc* col,
+            FI fi)
+{
+    const auto coords = geo.out_coords(p0, np);
+    const auto rows   = geo.c * geo.wei_sp;
+
+    maybe_par_for(rows, parallel, [&](std::size_t row) {
+        const auto c_id = row / geo.wei_sp;
+        const auto r    = row % geo.wei_sp;
+        const auto base = n_id * geo.in_str[0] + (g_id * geo.c + c_id) * geo.in_str[1];
+
+        for(std::size_t p = 0; p < np; ++p)
+        {
+            const auto offset = geo.in_offset(coords[p], r);
+            const auto value =
+                offset < 0 ? Tacc{0} : static_cast<Tacc>(fi(in.data[base + offset]));
+            col[transposed ? p * rows + row : row * np + p] = value;
+        }
+    });
+}
+
+/// Output gradient or result panel: out[(k, p)] for one (batch, group) pair
+template <class Tacc, std::size_t ConvDim, class Tout, class FO>
+void pack_out(const geometry<ConvDim>& geo,
+              const tensor<Tout>& out,
+              std::size_t n_id,
+              std::size_t g_id,
+              std::size_t p0,
+              std::size_t np,
+              Tacc* panel,
+              FO fo)
+{
+    for(std::size_t k_id = 0; k_id < geo.k; ++k_id)
+    {
+        const auto base = n_id * geo.out_str[0] + (g_id * geo.k + k_id) * geo.out_str[1];
+        for(std::size_t p = 0; p < np; ++p)
+        {
+            const auto offset = geo.spatial_offset(p0 + p, geo.out_len, geo.out_str);
+            panel[k_id * np + p] = static_cast<Tacc>(fo(out.data[base + offset]));
+        }
+    }
+}
+
+template <class Tacc, std::size_t ConvDim, class Tin, class Twei, class Tout, class FI, class FW>
+void forward(const geometry<ConvDim>& geo,
+             const tensor<Tin>& in,
+             const tensor<Twei>& wei,
+             tensor<Tout>& out,
+             FI fi,
+             FW fw)
+{
+    const auto rows     = geo.c * geo.wei_sp;
+    const bool par_jobs = geo.parallel_jobs();
+
+    // [g][k][c * R + r]
+    std::vector<Tacc> weights(geo.groups * geo.k * rows);
+    par_for(geo.groups * geo.k, [&](std::size_t gk) {
+        for(std::size_t row = 0; row < rows; ++row)
+        {
+            const auto offset = geo.wei_offset(gk, row / geo.wei_sp, row % geo.wei_sp);
+            weights[gk * rows + row] = static_cast<Tacc>(fw(wei.data[offset]));
+        }
+    });
+
+    maybe_par_for(geo.n * geo.groups, par_jobs, [&](std::size_t job) {
+        const auto n_id = job / geo.groups;
+        const auto g_id = job % geo.groups;
+        std::vector<Tacc> col(rows * geo.chunk);
+        std::vector<Tacc> result(geo.k * geo.chunk);
+
+        for(std::size_t p0 = 0; p0 < geo.out_sp; p0 += geo.chunk)
+        {
+            const auto np = std::min(geo.chunk, geo.out_sp - p0);
+            im2col(geo, in, n_id, g_id, p0, np, false, !par_jobs, col.data(), fi);
+            std::fill_n(result.begin(), geo.k * np, Tacc{0});
+            gemm(geo.k,
+                 np,
+                 rows,
+                 weights.data() + g_id * geo.k * rows,
+                 col.data(),
+                 result.data(),
+                 !par_jobs);
+
+            for(std::size_t k_id = 0; k_id < geo.k; ++k_id)
+            {
+                const auto base = n_id * geo.out_str[0] + (g_id * geo.k + k_id) * geo.out_str[1];
+                for(std::size_t p = 0; p < np; ++p)
+                {
+                    const auto offset = geo.spatial_offset(p0 + p, geo.out_len, geo.out_str);
+                    out.data[base + offset] = static_cast<Tout>(result[k_id * np + p]);
+                }
+            }
+        }
+    });
+}
+
+template <class Tacc, std::size_t ConvDim, class Tin, class Twei, class Tout, class FW, class FO>
+void backward_data(const geometry<ConvDim>& geo,
+                   tensor<Tin>& in,
+                   const tensor<Twei>& wei,
+                   const tensor<Tout>& out,
+                   FW fw,
+                   FO fo)
+{
+    const auto rows     = geo.c * geo.wei_sp;
+    const bool par_jobs = geo.parallel_jobs();
+
+    // [g][c * R + r][k], i.e. the transposed filters
+    std::vector<Tacc> weights(geo.groups * rows * geo.k);
+    par_for(geo.groups * geo.k, [&](std::size_t gk) {
+        const auto g_id = gk / geo.k;
+        const auto k_id = gk % geo.k;
+        for(std::size_t row = 0; row < rows; ++row)
+        {
+            const auto offset = geo.wei_offset(gk, row / geo.wei_sp, row % geo.wei_sp);
+            weights[(g_id * rows + row) * geo.k + k_id] = static_cast<Tacc>(fw(wei.data[offset]));
+        }
+    });
+
+    maybe_par_for(geo.n * geo.groups, par_jobs, [&](std::size_t job) {
+        const auto n_id = job / geo.groups;
+        const auto g_id = job % geo.groups;
+        std::vector<Tacc> panel(geo.k * geo.chunk);
+        std::vector<Tacc> col(rows * geo.chunk);
+        std::vector<Tacc> grad(geo.c * geo.in_sp, Tacc{0});
+
+        for(std::size_t p0 = 0; p0 < geo.out_sp; p0 += geo.chunk)
+        {
+            const auto np = std::min(geo.chunk, geo.out_sp - p0);
+            pack_out(geo, out, n_id, g_id, p0, np, panel.data(), fo);
+            std::fill_n(col.begin(), rows * np, Tacc{0});
+            gemm(rows,
+                 np,
+                 geo.k,
+                 weights.data() + g_id * rows * geo.k,
+                 panel.data(),
+                 col.data(),
+                 !par_jobs);
+
+            // col2im, every channel owns its own plane of grad
+            const auto coords = geo.out_coords(p0, np);
+            maybe_par_for(geo.c, !par_jobs, [&](std::size_t c_id) {
+                Tacc* plane = grad.data() + c_id * geo.in_sp;
+                for(std::size_t r = 0; r < geo.wei_sp; ++r)
+                {
+                    const Tacc* src = col.data() + (c_id * geo.wei_sp + r) * np;
+                    for(std::size_t p = 0; p < np; ++p)
+                    {
+                        std::size_t x = 0;
+                        bool inside   = true;
+                        for(std::size_t i = 0; i < ConvDim && inside; ++i)
+                        {
+                            const auto xi = coords[p][i] + geo.taps[r][i];
+                            inside = xi >= 0 && xi < static_cast<std::ptrdiff_t>(geo.in_len[i]);
+                            x      = x * geo.in_len[i] + static_cast<std::size_t>(xi);
+                        }
+                        if(inside)
+                            plane[x] += src[p];
+                    }
+                }
+            });
+        }
+
+        for(std::size_t c_id = 0; c_id < geo.c; ++c_id)
+        {
+            const auto base = n_id * geo.in_str[0] + (g_id * geo.c + c_id) * geo.in_str[1];
+            for(std::size_t x = 0; x < geo.in_sp; ++x)
+            {
+                const auto offset      = geo.spatial_offset(x, geo.in_len, geo.in_str);
+                in.data[base + offset] = static_cast<Tin>(grad[c_id * geo.in_sp + x]);
+            }
+        }
+    });
+}
+
+template <class Tacc, std::size_t ConvDim, class Tin, class Twei, class Tout, class FI, class FO>
+void backward_weights(const geometry<ConvDim>& geo,
+                      const tensor<Tin>& in,
+                      tensor<Twei>& wei,
+                      const tensor<Tout>& out,
+                      FI fi,
+                      FO fo)
+{
+    const auto rows       = geo.c * geo.wei_sp;
+    const bool par_groups = geo.groups >= num_threads();
+
+    maybe_par_for(geo.groups, par_groups, [&](std::size_t g_id) {
+        std::vector<Tacc> panel(geo.k * geo.chunk);
+        std::vector<Tacc> col(geo.chunk * rows);
+        std::vector<Tacc> grad(geo.k * rows, Tacc{0});
+
+        for(std::size_t n_id = 0; n_id < geo.n; ++n_id)
+        {
+            for(std::size_t p0 = 0; p0 < geo.out_sp; p0 += geo.chunk)
+            {
+                const auto np = std::min(geo.chunk, geo.out_sp - p0);
+                pack_out(geo, out, n_id, g_id, p0, np, panel.data(), fo);
+                im2col(geo, in, n_id, g_id, p0, np, true, !par_groups, col.data(), fi);
+                gemm(geo.k, rows, np, panel.data(), col.data(), grad.data(), !par_groups);
+            }
+        }
+
+        for(std::size_t k_id = 0; k_id < geo.k; ++k_id)
+        {
+            for(std::size_t row = 0; row < rows; ++row)
+            {
+                const auto offset =
+                    geo.wei_offset(g_id * geo.k + k_id, row / geo.wei_sp, row % geo.wei_sp);
+                wei.data[offset] = static_cast<Twei>(grad[k_id * rows + row]);
+            }
+        }
+    });
+}
+
+/// The GEMM path covers plain (non-vectorized) tensors with the KCHW-style
+/// filter layout; everything else goes through the direct loops
+template <class Tin, class Twei, class Tout>
+bool is_applicable(std::size_t conv_dim,
+                   const tensor<Tin>& in,
+                   const tensor<Twei>& wei,
+                   const tensor<Tout>& out)
+{
+    return in.desc.GetNumDims() == conv_dim + 2 && wei.desc.GetNumDims() == conv_dim + 2 &&
+           out.desc.GetNumDims() == conv_dim + 2 && in.desc.GetVectorLength() == 1 &&
+           wei.desc.GetVectorLength() == 1 && out.desc.GetVectorLength() == 1 &&
+           wei.desc.GetLayout_str() != "CHWNc";
+}
+
+} // namespace cpu_conv_gemm
+
+#endif
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/buffer_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <set>
+
+namespace {
+
+/// Host memory stand-in for the device allocator
+struct MockAllocator
+{
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+    std::size_t fail_next     = 0;
+    std::set<void*> live;
+
+    static void* Allocate(void* context, std::size_t sz)
+    {
+        auto& self = *static_cast<MockAllocator*>(context);
+        if(self.fail_next > 0)
+        {
+            --self.fail_next;
+            return nullptr;
+        }
+        void* ptr = std::malloc(sz); // NOLINT (cppcoreguidelines-no-malloc)
+        self.live.insert(ptr);
+        ++self.allocations;
+        return ptr;
+    }
+
+    static void Deallocate(void* context, void* ptr)
+    {
+        auto& self = *static_cast<MockAllocator*>(context);
+        EXPECT_EQ(self.live.erase(ptr), 1);
+        ++self.deallocations;
+        std::free(ptr); // NOLINT (cppcoreguidelines-no-malloc)
+    }
+
+    miopen::Allocator Get() { return {&Allocate, &Deallocate, this}; }
+};
+
+char stream_a = 0;
+char stream_b = 0;
+
+} // namespace
+
+TEST(CPU_BufferPool_NONE, SizeClasses)
+{
+    using miopen::BufferPool;
+    EXPECT_EQ(BufferPool::GetSizeClass(1), 512);
+    EXPECT_EQ(BufferPool::GetSizeClass(512), 512);
+    EXPECT_EQ(BufferPool::GetSizeClass(513), 1024);
+    EXPECT_EQ(BufferPool::GetSizeClass(1000 * 1000), 1024 * 1024);
+    EXPECT_EQ(BufferPool::GetSizeClass(1024 * 1024 + 1), 1024 * 1024 + 128 * 1024);
+
+    for(std::size_t sz = 1; sz < (std::size_t{1} << 32); sz = sz * 3 + 1)
+    {
+        const auto size_class = BufferPool::GetSizeClass(sz);
+        EXPECT_GE(size_class, sz);
+        if(sz > 1024 * 1024)
+            EXPECT_LE(size_class - sz, sz / 8);
+    }
+}
+
+TEST(CPU_BufferPool_NONE, ReusesOnSameStream)
+{
+    MockAllocator mock;
+    miopen::BufferPool pool(1024 * 1024);
+    pool.SetAllocator(mock.Get());
+
+    void* first = nullptr;
+    {
+        auto buf = pool.Acquire(1000, &stream_a);
+        first    = buf.get();
+        ASSERT_NE(first, nullptr);
+        EXPECT_EQ(pool.GetStats().bytes_in_use, 1024);
+    }
+    EXPECT_EQ(pool.GetStats().bytes_cached, 1024);
+
+    {
+        auto buf = pool.Acquire(700, &stream_a);
+        EXPECT_EQ(buf.get(), first);
+    }
+    {
+        auto buf = pool.Acquire(700, &stream_b);
+        EXPECT_NE(buf.get(), first);
+    }
+
+    const auto stats = pool.GetStats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.blocks_in_use, 0);
+    EXPECT_EQ(stats.blocks_cached, 2);
+    EXPECT_EQ(stats.peak_bytes, 2048);
+    EXPECT_EQ(mock.allocations, 2);
+    EXPECT_EQ(mock.deallocations, 0);
+}
+
+TEST(CPU_BufferPool_NONE, HighWatermark)
+{
+    MockAllocator mock;
+    miopen::BufferPool pool(2048);
+    pool.SetAllocator(mock.Get());
+
+    {
+        auto b1 = pool.Acquire(1024, &stream_a);
+        auto b2 = pool.Acquire(1024, &stream_a);
+        auto b3 = pool.Acquire(1024, &stream_a);
+    }
+    EXPECT_EQ(pool.GetStats().bytes_cached, 2048);
+    EXPECT_EQ(pool.GetStats().releases, 1);
+    EXPECT_EQ(mock.deallocations, 1);
+
+    pool.SetHighWatermark(0);
+    EXPECT_EQ(pool.GetStats().bytes_cached, 0);
+    EXPECT_EQ(mock.deallocations, 3);
+
+    // nothing is cached anymore
+    pool.Acquire(1024, &stream_a);
+    EXPECT_EQ(mock.allocations, 4);
+    EXPECT_EQ(mock.deallocations, 4);
+}
+
+TEST(CPU_BufferPool_NONE, SetAllocatorDropsCache)
+{
+    MockAllocator mock1;
+    MockAllocator mock2;
+    miopen::BufferPool pool(1024 * 1024);
+    pool.SetAllocator(mock1.Get());
+
+    auto outstanding = pool.Acquire(4096, &stream_a);
+    pool.Acquire(4096, &stream_a);
+    EXPECT_EQ(pool.GetStats().blocks_cached, 1);
+
+    pool.SetAllocator(mock2.Get());
+    EXPECT_EQ(pool.GetStats().blocks_cached, 0);
+    EXPECT_EQ(mock1.deallocations, 1);
+
+    pool.Acquire(4096, &stream_a);
+    EXPECT_EQ(mock2.allocations, 1);
+
+    // a block goes back to the allocator it came from
+    outstanding.reset();
+    pool.Trim();
+    EXPECT_TRUE(mock1.live.empty());
+    EXPECT_TRUE(mock2.live.empty());
+}
+
+TEST(CPU_BufferPool_NONE, RetriesAfterTrim)
+{
+    MockAllocator mock;
+    miopen::BufferPool pool(1024 * 1024);
+    pool.SetAllocator(mock.Get());
+
+    pool.Acquire(4096, &stream_b);
+    EXPECT_EQ(pool.GetStats().blocks_cached, 1);
+
+    mock.fail_next = 1;
+    auto buf       = pool.Acquire(4096, &stream_a);
+    EXPECT_NE(buf.get(), nullptr);
+    EXPECT_EQ(pool.GetStats().blocks_cached, 0);
+
+    mock.fail_next = 2;
+    EXPECT_ANY_THROW(pool.Acquire(4096, &stream_a));
+}
+
+TEST(CPU_BufferPool_NONE, ZeroSize)
+{
+    MockAllocator mock;
+    miopen::BufferPool pool(1024 * 1024);
+    pool.SetAllocator(mock.Get());
+
+    auto buf = pool.Acquire(0, &stream_a);
+    EXPECT_EQ(buf.get(), nullptr);
+    EXPECT_EQ(mock.allocations, 0);
+}
@@ -26,6 +26,7 @@
 
 #include <miopen/binary_cache.hpp>
 #include <miopen/bz2.hpp>
+#include <miopen/compile_stats.hpp>
 #include <miopen/kern_db.hpp>
 #include <miopen/temp_file.hpp>
 #include <algorithm>
@@ -133,6 +134,39 @@ TEST(CPU_Cache_NONE, check_kern_db)
         EXPECT_TRUE(err_db.RemoveRecordUnsafe(cfg0));
     }
 }
+
+TEST(CPU_Cache_NONE, check_compile_stats_db)
+{
+    miopen::CompileStat stat;
+    stat.kernel_name = "MIOpenConv1x1.s";
+    stat.kernel_args = "-Wa,-defsym,stride=1 -mcpu=gfx90a";
+    stat.backend     = "comgr";
+    stat.arch        = "gfx90a";
+    stat.source_size = 4096;
+    stat.binary_size = 16384;
+    stat.duration_ms = 12.5f;
+
+    miopen::CompileStatsDb empty_db("", false);
+    EXPECT_FALSE(empty_db.StoreRecordUnsafe(stat));
+
+    miopen::TempFile temp_file("tmp-compile-stats");
+    miopen::CompileStatsDb db(temp_file, false);
+    EXPECT_TRUE(db.StoreRecordUnsafe(stat));
+    EXPECT_TRUE(db.StoreRecordUnsafe(stat)); // every build is a separate row
+
+    const auto rows = db.sql.Exec("SELECT * FROM compile_stats;");
+    ASSERT_EQ(rows.size(), 2);
+    for(auto row : rows)
+    {
+        EXPECT_EQ(row["kernel_name"], "MIOpenConv1x1.s");
+        EXPECT_EQ(row["kernel_args"], stat.kernel_args);
+        EXPECT_EQ(row["backend"], "comgr");
+        EXPECT_EQ(row["arch"], "gfx90a");
+        EXPECT_EQ(row["source_size"], "4096");
+        EXPECT_EQ(row["binary_size"], "16384");
+        EXPECT_EQ(row["duration_us"], "12500");
+    }
+}
 #endif
 
 TEST(CPU_Cache_NONE, check_cache_file)
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/check_numerics.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/tensor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using miopen::CheckNumerics;
+using miopen::CheckNumericsResult;
+using miopen::NumericsAggregator;
+
+namespace {
+
+CheckNumericsResult Clean(float absMax)
+{
+    auto result   = CheckNumericsResult{};
+    result.absMax = absMax;
+    return result;
+}
+
+} // namespace
+
+TEST(CPU_NumericsAggregator_NONE, SlotsFillUp)
+{
+    const auto desc  = miopen::TensorDescriptor{miopenFloat, {2, 3}};
+    auto aggregator  = NumericsAggregator{3};
+    const auto* data = reinterpret_cast<ConstData_t>(0x1000);
+
+    EXPECT_EQ(aggregator.Reserve(desc, data, true), 0);
+    EXPECT_EQ(aggregator.Reserve(desc, data, false), 1);
+    EXPECT_FALSE(aggregator.Full());
+    EXPECT_EQ(aggregator.Reserve(desc, data, false), 2);
+    EXPECT_TRUE(aggregator.Full());
+    EXPECT_THROW(aggregator.Reserve(desc, data, false), miopen::Exception);
+
+    const auto results = std::vector<CheckNumericsResult>{Clean(1.0f), Clean(4.0f), Clean(2.0f)};
+    EXPECT_EQ(aggregator.Collect(CheckNumerics::Deferred, results.data()), 0);
+    EXPECT_EQ(aggregator.Pending(), 0);
+    EXPECT_EQ(aggregator.Reserve(desc, data, true), 0);
+
+    EXPECT_THROW(NumericsAggregator{0}, miopen::Exception);
+}
+
+TEST(CPU_NumericsAggregator_NONE, SummaryAccumulatesBatches)
+{
+    const auto desc  = miopen::TensorDescriptor{miopenHalf, {8}};
+    auto aggregator  = NumericsAggregator{2};
+    const auto* data = reinterpret_cast<ConstData_t>(0x1000);
+
+    auto nan   = Clean(3.0f);
+    nan.hasNan = 1;
+    auto inf   = Clean(std::numeric_limits<float>::infinity());
+    inf.hasInf = 1;
+
+    aggregator.Reserve(desc, data, true);
+    aggregator.Reserve(desc, data, false);
+    auto results = std::vector<CheckNumericsResult>{Clean(5.0f), nan};
+    EXPECT_EQ(aggregator.Collect(CheckNumerics::Deferred, results.data()), 1);
+
+    aggregator.Reserve(desc, data, false);
+    results = {inf};
+    EXPECT_EQ(aggregator.Collect(CheckNumerics::Deferred, results.data()), 1);
+
+    const auto& summary = aggregator.Summary();
+    EXPECT_EQ(summary.checked, 3);
+    EXPECT_EQ(summary.abnormal, 2);
+    EXPECT_EQ(summary.nans, 1);
+    EXPECT_EQ(summary.infs, 1);
+    EXPECT_EQ(summary.absMax, std::numeric_limits<float>::infinity());
+}
+
+TEST(CPU_NumericsAggregator_NONE, ThrowsAfterTheWholeBatch)
+{
+    const auto desc  = miopen::TensorDescriptor{miopenFloat, {4}};
+    auto aggregator  = NumericsAggregator{2};
+    const auto* data = reinterpret_cast<ConstData_t>(0x1000);
+
+    auto inf   = Clean(1.0f);
+    inf.hasInf = 1;
+
+    aggregator.Reserve(desc, data, true);
+    aggregator.Reserve(desc, data, false);
+    const auto results = std::vector<CheckNumericsResult>{inf, Clean(7.0f)};
+    EXPECT_THROW(aggregator.Collect(CheckNumerics::Deferred | CheckNumerics::Throw, results.data()),
+                 miopen::Exception);
+
+    EXPECT_EQ(aggregator.Pending(), 0);
+    EXPECT_EQ(aggregator.Summary().checked, 2);
+    EXPECT_EQ(aggregator.Summary().abnormal, 1);
+    EXPECT_EQ(aggregator.Summary().absMax, 7.0f);
+}
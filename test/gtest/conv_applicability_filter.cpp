@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/applicability_filter.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/env.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using miopen::conv::ApplicabilityFilter;
+using miopen::conv::Direction;
+
+miopen::conv::ProblemDescription MakeProblem(miopenTensorLayout_t layout,
+                                             Direction direction,
+                                             int groups               = 1,
+                                             miopenDataType_t wei_type = miopenHalf)
+{
+    const auto is_3d   = layout == miopenTensorNCDHW || layout == miopenTensorNDHWC;
+    const auto spatial = std::vector<std::size_t>(is_3d ? 3 : 2, 8);
+
+    auto lens = [&](std::size_t n, std::size_t c) {
+        auto result = std::vector<std::size_t>{n, c};
+        result.insert(result.end(), spatial.begin(), spatial.end());
+        return result;
+    };
+
+    const auto zeros = std::vector<int>(spatial.size(), 0);
+    const auto ones  = std::vector<int>(spatial.size(), 1);
+    const auto conv  = miopen::ConvolutionDescriptor{zeros, ones, ones, zeros, groups};
+
+    return {miopen::TensorDescriptor{miopenHalf, layout, lens(2, 16)},
+            miopen::TensorDescriptor{wei_type, layout, lens(16, 16 / groups)},
+            miopen::TensorDescriptor{miopenHalf, layout, lens(2, 16)},
+            conv,
+            direction};
+}
+
+} // namespace
+
+TEST(CPU_ConvApplicabilityFilter_NONE, DefaultAcceptsAll)
+{
+    const auto filter = ApplicabilityFilter{};
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorNCHW, Direction::Forward)));
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorNDHWC, Direction::BackwardWeights, 4)));
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorCHWN, Direction::BackwardData)));
+    EXPECT_TRUE(
+        filter.Accepts(MakeProblem(miopenTensorNHWC, Direction::Forward, 1, miopenFloat8)));
+}
+
+TEST(CPU_ConvApplicabilityFilter_NONE, Direction)
+{
+    const auto filter = ApplicabilityFilter{}.ForDirection(Direction::BackwardData);
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorNCHW, Direction::BackwardData)));
+    EXPECT_FALSE(filter.Accepts(MakeProblem(miopenTensorNCHW, Direction::Forward)));
+    EXPECT_FALSE(filter.Accepts(MakeProblem(miopenTensorNCHW, Direction::BackwardWeights)));
+}
+
+TEST(CPU_ConvApplicabilityFilter_NONE, SpatialDimsAndLayouts)
+{
+    const auto filter = ApplicabilityFilter{}.ForSpatialDims(3).ForLayouts(
+        ApplicabilityFilter::LayoutDefault | ApplicabilityFilter::LayoutNHWC);
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorNCDHW, Direction::Forward)));
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorNDHWC, Direction::Forward)));
+    EXPECT_FALSE(filter.Accepts(MakeProblem(miopenTensorNCHW, Direction::Forward)));
+
+    const auto nhwc = ApplicabilityFilter{}.ForLayouts(ApplicabilityFilter::LayoutNHWC);
+    EXPECT_TRUE(nhwc.Accepts(MakeProblem(miopenTensorNHWC, Direction::Forward)));
+    EXPECT_FALSE(nhwc.Accepts(MakeProblem(miopenTensorNCHW, Direction::Forward)));
+    EXPECT_FALSE(nhwc.Accepts(MakeProblem(miopenTensorCHWN, Direction::Forward)));
+}
+
+TEST(CPU_ConvApplicabilityFilter_NONE, GroupsAndTypes)
+{
+    const auto filter = ApplicabilityFilter{}.NoGroups().NoMixedTypes();
+    EXPECT_TRUE(filter.Accepts(MakeProblem(miopenTensorNHWC, Direction::Forward)));
+    EXPECT_FALSE(filter.Accepts(MakeProblem(miopenTensorNHWC, Direction::Forward, 4)));
+    EXPECT_FALSE(
+        filter.Accepts(MakeProblem(miopenTensorNHWC, Direction::Forward, 1, miopenFloat8)));
+}
+
+TEST(CPU_ConvApplicabilityFilter_NONE, EnvUpdatesAreCounted)
+{
+    // The applicability index keys on this counter to drop results that
+    // depended on the previous environment.
+    const auto before = miopen::env::getUpdateCount();
+    miopen::env::setEnvironmentVariable("MIOPEN_TEST_APPLICABILITY_INDEX", "1");
+    miopen::env::clearEnvironmentVariable("MIOPEN_TEST_APPLICABILITY_INDEX");
+    EXPECT_EQ(miopen::env::getUpdateCount(), before + 2);
+}
@@ -0,0 +1,296 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "../cpu_conv.hpp"
+
+#include <miopen/logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Compares the im2col + GEMM reference convolution against the direct loops it replaced. Tensors
+// hold small integers, so the sums are exact in either accumulation order and the results have
+// to match bit for bit.
+
+namespace {
+
+enum class Layout
+{
+    Packed,       // NC[D]HW
+    ChannelsLast, // N[D]HWC
+    Padded,       // NC[D]HW with gaps after every dimension
+};
+
+struct ConvGemmCase
+{
+    std::vector<std::size_t> in;  // N, C, spatial...
+    std::vector<std::size_t> wei; // K, C / groups, spatial...
+    std::vector<int> pads;
+    std::vector<int> strides;
+    std::vector<int> dilations;
+    std::size_t groups;
+
+    std::size_t ConvDim() const { return in.size() - 2; }
+
+    std::vector<std::size_t> Out() const
+    {
+        auto out = std::vector<std::size_t>{in[0], wei[0]};
+        for(std::size_t i = 0; i < ConvDim(); ++i)
+        {
+            const auto filter = dilations[i] * (static_cast<int>(wei[i + 2]) - 1) + 1;
+            out.push_back((static_cast<int>(in[i + 2]) + 2 * pads[i] - filter) / strides[i] + 1);
+        }
+        return out;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const ConvGemmCase& c)
+    {
+        miopen::LogRange(os << "in ", c.in, "x");
+        miopen::LogRange(os << " wei ", c.wei, "x");
+        miopen::LogRange(os << " pad ", c.pads, "x");
+        miopen::LogRange(os << " stride ", c.strides, "x");
+        miopen::LogRange(os << " dilation ", c.dilations, "x");
+        return os << " groups " << c.groups;
+    }
+};
+
+std::vector<ConvGemmCase> ConvGemmCases()
+{
+    // clang-format off
+    return {
+        {{2, 6, 17},          {4, 3, 3},         {1},       {2},       {1},       2},
+        {{2, 8, 9, 11},       {6, 8, 3, 3},      {1, 1},    {1, 1},    {1, 1},    1},
+        {{3, 8, 14, 13},      {8, 2, 3, 2},      {2, 0},    {2, 3},    {2, 1},    4},
+        {{4, 16, 7, 7},       {8, 16, 1, 1},     {0, 0},    {2, 2},    {1, 1},    1},
+        {{2, 8, 10, 10},      {8, 1, 5, 5},      {2, 2},    {1, 1},    {1, 1},    8},
+        {{1, 4, 5, 5},        {4, 4, 3, 3},      {3, 3},    {1, 1},    {1, 1},    1},
+        {{2, 4, 6, 7, 8},     {6, 2, 3, 3, 3},   {1, 1, 1}, {1, 2, 1}, {1, 1, 2}, 2},
+        // The column buffer of this one exceeds cpu_conv_gemm::chunk_budget.
+        {{1, 16, 20, 20, 20}, {8, 16, 3, 3, 3},  {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, 1},
+    };
+    // clang-format on
+}
+
+template <class T>
+tensor<T> MakeTensor(const std::vector<std::size_t>& lens, Layout layout)
+{
+    // Dimensions from the innermost one outwards
+    auto order = std::vector<std::size_t>{};
+    if(layout == Layout::ChannelsLast)
+        order.push_back(1);
+    for(auto i = lens.size() - 1; i >= 2; --i)
+        order.push_back(i);
+    if(layout != Layout::ChannelsLast)
+        order.push_back(1);
+    order.push_back(0);
+
+    auto strides      = std::vector<std::size_t>(lens.size());
+    std::size_t total = 1;
+    for(const auto i : order)
+    {
+        strides[i] = total;
+        total *= lens[i] + (layout == Layout::Padded ? 1 : 0);
+    }
+
+    return tensor<T>{lens, strides}.generate(tensor_elem_gen_integer{17});
+}
+
+template <class F>
+void DispatchConvDim(std::size_t conv_dim, F f)
+{
+    switch(conv_dim)
+    {
+    case 1: f(std::integral_constant<std::size_t, 1>{}); break;
+    case 2: f(std::integral_constant<std::size_t, 2>{}); break;
+    case 3: f(std::integral_constant<std::size_t, 3>{}); break;
+    default: FAIL() << "Unsupported convolution dimension " << conv_dim;
+    }
+}
+
+template <class T>
+void ExpectBitExact(const tensor<T>& gemm, const tensor<T>& direct)
+{
+    ASSERT_EQ(gemm.data.size(), direct.data.size());
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i < gemm.data.size(); ++i)
+    {
+        if(gemm.data[i] != direct.data[i] && mismatches++ == 0)
+        {
+            ADD_FAILURE() << "First mismatch at " << i << ": " << static_cast<double>(gemm.data[i])
+                          << " vs " << static_cast<double>(direct.data[i]);
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+struct ConvGemm : testing::TestWithParam<std::tuple<ConvGemmCase, Layout>>
+{
+    const ConvGemmCase& Case() const { return std::get<0>(GetParam()); }
+
+    template <class T>
+    tensor<T> In() const
+    {
+        return MakeTensor<T>(Case().in, std::get<1>(GetParam()));
+    }
+
+    template <class T>
+    tensor<T> Wei() const
+    {
+        return MakeTensor<T>(Case().wei, std::get<1>(GetParam()));
+    }
+
+    template <class T>
+    tensor<T> Out() const
+    {
+        return MakeTensor<T>(Case().Out(), std::get<1>(GetParam()));
+    }
+};
+
+} // namespace
+
+using CPU_ConvGemm_FP32 = ConvGemm;
+using CPU_ConvGemm_I8   = ConvGemm;
+
+TEST_P(CPU_ConvGemm_FP32, Forward)
+{
+    const auto& c  = Case();
+    const auto in  = In<float>();
+    const auto wei = Wei<float>();
+    auto gemm      = Out<float>();
+    auto direct    = gemm;
+    ASSERT_TRUE(cpu_conv_gemm::is_applicable(c.ConvDim(), in, wei, gemm));
+
+    cpu_convolution_forward(c.ConvDim(), in, wei, gemm, c.pads, c.strides, c.dilations, c.groups);
+    DispatchConvDim(c.ConvDim(), [&](auto conv_dim) {
+        cpu_convolution_forward_impl<decltype(conv_dim)::value, double>(in,
+                                                                       wei,
+                                                                       direct,
+                                                                       c.pads,
+                                                                       c.strides,
+                                                                       c.dilations,
+                                                                       c.groups,
+                                                                       PassThru<float>{},
+                                                                       PassThru<float>{});
+    });
+
+    ExpectBitExact(gemm, direct);
+}
+
+TEST_P(CPU_ConvGemm_FP32, BackwardData)
+{
+    const auto& c  = Case();
+    const auto wei = Wei<float>();
+    const auto out = Out<float>();
+    auto gemm      = In<float>();
+    auto direct    = gemm;
+    ASSERT_TRUE(cpu_conv_gemm::is_applicable(c.ConvDim(), gemm, wei, out));
+
+    cpu_convolution_backward_data(
+        c.ConvDim(), gemm, wei, out, c.pads, c.strides, c.dilations, c.groups);
+    DispatchConvDim(c.ConvDim(), [&](auto conv_dim) {
+        cpu_convolution_backward_data_impl<decltype(conv_dim)::value, double>(direct,
+                                                                             wei,
+                                                                             out,
+                                                                             c.pads,
+                                                                             c.strides,
+                                                                             c.dilations,
+                                                                             c.groups,
+                                                                             PassThru<float>{},
+                                                                             PassThru<float>{});
+    });
+
+    ExpectBitExact(gemm, direct);
+}
+
+TEST_P(CPU_ConvGemm_FP32, BackwardWeights)
+{
+    const auto& c  = Case();
+    const auto in  = In<float>();
+    const auto out = Out<float>();
+    auto gemm      = Wei<float>();
+    auto direct    = gemm;
+    ASSERT_TRUE(cpu_conv_gemm::is_applicable(c.ConvDim(), in, gemm, out));
+
+    cpu_convolution_backward_weight(
+        c.ConvDim(), in, gemm, out, c.pads, c.strides, c.dilations, c.groups);
+    DispatchConvDim(c.ConvDim(), [&](auto conv_dim) {
+        cpu_convolution_backward_weight_impl<decltype(conv_dim)::value, double>(in,
+                                                                               direct,
+                                                                               out,
+                                                                               c.pads,
+                                                                               c.strides,
+                                                                               c.dilations,
+                                                                               c.groups,
+                                                                               PassThru<float>{},
+                                                                               PassThru<float>{});
+    });
+
+    ExpectBitExact(gemm, direct);
+}
+
+TEST_P(CPU_ConvGemm_I8, Forward)
+{
+    const auto& c  = Case();
+    const auto in  = In<int8_t>();
+    const auto wei = Wei<int8_t>();
+    auto gemm      = Out<int32_t>();
+    auto direct    = gemm;
+    ASSERT_TRUE(cpu_conv_gemm::is_applicable(c.ConvDim(), in, wei, gemm));
+
+    cpu_convolution_forward<int8_t, int8_t, int32_t, std::vector<int>, int32_t>(
+        c.ConvDim(), in, wei, gemm, c.pads, c.strides, c.dilations, c.groups);
+    DispatchConvDim(c.ConvDim(), [&](auto conv_dim) {
+        cpu_convolution_forward_impl<decltype(conv_dim)::value, int32_t>(in,
+                                                                        wei,
+                                                                        direct,
+                                                                        c.pads,
+                                                                        c.strides,
+                                                                        c.dilations,
+                                                                        c.groups,
+                                                                        PassThru<int8_t>{},
+                                                                        PassThru<int8_t>{});
+    });
+
+    ExpectBitExact(gemm, direct);
+}
+
+INSTANTIATE_TEST_SUITE_P(Full,
+                         CPU_ConvGemm_FP32,
+                         testing::Combine(testing::ValuesIn(ConvGemmCases()),
+                                          testing::Values(Layout::Packed,
+                                                          Layout::ChannelsLast,
+                                                          Layout::Padded)));
+
+INSTANTIATE_TEST_SUITE_P(Full,
+                         CPU_ConvGemm_I8,
+                         testing::Combine(testing::ValuesIn(ConvGemmCases()),
+                                          testing::Values(Layout::Packed,
+                                                          Layout::ChannelsLast,
+                                                          Layout::Padded)));
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/find_refinement.hpp>
+#include <miopen/conv/problem_description.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using miopen::conv::Direction;
+using miopen::conv::ProblemDescription;
+
+ProblemDescription MakeProblem(std::size_t n,
+                               std::size_t hw,
+                               std::size_t filter          = 3,
+                               miopenTensorLayout_t layout = miopenTensorNCHW,
+                               std::size_t d               = 0)
+{
+    auto spatial = std::vector<std::size_t>{hw, hw};
+    if(d != 0)
+        spatial.insert(spatial.begin(), d);
+
+    auto lens = [&](std::size_t a, std::size_t b, const std::vector<std::size_t>& sizes) {
+        auto result = std::vector<std::size_t>{a, b};
+        result.insert(result.end(), sizes.begin(), sizes.end());
+        return result;
+    };
+
+    const auto pads  = std::vector<int>(spatial.size(), static_cast<int>(filter / 2));
+    const auto ones  = std::vector<int>(spatial.size(), 1);
+    const auto zeros = std::vector<int>(spatial.size(), 0);
+    const auto conv  = miopen::ConvolutionDescriptor{pads, ones, ones, zeros};
+
+    return {miopen::TensorDescriptor{miopenFloat, layout, lens(n, 16, spatial)},
+            miopen::TensorDescriptor{
+                miopenFloat, layout, lens(32, 16, std::vector<std::size_t>(spatial.size(), filter))},
+            miopen::TensorDescriptor{miopenFloat, layout, lens(n, 32, spatial)},
+            conv,
+            Direction::Forward};
+}
+
+std::string Key(const ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+double Distance(const ProblemDescription& a, const ProblemDescription& b)
+{
+    return ProblemDescription::FindDbKeyDistance(Key(a), Key(b));
+}
+
+} // namespace
+
+TEST(CPU_FindDbNearest_NONE, KeyDistance)
+{
+    EXPECT_DOUBLE_EQ(Distance(MakeProblem(16, 56), MakeProblem(16, 56)), 0.0);
+    EXPECT_DOUBLE_EQ(Distance(MakeProblem(16, 56), MakeProblem(32, 56)), 1.0);
+    EXPECT_DOUBLE_EQ(Distance(MakeProblem(16, 56), MakeProblem(64, 56)), 2.0);
+    // Both the input and the output sizes change with the image size.
+    EXPECT_DOUBLE_EQ(Distance(MakeProblem(16, 56), MakeProblem(16, 112)), 4.0);
+    EXPECT_DOUBLE_EQ(Distance(MakeProblem(8, 8, 3, miopenTensorNCDHW, 8),
+                              MakeProblem(4, 8, 3, miopenTensorNCDHW, 8)),
+                     1.0);
+
+    // Everything but the batch size and the spatial sizes has to match.
+    EXPECT_LT(Distance(MakeProblem(16, 56), MakeProblem(16, 56, 1)), 0.0);
+    EXPECT_LT(Distance(MakeProblem(16, 56), MakeProblem(16, 56, 3, miopenTensorNHWC)), 0.0);
+    EXPECT_LT(Distance(MakeProblem(16, 8, 3, miopenTensorNCDHW, 8), MakeProblem(16, 8)), 0.0);
+    EXPECT_LT(ProblemDescription::FindDbKeyDistance(Key(MakeProblem(16, 56)), "garbage"), 0.0);
+}
+
+TEST(CPU_FindDbNearest_NONE, RefinesEachProblemOnce)
+{
+    std::atomic<int> refined{0};
+    miopen::conv::FindRefinement refinement{[&](const ProblemDescription&) { ++refined; }};
+
+    refinement.Enqueue(MakeProblem(16, 56));
+    refinement.Enqueue(MakeProblem(32, 56));
+    refinement.Enqueue(MakeProblem(16, 56));
+    refinement.Wait();
+    EXPECT_EQ(refined, 2);
+
+    refinement.Enqueue(MakeProblem(32, 56));
+    refinement.Enqueue(MakeProblem(48, 56));
+    refinement.Wait();
+    EXPECT_EQ(refined, 3);
+}
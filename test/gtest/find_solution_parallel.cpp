@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/execution_context.hpp>
+#include <miopen/find_solution.hpp>
+#include <miopen/problem_description_base.hpp>
+#include <miopen/solver.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct ParallelFindProblem : miopen::ProblemDescriptionBase
+{
+    std::array<std::atomic<int>, 16>* applicability_checks;
+    mutable std::atomic<int> running{0};
+    mutable std::atomic<int> max_running{0};
+
+    auto MakeNetworkConfig() const -> miopen::NetworkConfig override
+    {
+        return miopen::NetworkConfig{"parallel_find"};
+    }
+};
+
+// Every third solver is not applicable, and every fifth one fails to provide a solution.
+// The sleeps make the later solvers finish first when they run concurrently.
+template <int I>
+struct ParallelFindSolver
+    : miopen::solver::NonTunableSolverBase<miopen::ExecutionContext, ParallelFindProblem>
+{
+    auto SolverDbId() const -> const std::string& override
+    {
+        return GetSolverDbId<ParallelFindSolver<I>>();
+    }
+
+    auto IsApplicable(const miopen::ExecutionContext&, const ParallelFindProblem& problem) const
+        -> bool override
+    {
+        ++(*problem.applicability_checks)[I];
+        const auto running = ++problem.running;
+        for(auto max = problem.max_running.load(); running > max;)
+            problem.max_running.compare_exchange_weak(max, running);
+        std::this_thread::sleep_for(std::chrono::microseconds{(16 - I) * 100});
+        --problem.running;
+        return I % 3 != 0;
+    }
+
+    auto GetSolution(const miopen::ExecutionContext&, const ParallelFindProblem&) const
+        -> miopen::solver::ConvSolution override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds{(16 - I) * 100});
+        MIOPEN_LOG_W("Solving with " << I);
+        return miopen::solver::ConvSolution{I % 5 == 4 ? miopenStatusInternalError
+                                                       : miopenStatusSuccess};
+    }
+};
+
+template <std::size_t... Is>
+auto MakeSolvers(std::index_sequence<Is...>)
+{
+    return miopen::solver::SolverContainer<ParallelFindSolver<Is>...>{};
+}
+
+template <std::size_t... Is>
+std::vector<std::string> ExpectedIds(std::size_t limit, std::index_sequence<Is...>)
+{
+    auto ids        = std::vector<std::string>{};
+    const auto push = [&](bool succeeds, const std::string& id) {
+        if(succeeds && ids.size() < limit)
+            ids.push_back(id);
+    };
+    (push(Is % 3 != 0 && Is % 5 != 4, ParallelFindSolver<Is>{}.SolverDbId()), ...);
+    return ids;
+}
+
+std::vector<std::string> ExpectedIds(std::size_t limit)
+{
+    return ExpectedIds(limit, std::make_index_sequence<16>{});
+}
+
+std::vector<std::string> Search(ParallelFindProblem& problem, std::size_t limit)
+{
+    const auto ctx = miopen::ExecutionContext{};
+    auto db        = 0;
+    auto ids       = std::vector<std::string>{};
+    const auto solvers = MakeSolvers(std::make_index_sequence<16>{});
+    for(const auto& solution : solvers.SearchForAllSolutions(ctx, problem, db, {}, limit))
+        ids.push_back(solution.solver_id);
+    return ids;
+}
+
+/// Captures what is printed to std::cerr while alive.
+class CerrCapture
+{
+public:
+    CerrCapture() : previous(std::cerr.rdbuf(captured.rdbuf())) {}
+    ~CerrCapture() { std::cerr.rdbuf(previous); }
+
+    std::string Text() const { return captured.str(); }
+
+private:
+    std::ostringstream captured;
+    std::streambuf* previous;
+};
+
+} // namespace
+
+TEST(CPU_FindSolutionParallel_NONE, KeepsSolverOrder)
+{
+    auto checks  = std::array<std::atomic<int>, 16>{};
+    auto problem = ParallelFindProblem{};
+
+    problem.applicability_checks = &checks;
+
+    const auto limit = std::numeric_limits<std::size_t>::max();
+    auto log         = std::string{};
+    {
+        const auto capture = CerrCapture{};
+        EXPECT_EQ(Search(problem, limit), ExpectedIds(limit));
+        log = capture.Text();
+    }
+
+    for(const auto& count : checks)
+        EXPECT_EQ(count, 1);
+
+    // The messages of the solvers found concurrently are printed in solver order.
+    auto last = std::string::size_type{0};
+    for(auto i = 1; i < 16; ++i)
+    {
+        if(i % 3 == 0)
+            continue;
+        const auto pos = log.find("Solving with " + std::to_string(i) + "\n");
+        ASSERT_NE(pos, std::string::npos) << "solver " << i;
+        EXPECT_GT(pos, last) << "solver " << i;
+        last = pos;
+    }
+}
+
+TEST(CPU_FindSolutionParallel_NONE, SequentialWhenDisabled)
+{
+    auto checks  = std::array<std::atomic<int>, 16>{};
+    auto problem = ParallelFindProblem{};
+
+    problem.applicability_checks = &checks;
+
+    miopen::env::update(MIOPEN_DEBUG_FIND_PARALLEL_SOLVERS, false);
+    const auto limit = std::numeric_limits<std::size_t>::max();
+    EXPECT_EQ(Search(problem, limit), ExpectedIds(limit));
+    miopen::env::clear(MIOPEN_DEBUG_FIND_PARALLEL_SOLVERS);
+
+    for(const auto& count : checks)
+        EXPECT_EQ(count, 1);
+    EXPECT_EQ(problem.max_running, 1);
+}
+
+TEST(CPU_FindSolutionParallel_NONE, StopsAtLimit)
+{
+    auto checks  = std::array<std::atomic<int>, 16>{};
+    auto problem = ParallelFindProblem{};
+
+    problem.applicability_checks = &checks;
+
+    // Solvers 1, 2 and 5 are the first to succeed; 3 and 4 are checked on the way.
+    EXPECT_EQ(Search(problem, 3), ExpectedIds(3));
+    for(auto i = 0; i < 16; ++i)
+        EXPECT_EQ(checks[i], i <= 5 ? 1 : 0) << "solver " << i;
+}
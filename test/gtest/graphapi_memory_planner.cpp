@@ -0,0 +1,596 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/execution_plan.hpp>
+#include <miopen/graphapi/memory_planner.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/pointwise_fusion_executor.hpp>
+#include <miopen/graphapi/reduction.hpp>
+#include <miopen/graphapi/util.hpp>
+
+#include <gtest/gtest.h>
+
+#include "../get_handle.hpp"
+#include "../tensor_holder.hpp"
+#include "../workspace.hpp"
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gr = miopen::graphapi;
+
+namespace {
+
+/// Builds graphs of dummy nodes over real tensors, so that only the topology
+/// and the tensor sizes matter
+class SyntheticGraph
+{
+    gr::AutoDeleteAllocator mAlloc;
+    gr::OpGraphBuilder mBuilder;
+    std::unordered_map<std::string, gr::Tensor*> mTensors;
+
+public:
+    void tensor(const std::string& name, const std::vector<size_t>& dims, bool isVirtual)
+    {
+        auto* t = isVirtual ? mAlloc.allocate(gr::makeTensor<true>(name, miopenFloat, dims))
+                            : mAlloc.allocate(gr::makeTensor<false>(name, miopenFloat, dims));
+        mTensors.emplace(name, t);
+    }
+
+    gr::Tensor* get(const std::string& name) const { return mTensors.at(name); }
+
+    void node(const std::string& name,
+              const std::vector<std::string>& ins,
+              const std::vector<std::string>& outs)
+    {
+        std::vector<gr::Tensor*> inTensors;
+        std::vector<gr::Tensor*> outTensors;
+        for(const auto& in : ins)
+            inTensors.push_back(get(in));
+        for(const auto& out : outs)
+            outTensors.push_back(get(out));
+        mBuilder.addNode(mAlloc.allocate(
+            gr::PatternGraphGenerator::DummyNode{name, inTensors, outTensors}));
+    }
+
+    gr::OpGraph build() { return std::move(mBuilder).build(); }
+};
+
+// MHA-shaped graphs exercise the planner with many large intermediates. The Find 2.0 MHA
+// executors keep these inside their solution workspace and do not use a plan.
+void buildMhaForward(SyntheticGraph& g, size_t n, size_t h, size_t s, size_t d)
+{
+    const std::vector<size_t> nhsd{n, h, s, d};
+    const std::vector<size_t> nhss{n, h, s, s};
+    const std::vector<size_t> nhs1{n, h, s, 1};
+    const std::vector<size_t> all1s{1, 1, 1, 1};
+
+    for(const auto* name : {"Q", "K", "V", "O"})
+        g.tensor(name, nhsd, false);
+    for(const auto* name : {"M", "Z_INV"})
+        g.tensor(name, nhs1, false);
+    for(const auto* name : {"DSCL_Q",
+                            "DSCL_K",
+                            "AMAX_S",
+                            "RND_SD",
+                            "RND_OFF",
+                            "RND_PRB",
+                            "SCL_S",
+                            "DSCL_S",
+                            "DSCL_V",
+                            "SCL_O",
+                            "AMAX_O"})
+        g.tensor(name, all1s, false);
+    for(const auto* name : {"T_MM_0",
+                            "T_SCL_0",
+                            "T_SCL_1",
+                            "T_SCL_2",
+                            "T_SUB",
+                            "T_EXP",
+                            "T_MUL_0",
+                            "T_RND",
+                            "T_MUL_1",
+                            "T_SCL_3",
+                            "T_SCL_4"})
+        g.tensor(name, nhss, true);
+    g.tensor("T_SUM", nhs1, true);
+    for(const auto* name : {"T_MM_1", "T_SCL_5", "T_SCL_6"})
+        g.tensor(name, nhsd, true);
+
+    g.node("OP_MATMUL", {"Q", "K"}, {"T_MM_0"});
+    g.node("OP_POINTWISE:IDENTITY", {"T_MM_0"}, {"T_SCL_0"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_0", "DSCL_Q"}, {"T_SCL_1"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_1", "DSCL_K"}, {"T_SCL_2"});
+    g.node("OP_REDUCTION:MAX", {"T_SCL_2"}, {"M"});
+    g.node("OP_POINTWISE:SUB", {"T_SCL_2", "M"}, {"T_SUB"});
+    g.node("OP_POINTWISE:EXP", {"T_SUB"}, {"T_EXP"});
+    g.node("OP_REDUCTION:ADD", {"T_EXP"}, {"T_SUM"});
+    g.node("OP_POINTWISE:RECIPROCAL", {"T_SUM"}, {"Z_INV"});
+    g.node("OP_POINTWISE:MUL", {"T_EXP", "Z_INV"}, {"T_MUL_0"});
+    g.node("OP_REDUCTION:MAX", {"T_MUL_0"}, {"AMAX_S"});
+    g.node("OP_RNG", {"RND_SD", "RND_OFF"}, {"T_RND"});
+    g.node("OP_POINTWISE:MUL", {"T_MUL_0", "T_RND"}, {"T_MUL_1"});
+    g.node("OP_POINTWISE:MUL", {"T_MUL_1", "RND_PRB"}, {"T_SCL_3"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_3", "SCL_S"}, {"T_SCL_4"});
+    g.node("OP_MATMUL", {"T_SCL_4", "V"}, {"T_MM_1"});
+    g.node("OP_POINTWISE:MUL", {"T_MM_1", "DSCL_S"}, {"T_SCL_5"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_5", "DSCL_V"}, {"T_SCL_6"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_6", "SCL_O"}, {"O"});
+    g.node("OP_REDUCTION:MAX", {"T_SCL_6"}, {"AMAX_O"});
+}
+
+void buildMhaBackward(SyntheticGraph& g, size_t n, size_t h, size_t s, size_t d)
+{
+    const std::vector<size_t> nhsd{n, h, s, d};
+    const std::vector<size_t> nhds{n, h, d, s};
+    const std::vector<size_t> nhss{n, h, s, s};
+    const std::vector<size_t> nhs1{n, h, s, 1};
+    const std::vector<size_t> all1s{1, 1, 1, 1};
+
+    for(const auto* name : {"Q", "K", "V", "dO", "O", "dQ", "dK", "dV"})
+        g.tensor(name, nhsd, false);
+    for(const auto* name : {"M", "Z_INV"})
+        g.tensor(name, nhs1, false);
+    for(const auto* name : {"DSCL_Q",
+                            "DSCL_K",
+                            "DSCL_V",
+                            "DSCL_O",
+                            "DSCL_dO",
+                            "DSCL_S",
+                            "DSCL_dS",
+                            "RND_SD",
+                            "RND_OFF",
+                            "RND_PRB",
+                            "SCL_S",
+                            "SCL_dS",
+                            "SCL_dQ",
+                            "SCL_dK",
+                            "SCL_dV",
+                            "AMax_dQ",
+                            "AMax_dK",
+                            "AMax_dV",
+                            "AMax_dS"})
+        g.tensor(name, all1s, false);
+    for(const auto* name : {"K_T", "V_T"})
+        g.tensor(name, nhds, true);
+    for(const auto* name : {"T_MM_0",
+                            "T_SCL_0",
+                            "T_SCL_1",
+                            "T_SCL_2",
+                            "T_SUB_0",
+                            "T_EXP",
+                            "T_MUL_0",
+                            "T_RND",
+                            "T_MUL_1",
+                            "T_SCL_3",
+                            "T_SCL_4",
+                            "SCL_4T",
+                            "T_MM_2",
+                            "T_SCL_7",
+                            "T_SCL_8",
+                            "T_SCL_9",
+                            "T_SCL_10",
+                            "T_SUB_1",
+                            "T_SCL_14",
+                            "T_MUL_3",
+                            "T_SCL_15",
+                            "SCL_15T"})
+        g.tensor(name, nhss, true);
+    g.tensor("T_SUM_0", nhs1, true);
+    for(const auto* name : {"T_MM_1",
+                            "T_SCL_5",
+                            "T_SCL_6",
+                            "T_SCL_11",
+                            "T_SCL_12",
+                            "T_MUL_2",
+                            "T_SCL_13",
+                            "T_MM_3",
+                            "T_SCL_16",
+                            "T_SCL_17",
+                            "T_MM_4",
+                            "T_SCL_18",
+                            "T_SCL_19"})
+        g.tensor(name, nhsd, true);
+
+    g.node("OP_RESHAPE", {"K"}, {"K_T"});
+    g.node("OP_MATMUL", {"Q", "K_T"}, {"T_MM_0"});
+    g.node("OP_POINTWISE:IDENTITY", {"T_MM_0"}, {"T_SCL_0"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_0", "DSCL_Q"}, {"T_SCL_1"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_1", "DSCL_K"}, {"T_SCL_2"});
+    g.node("OP_POINTWISE:SUB", {"T_SCL_2", "M"}, {"T_SUB_0"});
+    g.node("OP_POINTWISE:EXP", {"T_SUB_0"}, {"T_EXP"});
+    g.node("OP_POINTWISE:MUL", {"T_EXP", "Z_INV"}, {"T_MUL_0"});
+    g.node("OP_RNG", {"RND_SD", "RND_OFF"}, {"T_RND"});
+    g.node("OP_POINTWISE:MUL", {"T_MUL_0", "T_RND"}, {"T_MUL_1"});
+    g.node("OP_POINTWISE:MUL", {"T_MUL_1", "RND_PRB"}, {"T_SCL_3"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_3", "SCL_S"}, {"T_SCL_4"});
+    g.node("OP_RESHAPE", {"T_SCL_4"}, {"SCL_4T"});
+    g.node("OP_MATMUL", {"SCL_4T", "dO"}, {"T_MM_1"});
+    g.node("OP_POINTWISE:MUL", {"T_MM_1", "DSCL_S"}, {"T_SCL_5"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_5", "DSCL_dO"}, {"T_SCL_6"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_6", "SCL_dV"}, {"dV"});
+    g.node("OP_REDUCTION:MAX", {"T_SCL_6"}, {"AMax_dV"});
+    g.node("OP_RESHAPE", {"V"}, {"V_T"});
+    g.node("OP_MATMUL", {"dO", "V_T"}, {"T_MM_2"});
+    g.node("OP_POINTWISE:MUL", {"T_MM_2", "DSCL_dO"}, {"T_SCL_7"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_7", "DSCL_V"}, {"T_SCL_8"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_8", "T_RND"}, {"T_SCL_9"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_9", "RND_PRB"}, {"T_SCL_10"});
+    g.node("OP_POINTWISE:MUL", {"dO", "DSCL_dO"}, {"T_SCL_11"});
+    g.node("OP_POINTWISE:MUL", {"O", "DSCL_O"}, {"T_SCL_12"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_11", "T_SCL_12"}, {"T_MUL_2"});
+    g.node("OP_POINTWISE:MUL", {"T_MUL_2", "RND_PRB"}, {"T_SCL_13"});
+    g.node("OP_REDUCTION:ADD", {"T_SCL_13"}, {"T_SUM_0"});
+    g.node("OP_POINTWISE:SUB", {"T_SCL_10", "T_SUM_0"}, {"T_SUB_1"});
+    g.node("OP_POINTWISE:IDENTITY", {"T_SUB_1"}, {"T_SCL_14"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_14", "T_SCL_3"}, {"T_MUL_3"});
+    g.node("OP_POINTWISE:MUL", {"T_MUL_3", "SCL_dS"}, {"T_SCL_15"});
+    g.node("OP_REDUCTION:MAX", {"T_MUL_3"}, {"AMax_dS"});
+    g.node("OP_MATMUL", {"T_SCL_15", "K"}, {"T_MM_3"});
+    g.node("OP_POINTWISE:MUL", {"T_MM_3", "DSCL_dS"}, {"T_SCL_16"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_16", "DSCL_K"}, {"T_SCL_17"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_17", "SCL_dQ"}, {"dQ"});
+    g.node("OP_REDUCTION:MAX", {"T_SCL_17"}, {"AMax_dQ"});
+    g.node("OP_RESHAPE", {"T_SCL_15"}, {"SCL_15T"});
+    g.node("OP_MATMUL", {"SCL_15T", "Q"}, {"T_MM_4"});
+    g.node("OP_POINTWISE:MUL", {"T_MM_4", "DSCL_dS"}, {"T_SCL_18"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_18", "DSCL_Q"}, {"T_SCL_19"});
+    g.node("OP_POINTWISE:MUL", {"T_SCL_19", "SCL_dK"}, {"dK"});
+    g.node("OP_REDUCTION:MAX", {"T_SCL_19"}, {"AMax_dK"});
+}
+
+/// y = softmax(x) along the last dimension, which the pointwise fusion engine
+/// runs as three kernels: max, exp and sum, division
+class FusedSoftmax
+{
+    gr::AutoDeleteAllocator mAlloc;
+
+public:
+    std::vector<size_t> dims{2, 3, 5, 67};
+    std::vector<size_t> rowDims{2, 3, 5, 1};
+
+    gr::Tensor* x    = mAlloc.allocate(gr::makeTensor<false>("X", miopenFloat, dims));
+    gr::Tensor* max  = mAlloc.allocate(gr::makeTensor<true>("MAX", miopenFloat, rowDims));
+    gr::Tensor* diff = mAlloc.allocate(gr::makeTensor<true>("DIFF", miopenFloat, dims));
+    gr::Tensor* exp  = mAlloc.allocate(gr::makeTensor<true>("EXP", miopenFloat, dims));
+    gr::Tensor* sum  = mAlloc.allocate(gr::makeTensor<true>("SUM", miopenFloat, rowDims));
+    gr::Tensor* y    = mAlloc.allocate(gr::makeTensor<false>("Y", miopenFloat, dims));
+
+    gr::OpGraph graph;
+
+    FusedSoftmax()
+    {
+        gr::OpGraphBuilder gb;
+        gb.addNode(reduction(MIOPEN_REDUCE_TENSOR_MAX, x, max));
+        gb.addNode(pointwise(MIOPEN_POINTWISE_SUB, x, max, diff));
+        gb.addNode(pointwise(MIOPEN_POINTWISE_EXP, diff, nullptr, exp));
+        gb.addNode(reduction(MIOPEN_REDUCE_TENSOR_ADD, exp, sum));
+        gb.addNode(pointwise(MIOPEN_POINTWISE_DIV, exp, sum, y));
+        graph = std::move(gb).build();
+    }
+
+    gr::ExecutionPlan makePlan(miopenHandle_t handle)
+    {
+        auto engines = gr::findEngines(&graph);
+        EXPECT_EQ(engines.size(), 1);
+        auto engineCfg = gr::EngineCfgBuilder().setEngine(engines.front()).build();
+        return gr::ExecutionPlanBuilder().setHandle(handle).setEngineCfg(engineCfg).build();
+    }
+
+private:
+    gr::OperationPointwise*
+    pointwise(miopenPointwiseMode_t mode, gr::Tensor* in0, gr::Tensor* in1, gr::Tensor* out)
+    {
+        auto* pw = mAlloc.allocate(
+            gr::PointwiseBuilder{}.setMode(mode).setMathPrecision(miopenFloat).build());
+        gr::OperationPointwiseBuilder builder;
+        builder.setPointwise(pw).setX(in0).setY(out);
+        if(in1 != nullptr)
+        {
+            builder.setB(in1);
+        }
+        return mAlloc.allocate(builder.build());
+    }
+
+    gr::OperationReduction* reduction(miopenReduceTensorOp_t op, gr::Tensor* in, gr::Tensor* out)
+    {
+        auto* red = mAlloc.allocate(
+            gr::ReductionBuilder{}.setReductionOperator(op).setCompType(miopenFloat).build());
+        return mAlloc.allocate(
+            gr::OperationReductionBuilder{}.setReduction(red).setX(in).setY(out).build());
+    }
+};
+
+bool overlaps(const gr::MemoryPlan::Block& a, const gr::MemoryPlan::Block& b)
+{
+    const bool inTime   = a.firstStep <= b.lastStep && b.firstStep <= a.lastStep;
+    const bool inMemory = a.offset < b.offset + b.size && b.offset < a.offset + a.size;
+    return inTime && inMemory;
+}
+
+void checkPlan(const gr::MemoryPlan& plan)
+{
+    const auto& blocks = plan.getBlocks();
+    for(size_t i = 0; i < blocks.size(); ++i)
+    {
+        EXPECT_EQ(blocks[i].offset % plan.getAlignment(), 0);
+        EXPECT_LE(blocks[i].offset + blocks[i].size, plan.getSize());
+        for(size_t j = i + 1; j < blocks.size(); ++j)
+        {
+            EXPECT_FALSE(overlaps(blocks[i], blocks[j]))
+                << "tensors " << blocks[i].tensorId << " and " << blocks[j].tensorId;
+        }
+    }
+    EXPECT_LE(plan.getSize(), plan.getNaiveSize());
+}
+
+} // namespace
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, ChainPingPongs)
+{
+    // in -> a -> b -> c -> d -> out, every intermediate has the same size
+    SyntheticGraph g;
+    const std::vector<size_t> dims{1, 1, 16, 16};
+    g.tensor("in", dims, false);
+    g.tensor("out", dims, false);
+    for(const auto* name : {"a", "b", "c", "d"})
+        g.tensor(name, dims, true);
+
+    g.node("n0", {"in"}, {"a"});
+    g.node("n1", {"a"}, {"b"});
+    g.node("n2", {"b"}, {"c"});
+    g.node("n3", {"c"}, {"d"});
+    g.node("n4", {"d"}, {"out"});
+    auto graph = g.build();
+
+    auto plan = gr::MemoryPlan::make(graph);
+    checkPlan(plan);
+
+    constexpr size_t bytes = 16 * 16 * sizeof(float);
+    EXPECT_EQ(plan.getBlocks().size(), 4);
+    EXPECT_EQ(plan.getNaiveSize(), 4 * bytes);
+    EXPECT_EQ(plan.getSize(), 2 * bytes);
+    EXPECT_EQ(plan.getOffset(g.get("a")->getId()), plan.getOffset(g.get("c")->getId()));
+    EXPECT_NE(plan.getOffset(g.get("a")->getId()), plan.getOffset(g.get("b")->getId()));
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, LongLivedTensorIsNotReused)
+{
+    // a is consumed again by the last node, so it stays live across the chain
+    SyntheticGraph g;
+    const std::vector<size_t> dims{1, 1, 8, 8};
+    g.tensor("in", dims, false);
+    g.tensor("out", dims, false);
+    for(const auto* name : {"a", "b", "c", "d"})
+        g.tensor(name, dims, true);
+
+    g.node("n0", {"in"}, {"a"});
+    g.node("n1", {"a"}, {"b"});
+    g.node("n2", {"b"}, {"c"});
+    g.node("n3", {"c"}, {"d"});
+    g.node("n4", {"a", "d"}, {"out"});
+    auto graph = g.build();
+
+    auto plan = gr::MemoryPlan::make(graph);
+    checkPlan(plan);
+
+    constexpr size_t bytes = 8 * 8 * sizeof(float);
+    EXPECT_EQ(plan.getNaiveSize(), 4 * bytes);
+    EXPECT_EQ(plan.getSize(), 3 * bytes);
+    EXPECT_EQ(plan.getOffset(g.get("b")->getId()), plan.getOffset(g.get("d")->getId()));
+    for(const auto* name : {"b", "c", "d"})
+    {
+        EXPECT_NE(plan.getOffset(g.get("a")->getId()), plan.getOffset(g.get(name)->getId()));
+    }
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, Alignment)
+{
+    SyntheticGraph g;
+    g.tensor("in", {1, 1, 1, 3}, false);
+    g.tensor("out", {1, 1, 1, 3}, false);
+    g.tensor("a", {1, 1, 1, 3}, true);
+    g.tensor("b", {1, 1, 1, 5}, true);
+    g.node("n0", {"in"}, {"a"});
+    g.node("n1", {"in"}, {"b"});
+    g.node("n2", {"a", "b"}, {"out"});
+    auto graph = g.build();
+
+    auto plan = gr::MemoryPlan::make(graph, 64);
+    checkPlan(plan);
+    EXPECT_EQ(plan.getAlignment(), 64);
+    EXPECT_EQ(plan.getSize(), 128);
+
+    EXPECT_ANY_THROW(gr::MemoryPlan::make(graph, 48));
+    EXPECT_ANY_THROW(plan.getOffset(g.get("in")->getId()));
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, Bind)
+{
+    SyntheticGraph g;
+    const std::vector<size_t> dims{1, 1, 4, 4};
+    g.tensor("in", dims, false);
+    g.tensor("out", dims, false);
+    g.tensor("a", dims, true);
+    g.tensor("b", dims, true);
+    g.node("n0", {"in"}, {"a"});
+    g.node("n1", {"a"}, {"b"});
+    g.node("n2", {"b"}, {"out"});
+    auto graph = g.build();
+
+    auto plan = gr::MemoryPlan::make(graph);
+
+    std::vector<char> workspace(1024 + plan.getSize());
+    char inBuf  = 0;
+    char outBuf = 0;
+    char bBuf   = 0;
+    gr::VariantPack vpk{
+        {g.get("in")->getId(), g.get("out")->getId()}, {&inBuf, &outBuf}, workspace.data()};
+
+    auto bound = plan.bind(vpk, 1024);
+    EXPECT_EQ(bound.getWorkspace(), workspace.data());
+    EXPECT_EQ(bound.getDataPointer(g.get("in")->getId()), &inBuf);
+    EXPECT_EQ(bound.getDataPointer(g.get("a")->getId()),
+              workspace.data() + 1024 + plan.getOffset(g.get("a")->getId()));
+    EXPECT_EQ(bound.getDataPointer(g.get("b")->getId()),
+              workspace.data() + 1024 + plan.getOffset(g.get("b")->getId()));
+
+    // The plan owns the virtual tensors, a pointer of the user may be too small
+    gr::VariantPack userPointer{{g.get("in")->getId(), g.get("out")->getId(), g.get("b")->getId()},
+                                {&inBuf, &outBuf, &bBuf},
+                                workspace.data()};
+    EXPECT_ANY_THROW(plan.bind(userPointer, 1024));
+
+    gr::VariantPack noWorkspace{{g.get("in")->getId()}, {&inBuf}, nullptr};
+    EXPECT_ANY_THROW(plan.bind(noWorkspace, 0));
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, MhaForward)
+{
+    SyntheticGraph g;
+    buildMhaForward(g, 2, 8, 256, 64);
+    auto graph = g.build();
+
+    auto plan = gr::MemoryPlan::make(graph);
+    checkPlan(plan);
+
+    // 11 virtual n*h*s*s tensors, of which at most 3 are live at once
+    constexpr size_t nhss = 2 * 8 * 256 * 256 * sizeof(float);
+    EXPECT_GE(plan.getNaiveSize(), 11 * nhss);
+    EXPECT_LE(plan.getSize(), 3 * nhss + plan.getNaiveSize() - 11 * nhss);
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, MhaBackward)
+{
+    SyntheticGraph g;
+    buildMhaBackward(g, 2, 8, 256, 64);
+    auto graph = g.build();
+
+    auto plan = gr::MemoryPlan::make(graph);
+    checkPlan(plan);
+
+    EXPECT_LT(plan.getSize() * 3, plan.getNaiveSize());
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, ExecutorBuffers)
+{
+    // Steps come from the executor's own schedule, the graph is not involved
+    constexpr size_t bytes = 1000;
+
+    auto plan = gr::MemoryPlan::make({{1, bytes, 0, 1}, {2, bytes, 1, 2}, {3, bytes, 2, 3}});
+    checkPlan(plan);
+
+    EXPECT_EQ(plan.getNaiveSize(), 3 * 1024);
+    EXPECT_EQ(plan.getSize(), 2 * 1024);
+    EXPECT_EQ(plan.getOffset(1), plan.getOffset(3));
+
+    EXPECT_ANY_THROW(gr::MemoryPlan::make({{1, bytes, 0, 1}, {1, bytes, 2, 3}}));
+    EXPECT_ANY_THROW(gr::MemoryPlan::make({{1, bytes, 2, 1}}));
+}
+
+TEST(CPU_GraphApiMemoryPlanner_NONE, FusedExecutorThroughExecutionPlan)
+{
+    miopenHandle_t handle;
+    ASSERT_EQ(miopenCreate(&handle), miopenStatusSuccess);
+
+    FusedSoftmax softmax;
+    auto plan = softmax.makePlan(handle);
+
+    auto* executor = dynamic_cast<gr::PointwiseFusionExecutor*>(
+        plan.getEngineCfg().getEngine().getExecutor());
+    ASSERT_NE(executor, nullptr);
+    EXPECT_EQ(executor->getKernelCount(), 3);
+    EXPECT_TRUE(executor->needsVirtualTensorBuffers());
+
+    // DIFF is consumed by the kernel computing it, so it stays in registers
+    const auto& memoryPlan = plan.getMemoryPlan();
+    checkPlan(memoryPlan);
+    EXPECT_EQ(memoryPlan.getBlocks().size(), 3);
+    EXPECT_ANY_THROW(memoryPlan.getOffset(softmax.diff->getId()));
+    EXPECT_EQ(plan.getWorkspaceSize(), memoryPlan.getSize());
+
+    std::vector<char> workspace(plan.getWorkspaceSize());
+    float x = 0.0f;
+    float y = 0.0f;
+    gr::VariantPack vpk{{softmax.x->getId(), softmax.y->getId()}, {&x, &y}, workspace.data()};
+    auto bound = memoryPlan.bind(vpk, plan.getMemoryPlanOffset());
+    for(const auto* tensor : {softmax.max, softmax.exp, softmax.sum})
+    {
+        EXPECT_EQ(bound.getDataPointer(tensor->getId()),
+                  workspace.data() + memoryPlan.getOffset(tensor->getId()));
+    }
+
+    miopenDestroy(handle);
+}
+
+TEST(GPU_GraphApiMemoryPlanner_FP32, FusedSoftmax)
+{
+    auto& handle = get_handle();
+    auto h       = static_cast<miopenHandle_t>(&handle);
+
+    FusedSoftmax softmax;
+    auto plan = softmax.makePlan(h);
+    ASSERT_FALSE(plan.getMemoryPlan().empty());
+
+    tensor<float> x{softmax.dims};
+    tensor<float> y{softmax.dims};
+    for(size_t i = 0; i < x.data.size(); ++i)
+    {
+        x.data[i] = 4.0f * std::sin(0.37f * static_cast<float>(i));
+    }
+
+    auto xDev = handle.Write(x.data);
+    auto yDev = handle.Write(y.data);
+
+    Workspace ws(plan.getWorkspaceSize());
+    gr::VariantPack vpk{
+        {softmax.x->getId(), softmax.y->getId()}, {xDev.get(), yDev.get()}, ws.ptr()};
+
+    // Twice, so that the second run starts from the leftovers of the first one
+    plan.execute(h, vpk);
+    plan.execute(h, vpk);
+    handle.ReadToVec(yDev, y.data);
+
+    const size_t rowSize = softmax.dims.back();
+    for(size_t row = 0; row < x.data.size() / rowSize; ++row)
+    {
+        const auto* xRow = &x.data[row * rowSize];
+        float rowMax     = xRow[0];
+        for(size_t i = 1; i < rowSize; ++i)
+            rowMax = std::max(rowMax, xRow[i]);
+        float rowSum = 0.0f;
+        for(size_t i = 0; i < rowSize; ++i)
+            rowSum += std::exp(xRow[i] - rowMax);
+        for(size_t i = 0; i < rowSize; ++i)
+        {
+            EXPECT_NEAR(y.data[row * rowSize + i], std::exp(xRow[i] - rowMax) / rowSum, 1e-6)
+                << "row " << row << ", element " << i;
+        }
+    }
+}
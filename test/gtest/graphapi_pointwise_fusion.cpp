@@ -0,0 +1,391 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/pointwise_fusion_executor.hpp>
+#include <miopen/graphapi/reduction.hpp>
+#include <miopen/graphapi/reshape.hpp>
+#include <miopen/graphapi/util.hpp>
+
+#include <gtest/gtest.h>
+
+#include "../get_handle.hpp"
+#include "../tensor_holder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace gr = miopen::graphapi;
+
+namespace {
+
+class PointwiseChain
+{
+    gr::AutoDeleteAllocator mAlloc;
+
+public:
+    std::vector<size_t> full{2, 8, 4, 4};
+    std::vector<size_t> channel{1, 8, 1, 1};
+
+    template <bool IsVirtual>
+    gr::Tensor* tensor(const char* name, miopenDataType_t type, const std::vector<size_t>& dims)
+    {
+        return mAlloc.allocate(gr::makeTensor<IsVirtual>(name, type, dims));
+    }
+
+    template <typename T>
+    T* alloc(T&& obj)
+    {
+        return mAlloc.allocate(std::move(obj));
+    }
+
+    gr::Pointwise* pointwiseDesc(miopenPointwiseMode_t mode)
+    {
+        return mAlloc.allocate(
+            gr::PointwiseBuilder{}.setMode(mode).setMathPrecision(miopenFloat).build());
+    }
+
+    gr::OperationPointwise* pointwise(miopenPointwiseMode_t mode,
+                                      gr::Tensor* x,
+                                      gr::Tensor* b,
+                                      gr::Tensor* y,
+                                      float alpha2 = 1.0f)
+    {
+        gr::OperationPointwiseBuilder builder;
+        builder.setPointwise(pointwiseDesc(mode)).setX(x).setY(y);
+        if(b != nullptr)
+        {
+            builder.setB(b).setAlpha2(alpha2);
+        }
+        return mAlloc.allocate(builder.build());
+    }
+
+    gr::OperationReduction* reduction(miopenReduceTensorOp_t op, gr::Tensor* x, gr::Tensor* y)
+    {
+        auto* red = mAlloc.allocate(
+            gr::ReductionBuilder{}.setReductionOperator(op).setCompType(miopenFloat).build());
+        return mAlloc.allocate(
+            gr::OperationReductionBuilder{}.setReduction(red).setX(x).setY(y).build());
+    }
+
+    gr::OperationReshape* reshape(gr::Tensor* x, gr::Tensor* y)
+    {
+        return mAlloc.allocate(gr::OperationReshapeBuilder{}.setX(x).setY(y).build());
+    }
+
+    // y = relu((x + bias) * scale) + 0.5 * z
+    gr::OpGraph biasScaleReluAdd()
+    {
+        auto* x  = tensor<false>("X", miopenHalf, full);
+        auto* b  = tensor<false>("B", miopenFloat, channel);
+        auto* s  = tensor<false>("S", miopenFloat, channel);
+        auto* z  = tensor<false>("Z", miopenFloat, full);
+        auto* t0 = tensor<true>("T0", miopenFloat, full);
+        auto* t1 = tensor<true>("T1", miopenFloat, full);
+        auto* t2 = tensor<true>("T2", miopenFloat, full);
+        auto* y  = tensor<false>("Y", miopenBFloat16, full);
+
+        gr::OpGraphBuilder gb;
+        gb.addNode(pointwise(MIOPEN_POINTWISE_ADD, x, b, t0));
+        gb.addNode(pointwise(MIOPEN_POINTWISE_MUL, t0, s, t1));
+        gb.addNode(pointwise(MIOPEN_POINTWISE_RELU_FWD, t1, nullptr, t2));
+        gb.addNode(pointwise(MIOPEN_POINTWISE_ADD, t2, z, y, 0.5f));
+        return std::move(gb).build();
+    }
+};
+
+const gr::PointwiseFusionExecutor& asFusion(const std::unique_ptr<gr::GraphPatternExecutor>& e)
+{
+    const auto* fusion = dynamic_cast<const gr::PointwiseFusionExecutor*>(e.get());
+    EXPECT_NE(fusion, nullptr);
+    return *fusion;
+}
+
+} // namespace
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, ChainGeneratesOneKernel)
+{
+    PointwiseChain chain;
+    auto graph = chain.biasScaleReluAdd();
+
+    ASSERT_TRUE(gr::PointwiseFusionExecutor::isFusible(graph));
+    auto executor = gr::PointwiseFusionExecutor::make(graph);
+    ASSERT_NE(executor, nullptr);
+
+    const auto& fusion = asFusion(executor);
+    const auto& src    = fusion.getKernelSource();
+
+    EXPECT_FALSE(fusion.hasReductions());
+    EXPECT_EQ(fusion.getElementCount(), 2 * 8 * 4 * 4);
+    // X, B, S, Z and Y; virtual tensors are not kernel arguments
+    EXPECT_EQ(fusion.getArgTensors().size(), 5);
+    EXPECT_EQ(fusion.getWorkspaceSize(), 0);
+    EXPECT_EQ(fusion.getProgramName().rfind("MIOpenGraphPointwiseFusion_", 0), 0);
+
+    EXPECT_NE(src.find("__global__ void MIOpenGraphPointwiseFusion("), std::string::npos);
+    EXPECT_EQ(src.find("MIOpenGraphPointwiseFusionInit"), std::string::npos);
+    EXPECT_NE(src.find("const _Float16* __restrict__"), std::string::npos);
+    EXPECT_NE(src.find("unsigned short* __restrict__"), std::string::npos);
+    EXPECT_NE(src.find("float_to_bf16("), std::string::npos);
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, SourceIsDeterministic)
+{
+    PointwiseChain chain1;
+    PointwiseChain chain2;
+    auto graph1 = chain1.biasScaleReluAdd();
+    auto graph2 = chain2.biasScaleReluAdd();
+
+    auto e1 = gr::PointwiseFusionExecutor::make(graph1);
+    auto e2 = gr::PointwiseFusionExecutor::make(graph2);
+    ASSERT_NE(e1, nullptr);
+    ASSERT_NE(e2, nullptr);
+    EXPECT_EQ(asFusion(e1).getKernelSource(), asFusion(e2).getKernelSource());
+    EXPECT_EQ(asFusion(e1).getProgramName(), asFusion(e2).getProgramName());
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, TerminalReduction)
+{
+    PointwiseChain chain;
+    auto* x  = chain.tensor<false>("X", miopenFloat, chain.full);
+    auto* t0 = chain.tensor<true>("T0", miopenFloat, chain.full);
+    auto* y  = chain.tensor<false>("Y", miopenFloat, chain.full);
+    auto* m  = chain.tensor<false>("M", miopenFloat, std::vector<size_t>{2, 8, 4, 1});
+
+    gr::OpGraphBuilder gb;
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_RELU_FWD, x, nullptr, t0));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_MUL, t0, t0, y));
+    gb.addNode(chain.reduction(MIOPEN_REDUCE_TENSOR_MAX, t0, m));
+    auto graph = std::move(gb).build();
+
+    ASSERT_TRUE(gr::PointwiseFusionExecutor::isFusible(graph));
+    auto executor = gr::PointwiseFusionExecutor::make(graph);
+    ASSERT_NE(executor, nullptr);
+
+    const auto& fusion = asFusion(executor);
+    const auto& src    = fusion.getKernelSource();
+    EXPECT_TRUE(fusion.hasReductions());
+    EXPECT_NE(src.find("__global__ void MIOpenGraphPointwiseFusionInit("), std::string::npos);
+    EXPECT_NE(src.find("atomic_update"), std::string::npos);
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, ConsumedReductionStartsNextKernel)
+{
+    // y = softmax(x) along the last dimension
+    PointwiseChain chain;
+    const std::vector<size_t> rows{2, 8, 4, 1};
+    auto* x    = chain.tensor<false>("X", miopenFloat, chain.full);
+    auto* max  = chain.tensor<true>("MAX", miopenFloat, rows);
+    auto* diff = chain.tensor<true>("DIFF", miopenFloat, chain.full);
+    auto* exp  = chain.tensor<true>("EXP", miopenFloat, chain.full);
+    auto* sum  = chain.tensor<true>("SUM", miopenFloat, rows);
+    auto* y    = chain.tensor<false>("Y", miopenFloat, chain.full);
+
+    gr::OpGraphBuilder gb;
+    gb.addNode(chain.reduction(MIOPEN_REDUCE_TENSOR_MAX, x, max));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_SUB, x, max, diff));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_EXP, diff, nullptr, exp));
+    gb.addNode(chain.reduction(MIOPEN_REDUCE_TENSOR_ADD, exp, sum));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_DIV, exp, sum, y));
+    auto graph = std::move(gb).build();
+
+    auto executor = gr::PointwiseFusionExecutor::make(graph);
+    ASSERT_NE(executor, nullptr);
+    const auto& fusion = asFusion(executor);
+    const auto& src    = fusion.getKernelSource();
+
+    EXPECT_EQ(fusion.getKernelCount(), 3);
+    EXPECT_NE(src.find("MIOpenGraphPointwiseFusion1("), std::string::npos);
+    EXPECT_NE(src.find("MIOpenGraphPointwiseFusion2("), std::string::npos);
+    EXPECT_EQ(fusion.getWorkspaceSize(), 0);
+
+    // Reduction results and tensors read by a later kernel go to planned buffers, DIFF does not
+    ASSERT_TRUE(fusion.needsVirtualTensorBuffers());
+    std::vector<int64_t> buffered;
+    for(const auto& buffer : fusion.getVirtualTensorBuffers(graph))
+    {
+        EXPECT_LE(buffer.firstStep, buffer.lastStep);
+        EXPECT_LE(buffer.lastStep, fusion.getKernelCount());
+        buffered.push_back(buffer.tensorId);
+    }
+    std::sort(buffered.begin(), buffered.end());
+    std::vector<int64_t> expected{max->getId(), exp->getId(), sum->getId()};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(buffered, expected);
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, RejectsOutputSmallerThanIterationSpace)
+{
+    PointwiseChain chain;
+    auto* x  = chain.tensor<false>("X", miopenFloat, chain.full);
+    auto* t0 = chain.tensor<true>("T0", miopenFloat, std::vector<size_t>{2, 8, 4, 1});
+    auto* y  = chain.tensor<false>("Y", miopenFloat, std::vector<size_t>{2, 8, 4, 1});
+
+    gr::OpGraphBuilder gb;
+    gb.addNode(chain.reduction(MIOPEN_REDUCE_TENSOR_ADD, x, t0));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_EXP, t0, nullptr, y));
+    auto graph = std::move(gb).build();
+
+    EXPECT_FALSE(gr::PointwiseFusionExecutor::isFusible(graph));
+    EXPECT_EQ(gr::PointwiseFusionExecutor::make(graph), nullptr);
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, RejectsReshapeOfVirtualTensor)
+{
+    PointwiseChain chain;
+    auto* x  = chain.tensor<false>("X", miopenFloat, std::vector<size_t>{2, 8, 4, 4});
+    auto* t0 = chain.tensor<true>("T0", miopenFloat, std::vector<size_t>{2, 8, 4, 4});
+    auto* t1 = chain.tensor<true>("T1", miopenFloat, std::vector<size_t>{2, 8, 16, 1});
+    auto* y  = chain.tensor<false>("Y", miopenFloat, std::vector<size_t>{2, 8, 16, 1});
+
+    gr::OpGraphBuilder gb;
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_EXP, x, nullptr, t0));
+    gb.addNode(chain.reshape(t0, t1));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_LOG, t1, nullptr, y));
+    auto graph = std::move(gb).build();
+
+    EXPECT_FALSE(gr::PointwiseFusionExecutor::isFusible(graph));
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, RejectsBackwardModes)
+{
+    PointwiseChain chain;
+    auto* y  = chain.tensor<false>("Y", miopenFloat, chain.full);
+    auto* dy = chain.tensor<false>("DY", miopenFloat, chain.full);
+    auto* dx = chain.tensor<false>("DX", miopenFloat, chain.full);
+
+    auto* pw = chain.pointwiseDesc(MIOPEN_POINTWISE_RELU_BWD);
+    gr::OpGraphBuilder gb;
+    gb.addNode(chain.alloc(gr::OperationPointwiseBuilder{}
+                               .setPointwise(pw)
+                               .setY(y)
+                               .setDy(dy)
+                               .setDx(dx)
+                               .build()));
+    auto graph = std::move(gb).build();
+
+    EXPECT_FALSE(gr::PointwiseFusionExecutor::isFusible(graph));
+}
+
+TEST(CPU_GraphApiPointwiseFusion_NONE, FindEnginesFallsBackToFusion)
+{
+    PointwiseChain chain;
+    auto graph   = chain.biasScaleReluAdd();
+    auto engines = gr::findEngines(&graph);
+
+    ASSERT_EQ(engines.size(), 1);
+    EXPECT_NE(dynamic_cast<gr::PointwiseFusionExecutor*>(engines.front().getExecutor()),
+              nullptr);
+}
+
+TEST(GPU_GraphApiPointwiseFusion_FP32, MatchesCpuReference)
+{
+    // y = relu((x + bias) * scale) + 0.5 * z, m = max of relu(...) along the last dimension
+    PointwiseChain chain;
+    const std::vector<size_t> rows{2, 8, 4, 1};
+    auto* x  = chain.tensor<false>("X", miopenFloat, chain.full);
+    auto* b  = chain.tensor<false>("B", miopenFloat, chain.channel);
+    auto* s  = chain.tensor<false>("S", miopenFloat, chain.channel);
+    auto* z  = chain.tensor<false>("Z", miopenFloat, chain.full);
+    auto* t0 = chain.tensor<true>("T0", miopenFloat, chain.full);
+    auto* t1 = chain.tensor<true>("T1", miopenFloat, chain.full);
+    auto* t2 = chain.tensor<true>("T2", miopenFloat, chain.full);
+    auto* y  = chain.tensor<false>("Y", miopenFloat, chain.full);
+    auto* m  = chain.tensor<false>("M", miopenFloat, rows);
+
+    gr::OpGraphBuilder gb;
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_ADD, x, b, t0));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_MUL, t0, s, t1));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_RELU_FWD, t1, nullptr, t2));
+    gb.addNode(chain.pointwise(MIOPEN_POINTWISE_ADD, t2, z, y, 0.5f));
+    gb.addNode(chain.reduction(MIOPEN_REDUCE_TENSOR_MAX, t2, m));
+    auto graph = std::move(gb).build();
+
+    auto executor = gr::PointwiseFusionExecutor::make(graph);
+    ASSERT_NE(executor, nullptr);
+    ASSERT_TRUE(asFusion(executor).hasReductions());
+    ASSERT_FALSE(executor->needsVirtualTensorBuffers());
+
+    tensor<float> xHost{chain.full};
+    tensor<float> bHost{chain.channel};
+    tensor<float> sHost{chain.channel};
+    tensor<float> zHost{chain.full};
+    tensor<float> yHost{chain.full};
+    tensor<float> mHost{rows};
+    for(size_t i = 0; i < xHost.data.size(); ++i)
+    {
+        xHost.data[i] = 2.0f * std::sin(0.37f * static_cast<float>(i));
+        zHost.data[i] = std::cos(0.11f * static_cast<float>(i));
+    }
+    for(size_t c = 0; c < bHost.data.size(); ++c)
+    {
+        bHost.data[c] = 0.25f * static_cast<float>(c) - 1.0f;
+        sHost.data[c] = 1.5f - 0.125f * static_cast<float>(c);
+    }
+
+    auto& handle = get_handle();
+    auto h       = static_cast<miopenHandle_t>(&handle);
+    auto xDev    = handle.Write(xHost.data);
+    auto bDev    = handle.Write(bHost.data);
+    auto sDev    = handle.Write(sHost.data);
+    auto zDev    = handle.Write(zHost.data);
+    auto yDev    = handle.Write(yHost.data);
+    auto mDev    = handle.Write(mHost.data);
+
+    gr::VariantPack vpk{
+        {x->getId(), b->getId(), s->getId(), z->getId(), y->getId(), m->getId()},
+        {xDev.get(), bDev.get(), sDev.get(), zDev.get(), yDev.get(), mDev.get()},
+        nullptr};
+
+    // Twice: the first run builds the kernels, the second one takes them from the cache and has
+    // to reinitialize the reduction output
+    executor->execute(h, vpk);
+    executor->execute(h, vpk);
+    handle.ReadToVec(yDev, yHost.data);
+    handle.ReadToVec(mDev, mHost.data);
+
+    const size_t channels = chain.full[1];
+    const size_t rowSize  = chain.full.back();
+    const size_t rowsPerC = chain.full[2];
+    for(size_t row = 0; row < mHost.data.size(); ++row)
+    {
+        const size_t c = (row / rowsPerC) % channels;
+        float rowMax   = 0.0f;
+        for(size_t i = 0; i < rowSize; ++i)
+        {
+            const size_t idx = row * rowSize + i;
+            const float relu = std::max((xHost.data[idx] + bHost.data[c]) * sHost.data[c], 0.0f);
+            rowMax           = i == 0 ? relu : std::max(rowMax, relu);
+            EXPECT_NEAR(yHost.data[idx], relu + 0.5f * zHost.data[idx], 1e-5)
+                << "element " << idx;
+        }
+        EXPECT_NEAR(mHost.data[row], rowMax, 1e-5) << "row " << row;
+    }
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/invoker_snapshot.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <vector>
+
+// Code objects are attached to solutions by the HIP backend only.
+#if MIOPEN_BACKEND_HIP
+TEST(GPU_InvokerSnapshot_FP32, SaveAndLoad)
+{
+    miopen::env::update(MIOPEN_INVOKER_SNAPSHOT, true);
+
+    auto& handle = get_handle();
+    auto x       = miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 8, 16, 16}};
+    auto w       = miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{8, 8, 1, 1}};
+    auto y       = miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 8, 16, 16}};
+    auto conv    = miopen::ConvolutionDescriptor{{0, 0}, {1, 1}, {1, 1}, {0, 0}};
+
+    auto solution = miopenConvSolution_t{};
+    auto count    = std::size_t{0};
+    ASSERT_EQ(
+        miopenConvolutionForwardGetSolution(&handle, &w, &x, &conv, &y, 1, &count, &solution),
+        miopenStatusSuccess);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(
+        miopenConvolutionForwardCompileSolution(&handle, &w, &x, &conv, &y, solution.solution_id),
+        miopenStatusSuccess);
+
+    const auto tmp  = miopen::TmpDir{"invoker_snapshot"};
+    const auto file = tmp / "snapshot.bin";
+    auto saved      = std::size_t{0};
+    ASSERT_EQ(miopenSaveInvokerSnapshot(&handle, file.string().c_str(), &saved),
+              miopenStatusSuccess);
+    EXPECT_GE(saved, 1);
+
+    auto other  = miopen::Handle{};
+    auto loaded = std::size_t{0};
+    ASSERT_EQ(miopenLoadInvokerSnapshot(&other, file.string().c_str(), &loaded),
+              miopenStatusSuccess);
+    EXPECT_EQ(loaded, saved);
+
+    const auto problem =
+        miopen::conv::ProblemDescription{x, w, y, conv, miopen::conv::Direction::Forward};
+    const auto solver_id = miopen::solver::Id{solution.solution_id};
+    EXPECT_TRUE(other.GetInvoker(problem.MakeNetworkConfig(), solver_id));
+
+    miopen::env::clear(MIOPEN_INVOKER_SNAPSHOT);
+}
+#endif
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/metrics.hpp>
+#include <miopen/miopen.h>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <sstream>
+
+using miopen::metrics::Histogram;
+
+TEST(CPU_MetricsHistogram_NONE, BucketsCoverValues)
+{
+    for(std::uint64_t value : {0ull, 1ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, ~0ull})
+    {
+        const auto bucket = Histogram::BucketOf(value);
+        ASSERT_LT(bucket, Histogram::bucket_num);
+        EXPECT_LE(Histogram::LowerBound(bucket), value);
+        if(bucket + 1 < Histogram::bucket_num)
+        {
+            EXPECT_GT(Histogram::LowerBound(bucket + 1), value);
+        }
+    }
+}
+
+TEST(CPU_MetricsHistogram_NONE, Percentiles)
+{
+    auto histogram = Histogram{};
+    EXPECT_EQ(histogram.Percentile(50), 0);
+
+    // 1us .. 100us
+    for(std::uint64_t i = 1; i <= 100; ++i)
+        histogram.Record(i * 1000);
+
+    EXPECT_EQ(histogram.Count(), 100);
+    EXPECT_EQ(histogram.Min(), 1000);
+    EXPECT_EQ(histogram.Max(), 100000);
+    EXPECT_EQ(histogram.Sum(), 5050000);
+
+    for(const auto percentile : {1., 50., 90., 99.})
+    {
+        const auto expected = percentile * 1000.;
+        const auto actual   = static_cast<double>(histogram.Percentile(percentile));
+        EXPECT_NEAR(actual, expected, expected * 0.125) << percentile;
+    }
+    EXPECT_EQ(histogram.Percentile(100), 100000);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.Count(), 0);
+    EXPECT_EQ(histogram.Min(), 0);
+}
+
+TEST(CPU_Metrics_NONE, QueryThroughApi)
+{
+    ASSERT_EQ(miopenResetMetrics(), miopenStatusSuccess);
+
+    miopen::metrics::CountDbLookup(miopen::DbKinds::FindDb, true);
+    miopen::metrics::CountDbLookup(miopen::DbKinds::FindDb, false);
+    miopen::metrics::CountDbLookup(miopen::DbKinds::FindDb, false);
+    miopen::metrics::GetHistogram("test.latency").Record(2000000);
+
+    auto value = std::size_t{};
+    ASSERT_EQ(miopenGetMetricCounter("find_db.hits", &value), miopenStatusSuccess);
+    EXPECT_EQ(value, 1);
+    ASSERT_EQ(miopenGetMetricCounter("find_db.misses", &value), miopenStatusSuccess);
+    EXPECT_EQ(value, 2);
+    ASSERT_EQ(miopenGetMetricCounter("no.such.counter", &value), miopenStatusSuccess);
+    EXPECT_EQ(value, 0);
+
+    auto latency = float{};
+    auto count   = std::size_t{};
+    ASSERT_EQ(miopenGetMetricLatency("test.latency", 50.f, &latency, &count),
+              miopenStatusSuccess);
+    EXPECT_FLOAT_EQ(latency, 2.f);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(miopenGetMetricLatency("test.latency", 101.f, &latency, &count),
+              miopenStatusBadParm);
+
+    std::ostringstream ss;
+    miopen::metrics::Dump(ss);
+    const auto json = nlohmann::json::parse(ss.str());
+    EXPECT_EQ(json.at("counters").at("find_db.misses"), 2);
+    EXPECT_EQ(json.at("latencies").at("test.latency").at("count"), 1);
+}
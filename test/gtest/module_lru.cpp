@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/module_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+
+struct Unloads
+{
+    std::vector<int> ids;
+
+    miopen::ModuleLru::Unloader For(int id)
+    {
+        return [this, id]() { ids.push_back(id); };
+    }
+};
+
+} // namespace
+
+TEST(CPU_ModuleLru_NONE, EvictsLeastRecentlyUsed)
+{
+    auto lru     = miopen::ModuleLru{2};
+    auto unloads = Unloads{};
+    int a, b, c;
+
+    lru.Touch(&a, unloads.For(0));
+    lru.Touch(&b, unloads.For(1));
+    lru.Touch(&a, unloads.For(0)); // b is now the least recently used
+    EXPECT_TRUE(unloads.ids.empty());
+
+    lru.Touch(&c, unloads.For(2));
+    EXPECT_EQ(unloads.ids, std::vector<int>{1});
+    EXPECT_EQ(lru.Size(), 2u);
+
+    lru.Touch(&b, unloads.For(1));
+    EXPECT_EQ(unloads.ids, (std::vector<int>{1, 0}));
+    EXPECT_EQ(lru.Size(), 2u);
+}
+
+TEST(CPU_ModuleLru_NONE, ZeroBudgetIsUnlimited)
+{
+    auto lru     = miopen::ModuleLru{0};
+    auto unloads = Unloads{};
+    std::vector<int> keys(100);
+
+    for(auto& key : keys)
+        lru.Touch(&key, unloads.For(0));
+
+    EXPECT_TRUE(unloads.ids.empty());
+    EXPECT_EQ(lru.Size(), keys.size());
+}
+
+TEST(CPU_ModuleLru_NONE, ForgetDoesNotUnload)
+{
+    auto lru     = miopen::ModuleLru{1};
+    auto unloads = Unloads{};
+    int a, b;
+
+    lru.Touch(&a, unloads.For(0));
+    lru.Forget(&a);
+    EXPECT_EQ(lru.Size(), 0u);
+
+    lru.Touch(&b, unloads.For(1));
+    EXPECT_TRUE(unloads.ids.empty());
+}
+
+TEST(CPU_ModuleLru_NONE, PinnedAreNotEvicted)
+{
+    auto lru     = miopen::ModuleLru{1};
+    auto unloads = Unloads{};
+    int a, b, c;
+
+    lru.Pin(&a, unloads.For(0));
+    lru.Pin(&a, unloads.For(0));
+    lru.Touch(&b, unloads.For(1)); // Over budget, but a is pinned
+    EXPECT_TRUE(unloads.ids.empty());
+    EXPECT_EQ(lru.Size(), 2u);
+
+    lru.Touch(&c, unloads.For(2));
+    EXPECT_EQ(unloads.ids, std::vector<int>{1});
+
+    lru.Unpin(&a); // Still pinned once, c is the only candidate
+    EXPECT_EQ(unloads.ids, (std::vector<int>{1, 2}));
+    EXPECT_EQ(lru.Size(), 1u);
+
+    lru.Unpin(&a);
+    lru.Touch(&b, unloads.For(1));
+    EXPECT_EQ(unloads.ids, (std::vector<int>{1, 2, 0}));
+    EXPECT_EQ(lru.Size(), 1u);
+}
@@ -0,0 +1,282 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_record.hpp>
+#include <miopen/packed_values.hpp>
+#include <miopen/serializable.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace {
+
+namespace serialize = miopen::solver::serialize;
+
+template <class Derived>
+struct PackedConfigBase : miopen::solver::Serializable<Derived>
+{
+    int a          = 0;
+    std::int64_t b = 0;
+    unsigned c     = 0;
+    bool d         = false;
+    short e        = 0;
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.a, "a");
+        f(self.b, "b");
+        f(self.c, "c");
+        f(self.d, "d");
+        f(self.e, "e");
+    }
+};
+
+struct PackedConfig : PackedConfigBase<PackedConfig>
+{
+};
+
+struct PackedConfigV2 : PackedConfigBase<PackedConfigV2>
+{
+    static constexpr unsigned serialization_version = 2;
+};
+
+struct StringConfig : miopen::solver::Serializable<StringConfig>
+{
+    std::string name;
+    int value = 0;
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.name, "name");
+        f(self.value, "value");
+    }
+};
+
+struct RawValues
+{
+    std::string text;
+
+    void Serialize(std::ostream& stream) const { stream << text; }
+    bool Deserialize(const std::string& s)
+    {
+        text = s;
+        return true;
+    }
+};
+
+struct RawPackedValues : RawValues
+{
+    bool SerializePacked(std::string&) const { return false; }
+};
+
+std::string ToText(const PackedConfig& config)
+{
+    std::ostringstream ss;
+    config.Serialize(ss);
+    return ss.str();
+}
+
+} // namespace
+
+TEST(CPU_PackedValues_NONE, TextRoundTrip)
+{
+    for(const auto& text : {"", "0", "1,2,3", "-1,-32,33,1024", "9223372036854775807",
+                            "-9223372036854775808,0,-9223372036854775807"})
+    {
+        std::string packed;
+        ASSERT_TRUE(serialize::PackText(text, packed)) << text;
+        EXPECT_TRUE(serialize::IsPacked(packed));
+        EXPECT_EQ(packed.find_first_of(",;:= \n"), std::string::npos) << packed;
+
+        std::string unpacked;
+        ASSERT_TRUE(serialize::UnpackToText(packed, unpacked)) << packed;
+        EXPECT_EQ(unpacked, text);
+    }
+}
+
+TEST(CPU_PackedValues_NONE, RejectsNonCanonicalText)
+{
+    for(const auto& text : {"007", "1,", ",1", "a,b", "-0", "+1", "1.5", " 1"})
+    {
+        std::string packed = "untouched";
+        EXPECT_FALSE(serialize::PackText(text, packed)) << text;
+        EXPECT_EQ(packed, "untouched");
+    }
+
+    std::string text;
+    EXPECT_FALSE(serialize::UnpackToText("1,2", text));
+    EXPECT_FALSE(serialize::UnpackToText("~", text));
+    EXPECT_FALSE(serialize::UnpackToText("~02!", text));
+}
+
+TEST(CPU_PackedValues_NONE, MatchesText)
+{
+    PackedConfig config;
+    config.a = -7;
+    config.b = std::numeric_limits<std::int64_t>::min();
+    config.c = 4000000000u;
+    config.d = true;
+    config.e = -300;
+
+    std::string packed;
+    ASSERT_TRUE(config.SerializePacked(packed));
+
+    PackedConfig from_packed;
+    PackedConfig from_text;
+    ASSERT_TRUE(from_packed.Deserialize(packed));
+    ASSERT_TRUE(from_text.Deserialize(ToText(config)));
+    EXPECT_EQ(ToText(from_packed), ToText(config));
+    EXPECT_EQ(ToText(from_text), ToText(config));
+
+    // Conversion tools pack text VALUES with the default schema version.
+    std::string converted;
+    ASSERT_TRUE(serialize::PackText(ToText(config), converted));
+    PackedConfig from_converted;
+    ASSERT_TRUE(from_converted.Deserialize(converted));
+    EXPECT_EQ(ToText(from_converted), ToText(config));
+}
+
+TEST(CPU_PackedValues_NONE, ChecksSchema)
+{
+    PackedConfig config;
+    config.a = 1;
+
+    std::string packed;
+    ASSERT_TRUE(config.SerializePacked(packed));
+
+    PackedConfigV2 newer;
+    EXPECT_FALSE(newer.Deserialize(packed));
+
+    std::string too_short;
+    ASSERT_TRUE(serialize::PackText("1,2,3,1", too_short));
+    PackedConfig unchanged;
+    EXPECT_FALSE(unchanged.Deserialize(too_short));
+    EXPECT_EQ(unchanged.a, 0);
+
+    std::string out_of_range;
+    ASSERT_TRUE(serialize::PackText("1,2,3,1,32768", out_of_range));
+    EXPECT_FALSE(unchanged.Deserialize(out_of_range));
+    ASSERT_TRUE(serialize::PackText("1,2,3,2,-1", out_of_range));
+    EXPECT_FALSE(unchanged.Deserialize(out_of_range));
+
+    // Schema version 0 is only read back by the conversion tools.
+    std::string legacy;
+    ASSERT_TRUE(serialize::PackText(ToText(config), legacy, ',', 0));
+    EXPECT_FALSE(unchanged.Deserialize(legacy));
+    std::string text;
+    ASSERT_TRUE(serialize::UnpackToText(legacy, text));
+    EXPECT_EQ(text, ToText(config));
+
+    StringConfig named;
+    ASSERT_TRUE(serialize::PackText("42,3", legacy, ',', 0));
+    EXPECT_FALSE(named.Deserialize(legacy));
+}
+
+TEST(CPU_PackedValues_NONE, FallsBackToText)
+{
+    StringConfig config;
+    config.name  = "7";
+    config.value = 1;
+
+    std::string packed;
+    EXPECT_FALSE(config.SerializePacked(packed));
+    EXPECT_TRUE(packed.empty());
+
+    std::string converted;
+    ASSERT_TRUE(serialize::PackText("42,3", converted));
+    ASSERT_TRUE(config.Deserialize(converted));
+    EXPECT_EQ(config.name, "42");
+    EXPECT_EQ(config.value, 3);
+
+    miopen::DbRecord record{miopen::DbKinds::PerfDb, std::string{"key"}};
+    ASSERT_TRUE(record.SetValues("id", config, true));
+    RawValues raw;
+    ASSERT_TRUE(record.GetValues("id", raw));
+    EXPECT_EQ(raw.text, "42,3");
+}
+
+TEST(CPU_PackedValues_NONE, DbRecord)
+{
+    PackedConfig config;
+    config.a = 5;
+    config.c = 6;
+
+    miopen::DbRecord record{miopen::DbKinds::PerfDb, std::string{"key"}};
+    ASSERT_TRUE(record.SetValues("packed", config, true));
+    ASSERT_TRUE(record.SetValues("text", config, false));
+
+    // Types without packed support receive the text form.
+    RawValues packed;
+    RawValues text;
+    ASSERT_TRUE(record.GetValues("packed", packed));
+    ASSERT_TRUE(record.GetValues("text", text));
+    EXPECT_EQ(packed.text, ToText(config));
+    EXPECT_EQ(text.text, ToText(config));
+
+    // Types with packed support receive the stored form.
+    RawPackedValues stored;
+    ASSERT_TRUE(record.GetValues("packed", stored));
+    EXPECT_TRUE(serialize::IsPacked(stored.text)) << stored.text;
+
+    PackedConfig loaded;
+    ASSERT_TRUE(record.GetValues("packed", loaded));
+    EXPECT_EQ(ToText(loaded), ToText(config));
+}
+
+TEST(CPU_PackedValues_NONE, MergeKeepsRecordFormat)
+{
+    PackedConfig config;
+    config.a = 7;
+    config.b = -8;
+
+    miopen::DbRecord text_record{miopen::DbKinds::PerfDb, std::string{"key"}};
+    ASSERT_TRUE(text_record.SetValues("old", config, false));
+    miopen::DbRecord packed_record{miopen::DbKinds::PerfDb, std::string{"key"}};
+    ASSERT_TRUE(packed_record.SetValues("old", config, true));
+
+    // A record without packed VALUES stays text.
+    miopen::DbRecord update{miopen::DbKinds::PerfDb, std::string{"key"}};
+    ASSERT_TRUE(update.SetPackableValues("new", config));
+    update.Merge(text_record);
+    EXPECT_FALSE(update.HasPackedValues());
+
+    // A packed record stays packed.
+    update = miopen::DbRecord{miopen::DbKinds::PerfDb, std::string{"key"}};
+    ASSERT_TRUE(update.SetPackableValues("new", config));
+    update.Merge(packed_record);
+    RawPackedValues stored;
+    ASSERT_TRUE(update.GetValues("new", stored));
+    EXPECT_TRUE(serialize::IsPacked(stored.text)) << stored.text;
+
+    PackedConfig loaded;
+    ASSERT_TRUE(update.GetValues("new", loaded));
+    EXPECT_EQ(ToText(loaded), ToText(config));
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/selection_policy.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using miopen::SelectionPolicy;
+using miopen::SolutionCost;
+
+constexpr std::size_t MiB = 1024 * 1024;
+
+const auto costs = std::vector<SolutionCost>{
+    {1.00f, 64 * MiB, false}, // fastest
+    {1.03f, 4 * MiB, false},  // 3% slower, 16x less workspace
+    {1.05f, 8 * MiB, false},  // dominated by the previous one
+    {2.00f, 0, true},         // slow, no workspace, deterministic
+    {2.50f, 0, false},        // dominated by the previous one
+};
+
+double Weighted(float time, size_t workspace, int deterministic, void* user_data)
+{
+    const auto ms_per_mib = *static_cast<const double*>(user_data);
+    return time + ms_per_mib * static_cast<double>(workspace) / MiB - 0.5 * deterministic;
+}
+
+} // namespace
+
+TEST(CPU_SelectionPolicy_NONE, ParetoFront)
+{
+    EXPECT_EQ(SelectionPolicy::ParetoFront(costs), (std::vector<std::size_t>{0, 1, 3}));
+    EXPECT_TRUE(SelectionPolicy::ParetoFront({}).empty());
+
+    // Equal solutions do not dominate each other.
+    const auto same = std::vector<SolutionCost>{{1.0f, 0, true}, {1.0f, 0, true}};
+    EXPECT_EQ(SelectionPolicy::ParetoFront(same), (std::vector<std::size_t>{0, 1}));
+}
+
+TEST(CPU_SelectionPolicy_NONE, OrdersFrontByCost)
+{
+    EXPECT_EQ(SelectionPolicy{}.Select(costs), (std::vector<std::size_t>{0, 1, 3}));
+
+    const auto by_workspace = SelectionPolicy{
+        [](const SolutionCost& cost) { return static_cast<double>(cost.workspace); }};
+    EXPECT_EQ(by_workspace.Select(costs), (std::vector<std::size_t>{3, 1, 0}));
+
+    auto ms_per_mib    = 0.01;
+    const auto trading = miopen::MakeSelectionPolicy(&Weighted, &ms_per_mib);
+    ASSERT_TRUE(trading);
+    EXPECT_EQ(trading->Select(costs), (std::vector<std::size_t>{1, 3, 0}));
+
+    ms_per_mib = 0.0001;
+    EXPECT_EQ(trading->Select(costs), (std::vector<std::size_t>{0, 1, 3}));
+
+    EXPECT_FALSE(miopen::MakeSelectionPolicy(nullptr, nullptr));
+}
+
+TEST(CPU_SelectionPolicy_NONE, Apply)
+{
+    auto names = std::vector<std::string>{"fast", "lean", "leanish", "det", "slow"};
+    const auto by_workspace = SelectionPolicy{
+        [](const SolutionCost& cost) { return static_cast<double>(cost.workspace); }};
+
+    auto i = std::size_t{0};
+    by_workspace.Apply(names, [&](const std::string&) { return costs[i++]; });
+    EXPECT_EQ(names, (std::vector<std::string>{"det", "lean", "fast"}));
+}
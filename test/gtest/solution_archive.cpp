@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solution.hpp>
+#include <miopen/solution_archive.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+miopen::Solution MakeSolution(const std::string& solver, float time, std::size_t workspace)
+{
+    auto problem = miopen::Problem{};
+    problem.SetDirection(miopenProblemDirectionForward);
+    problem.SetOperatorDescriptor(miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionX,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 8, 16, 16}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionW,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{8, 8, 3, 3}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionY,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 8, 16, 16}});
+
+    auto solution = miopen::Solution{miopen::solver::Id{solver}, time, workspace};
+    solution.SetProblem({problem});
+    return solution;
+}
+
+miopenStatus_t ReadStatus(const std::vector<std::uint8_t>& data)
+{
+    try
+    {
+        miopen::solution_archive::Read(data.data(), data.size());
+    }
+    catch(const miopen::Exception& ex)
+    {
+        return ex.status;
+    }
+    return miopenStatusSuccess;
+}
+
+} // namespace
+
+TEST(CPU_SolutionArchive_NONE, RoundTrip)
+{
+    auto first  = MakeSolution("ConvDirectNaiveConvFwd", 1.5f, 0);
+    auto second = MakeSolution("GemmFwd1x1_0_1", 0.25f, 4096);
+    second.SetPerfConfig("1,2,3");
+
+    const auto data = miopen::solution_archive::Write({&first, &second});
+    ASSERT_TRUE(miopen::solution_archive::IsArchive(data.data(), data.size()));
+    EXPECT_EQ(miopen::solution_archive::Count(data.data(), data.size()), 2);
+
+    const auto solutions = miopen::solution_archive::Read(data.data(), data.size());
+    ASSERT_EQ(solutions.size(), 2);
+    EXPECT_EQ(solutions[0].GetSolver(), first.GetSolver());
+    EXPECT_EQ(solutions[0].GetTime(), 1.5f);
+    EXPECT_FALSE(solutions[0].GetPerfConfig());
+    EXPECT_EQ(solutions[1].GetSolver(), second.GetSolver());
+    EXPECT_EQ(solutions[1].GetWorkspaceSize(), 4096);
+    EXPECT_EQ(solutions[1].GetPerfConfig(), std::optional<std::string>{"1,2,3"});
+    EXPECT_TRUE(solutions[1].GetKernels().empty());
+
+    const auto& problem = std::get<miopen::Problem>(solutions[1].GetProblem().item);
+    EXPECT_EQ(problem.GetDirection(), miopenProblemDirectionForward);
+    EXPECT_EQ(problem.GetTensorDescriptor(miopenTensorConvolutionW).GetLengths(),
+              (std::vector<std::size_t>{8, 8, 3, 3}));
+}
+
+TEST(CPU_SolutionArchive_NONE, RejectsDamagedData)
+{
+    const auto solution = MakeSolution("ConvDirectNaiveConvFwd", 1.0f, 0);
+    const auto data     = miopen::solution_archive::Write({&solution});
+    EXPECT_EQ(ReadStatus(data), miopenStatusSuccess);
+
+    auto truncated = data;
+    truncated.resize(data.size() - 1);
+    EXPECT_EQ(ReadStatus(truncated), miopenStatusInvalidValue);
+
+    auto signature = data;
+    signature[0]   = 'X';
+    EXPECT_FALSE(miopen::solution_archive::IsArchive(signature.data(), signature.size()));
+    EXPECT_EQ(ReadStatus(signature), miopenStatusInvalidValue);
+
+    // The version follows the 8-byte signature.
+    auto version                 = data;
+    const std::uint32_t previous = miopen::solution_archive::Version + 1;
+    std::memcpy(&version[8], &previous, sizeof(previous));
+    EXPECT_EQ(ReadStatus(version), miopenStatusVersionMismatch);
+
+    EXPECT_FALSE(miopen::solution_archive::IsArchive(data.data(), 16));
+}
+
+TEST(CPU_SolutionArchive_NONE, SaveAndLoadFile)
+{
+    const auto tmp  = miopen::TmpDir{"solution_archive"};
+    const auto file = tmp / "solutions.bin";
+
+    auto solutions = std::vector<miopen::Solution>{};
+    for(int i = 0; i < 4; ++i)
+        solutions.push_back(MakeSolution("ConvDirectNaiveConvFwd", static_cast<float>(i), i));
+
+    auto items = std::vector<const miopen::Solution*>{};
+    for(const auto& solution : solutions)
+        items.push_back(&solution);
+    miopen::solution_archive::Save(items, file);
+
+    EXPECT_EQ(miopen::solution_archive::Count(file), 4);
+    const auto loaded = miopen::solution_archive::Load(file);
+    ASSERT_EQ(loaded.size(), 4);
+    for(int i = 0; i < 4; ++i)
+        EXPECT_EQ(loaded[i].GetWorkspaceSize(), i);
+}
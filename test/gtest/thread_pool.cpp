@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/par_for.hpp>
+#include <miopen/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t workers = 4;
+
+} // namespace
+
+TEST(CPU_ThreadPool_NONE, CoversEveryIndexOnce)
+{
+    miopen::ThreadPool pool{workers};
+    std::vector<std::atomic<int>> hits(10007);
+
+    pool.ParallelFor(hits.size(), 13, workers + 1, [&](std::size_t first, std::size_t last) {
+        for(auto i = first; i < last; ++i)
+            ++hits[i];
+    });
+
+    for(const auto& hit : hits)
+        ASSERT_EQ(hit, 1);
+}
+
+TEST(CPU_ThreadPool_NONE, RespectsConcurrencyLimit)
+{
+    miopen::ThreadPool pool{workers};
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+
+    pool.ParallelFor(64, 1, 2, [&](std::size_t, std::size_t) {
+        const auto now = ++running;
+        auto prev      = peak.load();
+        while(prev < now && !peak.compare_exchange_weak(prev, now)) {}
+        std::this_thread::sleep_for(std::chrono::microseconds{200});
+        --running;
+    });
+
+    EXPECT_LE(peak, 2);
+}
+
+TEST(CPU_ThreadPool_NONE, NestedParallelism)
+{
+    // The outer loop occupies every worker, the inner ones must still finish
+    miopen::ThreadPool pool{workers};
+    std::atomic<std::size_t> sum{0};
+
+    pool.ParallelFor(workers * 2, 1, workers + 1, [&](std::size_t, std::size_t) {
+        pool.ParallelFor(100, 1, workers + 1, [&](std::size_t first, std::size_t last) {
+            for(auto i = first; i < last; ++i)
+                sum += i;
+        });
+    });
+
+    EXPECT_EQ(sum, workers * 2 * 4950);
+}
+
+TEST(CPU_ThreadPool_NONE, PropagatesExceptions)
+{
+    miopen::ThreadPool pool{workers};
+
+    EXPECT_THROW(pool.ParallelFor(1000,
+                                  1,
+                                  workers + 1,
+                                  [&](std::size_t first, std::size_t) {
+                                      if(first % 100 == 10)
+                                          throw std::runtime_error("failure");
+                                  }),
+                 std::runtime_error);
+
+    // The pool is still usable afterwards
+    std::atomic<int> after{0};
+    pool.ParallelFor(100, 1, workers + 1, [&](std::size_t, std::size_t) { ++after; });
+    EXPECT_EQ(after, 100);
+}
+
+TEST(CPU_ThreadPool_NONE, NoWorkers)
+{
+    miopen::ThreadPool pool{0};
+    std::size_t calls = 0;
+
+    pool.ParallelFor(100, 1, 8, [&](std::size_t first, std::size_t last) {
+        EXPECT_EQ(first, 0);
+        EXPECT_EQ(last, 100);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+
+    bool ran = false;
+    pool.Submit([&]() { ran = true; }).get();
+    EXPECT_TRUE(ran);
+}
+
+TEST(CPU_ThreadPool_NONE, SubmitReturnsExceptions)
+{
+    miopen::ThreadPool pool{workers};
+    std::atomic<bool> ran{false};
+
+    auto failed = pool.Submit([]() { throw std::runtime_error("task"); });
+    auto done   = pool.Submit([&]() { ran = true; });
+
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    done.get();
+    EXPECT_TRUE(ran);
+}
+
+TEST(CPU_ThreadPool_NONE, ParForDropIn)
+{
+    std::vector<std::atomic<int>> hits(1000);
+
+    miopen::par_for(hits.size(), [&](std::size_t i) { ++hits[i]; });
+    miopen::par_for(hits.size(), miopen::max_threads{3}, [&](std::size_t i) { ++hits[i]; });
+    miopen::par_for_strided(
+        hits.size(), miopen::max_threads{3}, [&](std::size_t i) { ++hits[i]; });
+
+    for(const auto& hit : hits)
+        ASSERT_EQ(hit, 3);
+
+    EXPECT_THROW(miopen::par_for(hits.size(),
+                                 miopen::max_threads{3},
+                                 [&](std::size_t i) {
+                                     if(i == 500)
+                                         throw std::runtime_error("par_for");
+                                 }),
+                 std::runtime_error);
+}
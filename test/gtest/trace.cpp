@@ -0,0 +1,106 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/trace.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+nlohmann::json ExportEvents()
+{
+    std::ostringstream ss;
+    miopen::trace::Export(ss);
+    return nlohmann::json::parse(ss.str()).at("traceEvents");
+}
+
+/// Restores the tracing state of the process, which may be set through the environment.
+struct TraceState
+{
+    bool was_enabled = miopen::trace::IsEnabled();
+
+    TraceState() { miopen::trace::Clear(); }
+    ~TraceState()
+    {
+        miopen::trace::SetEnabled(was_enabled);
+        miopen::trace::Clear();
+    }
+};
+
+} // namespace
+
+TEST(CPU_Trace_NONE, DisabledProbesRecordNothing)
+{
+    const auto state = TraceState{};
+    miopen::trace::SetEnabled(false);
+
+    {
+        MIOPEN_TRACE_SCOPE("test", "Disabled");
+    }
+
+    EXPECT_TRUE(ExportEvents().empty());
+}
+
+TEST(CPU_Trace_NONE, ExportsCompleteEvents)
+{
+    const auto state = TraceState{};
+    miopen::trace::SetEnabled(true);
+
+    {
+        MIOPEN_TRACE_SCOPE("test", "Outer");
+        MIOPEN_TRACE_SCOPE("test", "Inner", std::string(100, 'x'));
+    }
+    std::thread{[]() { MIOPEN_TRACE_SCOPE("test", "Worker"); }}.join();
+
+    const auto events = ExportEvents();
+    ASSERT_EQ(events.size(), 3);
+
+    // Scopes are recorded when they end, so the inner one comes first.
+    EXPECT_EQ(events[0].at("name"), "Inner");
+    EXPECT_EQ(events[0].at("args").at("detail").get<std::string>().size(), 63);
+    EXPECT_EQ(events[1].at("name"), "Outer");
+    EXPECT_EQ(events[1].count("args"), 0);
+    EXPECT_EQ(events[2].at("name"), "Worker");
+
+    for(const auto& event : events)
+    {
+        EXPECT_EQ(event.at("cat"), "test");
+        EXPECT_EQ(event.at("ph"), "X");
+        EXPECT_GE(event.at("dur").get<double>(), 0.);
+    }
+
+    EXPECT_LE(events[1].at("ts").get<double>(), events[0].at("ts").get<double>());
+    EXPECT_EQ(events[0].at("tid"), events[1].at("tid"));
+    EXPECT_NE(events[0].at("tid"), events[2].at("tid"));
+
+    miopen::trace::Clear();
+    EXPECT_TRUE(ExportEvents().empty());
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/tuning_queue.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using miopen::conv::TuningQueue;
+
+miopen::conv::ProblemDescription MakeProblem(std::size_t n)
+{
+    const auto conv = miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}, {0, 0}};
+
+    return {miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{n, 16, 28, 28}},
+            miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{32, 16, 3, 3}},
+            miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{n, 32, 28, 28}},
+            conv,
+            miopen::conv::Direction::Forward};
+}
+
+std::size_t Pending(const miopen::fs::path& file)
+{
+    return TuningQueue{file, nullptr, std::chrono::milliseconds{0}, false}.Size();
+}
+
+/// Stands in for exhaustive Find: "measures" a time per problem and publishes it to a map in
+/// place of the find-db.
+struct FakeTimingBackend
+{
+    std::mutex mutex;
+    std::map<std::size_t, float> db;
+
+    TuningQueue::Tuner Tuner()
+    {
+        return [this](const miopen::Problem& problem) {
+            const auto n    = problem.AsConvolution().GetBatchSize();
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            db[n]           = 0.01f * static_cast<float>(n);
+        };
+    }
+};
+
+} // namespace
+
+TEST(CPU_TuningQueue_NONE, PersistsAndDrains)
+{
+    const auto tmp  = miopen::TmpDir{"tuning_queue"};
+    const auto file = tmp / "queue.txt";
+    auto backend    = FakeTimingBackend{};
+
+    {
+        auto queue = TuningQueue{file, backend.Tuner(), std::chrono::milliseconds{0}, false};
+        queue.Enqueue(MakeProblem(16));
+        queue.Enqueue(MakeProblem(32));
+        queue.Enqueue(MakeProblem(16));
+        EXPECT_EQ(queue.Size(), 2);
+    }
+
+    EXPECT_TRUE(backend.db.empty());
+    EXPECT_EQ(TuningQueue::Drain(file, backend.Tuner()), 2);
+    EXPECT_EQ(backend.db, (std::map<std::size_t, float>{{16, 0.16f}, {32, 0.32f}}));
+    EXPECT_EQ(Pending(file), 0);
+}
+
+TEST(CPU_TuningQueue_NONE, WorkerTunesQueuedProblems)
+{
+    const auto tmp  = miopen::TmpDir{"tuning_queue"};
+    const auto file = tmp / "queue.txt";
+    auto backend    = FakeTimingBackend{};
+
+    {
+        auto queue = TuningQueue{file, backend.Tuner(), std::chrono::milliseconds{0}, false};
+        queue.Enqueue(MakeProblem(8));
+    }
+
+    auto queue = TuningQueue{file, backend.Tuner(), std::chrono::milliseconds{0}, true};
+    queue.Enqueue(MakeProblem(64));
+    queue.Wait();
+
+    const auto lock = std::lock_guard<std::mutex>{backend.mutex};
+    EXPECT_EQ(backend.db.size(), 2);
+    EXPECT_EQ(backend.db.count(8), 1);
+    EXPECT_EQ(backend.db.count(64), 1);
+    EXPECT_EQ(queue.Size(), 0);
+}
+
+TEST(CPU_TuningQueue_NONE, FailedProblemsAreDropped)
+{
+    const auto tmp  = miopen::TmpDir{"tuning_queue"};
+    const auto file = tmp / "queue.txt";
+    const auto fail = [](const miopen::Problem&) { throw std::runtime_error{"no device"}; };
+
+    {
+        auto queue = TuningQueue{file, fail, std::chrono::milliseconds{0}, false};
+        queue.Enqueue(MakeProblem(16));
+    }
+
+    EXPECT_EQ(TuningQueue::Drain(file, fail), 0);
+    EXPECT_EQ(Pending(file), 0);
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/execution_context.hpp>
+#include <miopen/generic_search.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_space_index.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+struct TuningSpaceProblem
+{
+    int a_max;
+    int b_max;
+};
+
+// Two parameters; a point is valid when a * b is a multiple of 3. The spare set only
+// contains the single point (1, 1), which is never valid in the main set.
+struct TuningSpaceConfig
+{
+    int a      = 0;
+    int b      = 0;
+    bool spare = false;
+
+    TuningSpaceConfig() = default;
+    TuningSpaceConfig(bool spare_) : a(spare_ ? 1 : 0), b(spare_ ? 1 : 0), spare(spare_) {}
+
+    bool SetNextValue(const TuningSpaceProblem& problem)
+    {
+        if(spare)
+            return false;
+        if(++b <= problem.b_max)
+            return true;
+        b = 0;
+        if(++a <= problem.a_max)
+            return true;
+        a = 0;
+        return false;
+    }
+
+    bool IsValid(const miopen::ExecutionContext&, const TuningSpaceProblem&) const
+    {
+        if(spare)
+            return true;
+        return a * b != 0 && (a * b) % 3 == 0;
+    }
+
+    void Serialize(std::ostream& stream) const { stream << a << ',' << b; }
+
+    bool operator==(const TuningSpaceConfig& other) const
+    {
+        return a == other.a && b == other.b && spare == other.spare;
+    }
+};
+
+std::vector<TuningSpaceConfig> WalkAll(const TuningSpaceProblem& problem, bool spare)
+{
+    const auto ctx = miopen::ExecutionContext{};
+    const auto all = miopen::solver::ComputedContainer<TuningSpaceConfig,
+                                                       miopen::ExecutionContext,
+                                                       TuningSpaceProblem>{ctx, problem, spare};
+    return {all.begin(), all.end()};
+}
+
+} // namespace
+
+TEST(CPU_TuningSpaceIndex_NONE, MatchesComputedContainer)
+{
+    const auto ctx     = miopen::ExecutionContext{};
+    const auto problem = TuningSpaceProblem{99, 99};
+
+    for(const auto concurrent : {false, true})
+    {
+        const auto mask = miopen::solver::ComputeTuningSpaceMask<TuningSpaceConfig>(
+            ctx, problem, false, concurrent);
+
+        EXPECT_EQ(mask.size, 100 * 100);
+        EXPECT_FALSE(mask.spare);
+
+        const auto configs =
+            miopen::solver::GetTuningSpaceConfigs<TuningSpaceConfig>(mask, problem);
+        ASSERT_TRUE(configs);
+        EXPECT_EQ(*configs, WalkAll(problem, false));
+        EXPECT_EQ(configs->size(), mask.Count());
+    }
+}
+
+TEST(CPU_TuningSpaceIndex_NONE, RejectsMismatchedSpace)
+{
+    const auto ctx  = miopen::ExecutionContext{};
+    const auto mask = miopen::solver::ComputeTuningSpaceMask<TuningSpaceConfig>(
+        ctx, TuningSpaceProblem{9, 9}, false, false);
+
+    EXPECT_TRUE(miopen::solver::GetTuningSpaceConfigs<TuningSpaceConfig>(
+        mask, TuningSpaceProblem{9, 9}));
+    EXPECT_FALSE(miopen::solver::GetTuningSpaceConfigs<TuningSpaceConfig>(
+        mask, TuningSpaceProblem{9, 10}));
+    EXPECT_FALSE(miopen::solver::GetTuningSpaceConfigs<TuningSpaceConfig>(
+        mask, TuningSpaceProblem{9, 8}));
+}
+
+TEST(CPU_TuningSpaceIndex_NONE, HashesConfigs)
+{
+    const auto hash = [](const TuningSpaceProblem& problem) {
+        return miopen::solver::HashTuningSpace<TuningSpaceConfig>(problem);
+    };
+
+    EXPECT_EQ(hash({9, 19}), hash({9, 19}));
+    EXPECT_NE(hash({9, 19}), hash({9, 18}));
+    // Same number of points, which a mask alone does not tell apart.
+    EXPECT_NE(hash({9, 19}), hash({19, 9}));
+
+    auto a = miopen::solver::TuningSpaceHash{};
+    auto b = miopen::solver::TuningSpaceHash{};
+    a.Add("1,2");
+    a.Add("3");
+    b.Add("1");
+    b.Add("2,3");
+    EXPECT_NE(a.ToString(), b.ToString());
+}
+
+TEST(CPU_TuningSpaceIndex_NONE, Spare)
+{
+    const auto ctx     = miopen::ExecutionContext{};
+    const auto problem = TuningSpaceProblem{0, 0};
+    const auto mask =
+        miopen::solver::ComputeTuningSpaceMask<TuningSpaceConfig>(ctx, problem, true, false);
+
+    const auto configs = miopen::solver::GetTuningSpaceConfigs<TuningSpaceConfig>(mask, problem);
+    ASSERT_TRUE(configs);
+    EXPECT_EQ(*configs, WalkAll(problem, true));
+    EXPECT_EQ(configs->size(), 1);
+}
+
+TEST(CPU_TuningSpaceIndex_NONE, Persistence)
+{
+    const auto ctx     = miopen::ExecutionContext{};
+    const auto problem = TuningSpaceProblem{40, 40};
+    const auto dir     = miopen::TmpDir{"tuning_space"};
+    const auto key     = std::string{"solver:gfx942_304:1x2x3"};
+
+    auto mask =
+        miopen::solver::ComputeTuningSpaceMask<TuningSpaceConfig>(ctx, problem, false, false);
+    {
+        auto index = miopen::solver::TuningSpaceIndex{dir};
+        EXPECT_EQ(index.Find(key), nullptr);
+        index.Store(key, mask);
+        EXPECT_TRUE(miopen::fs::exists(index.GetPath(key)));
+    }
+
+    auto index        = miopen::solver::TuningSpaceIndex{dir};
+    const auto loaded = index.Find(key);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->size, mask.size);
+    EXPECT_EQ(loaded->spare, mask.spare);
+    EXPECT_EQ(loaded->bits, mask.bits);
+    EXPECT_EQ(index.Find("solver:gfx942_304:1x2x4"), nullptr);
+
+    // A truncated file is ignored.
+    index.Clear();
+    miopen::fs::resize_file(index.GetPath(key), 20);
+    EXPECT_EQ(index.Find(key), nullptr);
+}
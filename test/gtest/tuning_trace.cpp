@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_trace.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using miopen::TuningSampleKey;
+using miopen::TuningTrace;
+
+TEST(CPU_TuningTrace_NONE, ReplaysInRecordedOrder)
+{
+    const auto key   = TuningSampleKey{"search", "1-16-16-3x3", "ConvAsm1x1U", "1,2,3"};
+    const auto other = TuningSampleKey{"find", "1-16-16-3x3", "ConvAsm1x1U", ""};
+
+    auto recorded = TuningTrace{};
+    recorded.Record(key, 1.25f);
+    recorded.Record(key, 0.1f);
+    recorded.Record(other, 3.0f);
+
+    auto text = std::stringstream{};
+    recorded.Write(text);
+
+    auto trace = TuningTrace{};
+    trace.Read(text);
+    EXPECT_EQ(trace.Size(), 3);
+    EXPECT_EQ(trace.Next(key), 1.25f);
+    EXPECT_EQ(trace.Next(key), 0.1f);
+    EXPECT_EQ(trace.Next(key), 1.25f);
+    EXPECT_EQ(trace.Next(other), 3.0f);
+    EXPECT_FALSE(trace.Next({"search", "1-16-16-3x3", "ConvAsm1x1U", "4,5,6"}));
+}
+
+TEST(CPU_TuningTrace_NONE, ReadsFiles)
+{
+    const auto tmp  = miopen::TmpDir{"tuning_trace"};
+    const auto file = tmp / "trace.tsv";
+
+    auto recorded = TuningTrace{};
+    recorded.Record({"search", "problem", "solver", "cfg"}, 2.0f);
+    recorded.Save(file);
+
+    auto trace = TuningTrace{};
+    trace.Load(file);
+    EXPECT_EQ(trace.Next({"search", "problem", "solver", "cfg"}), 2.0f);
+
+    auto comments = std::stringstream{"# device gfx90a\n\nfind\tproblem\tsolver\t\t0.5\n"};
+    trace.Read(comments);
+    EXPECT_EQ(trace.Next({"find", "problem", "solver", ""}), 0.5f);
+
+    auto malformed = std::stringstream{"find\tproblem\tsolver\tfast\n"};
+    EXPECT_THROW(trace.Read(malformed), miopen::Exception);
+}
+
+TEST(GPU_TuningReplayHandle_NONE, ServesRecordedTimes)
+{
+    const auto tmp  = miopen::TmpDir{"tuning_trace"};
+    const auto file = tmp / "trace.tsv";
+
+    auto recorded = TuningTrace{};
+    recorded.Record({"search", "problem", "solver", "cfg"}, 0.75f);
+    recorded.Save(file);
+
+    const auto handle = miopen::TuningReplayHandle{file};
+    auto measurement  = miopen::TuningMeasurement{handle, "search", "problem"};
+    ASSERT_TRUE(measurement.IsReplay());
+
+    // Replaying neither builds nor runs anything.
+    auto built         = false;
+    const auto factory = miopen::InvokerFactory{[&](const std::vector<miopen::Kernel>&) {
+        built = true;
+        return miopen::Invoker{};
+    }};
+
+    measurement.Select("solver", "cfg");
+    const auto invoker = measurement.Prepare(factory, {});
+    EXPECT_FALSE(built);
+    EXPECT_EQ(measurement.Run(invoker, {}), 0.75f);
+
+    measurement.Select("solver", "other");
+    EXPECT_THROW(measurement.Run(invoker, {}), miopen::Exception);
+}
+
+TEST(GPU_TuningMeasurement_NONE, UsesGivenTimeSource)
+{
+    const auto handle = miopen::Handle{};
+    auto asked        = TuningSampleKey{};
+    auto measurement  = miopen::TuningMeasurement{
+        handle, "find", "problem", [&](const TuningSampleKey& key) {
+            asked = key;
+            return 1.5f;
+        }};
+    ASSERT_TRUE(measurement.IsReplay());
+
+    measurement.Select("solver", "");
+    EXPECT_EQ(measurement.Run(measurement.Prepare({}, {}), {}), 1.5f);
+    EXPECT_EQ(asked.kind, "find");
+    EXPECT_EQ(asked.solver, "solver");
+}
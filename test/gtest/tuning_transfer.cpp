@@ -0,0 +1,141 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/generic_search.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_transfer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using miopen::conv::Direction;
+using miopen::conv::ProblemDescription;
+
+ProblemDescription MakeProblem(std::size_t n,
+                               std::size_t hw,
+                               std::size_t c               = 16,
+                               std::size_t filter          = 3,
+                               miopenTensorLayout_t layout = miopenTensorNCHW)
+{
+    const auto pads = std::vector<int>(2, static_cast<int>(filter / 2));
+    const auto ones = std::vector<int>(2, 1);
+    const auto conv = miopen::ConvolutionDescriptor{pads, ones, ones, std::vector<int>(2, 0)};
+
+    return {miopen::TensorDescriptor{miopenFloat, layout, std::vector<std::size_t>{n, c, hw, hw}},
+            miopen::TensorDescriptor{
+                miopenFloat, layout, std::vector<std::size_t>{32, c, filter, filter}},
+            miopen::TensorDescriptor{miopenFloat, layout, std::vector<std::size_t>{n, 32, hw, hw}},
+            conv,
+            Direction::Forward};
+}
+
+/// The key the problem is stored under in the PerfDb.
+std::string Key(const ProblemDescription& problem)
+{
+    return miopen::DbRecord{miopen::DbKinds::PerfDb, problem}.GetKey();
+}
+
+/// The key the problem is stored under in the Find-DB.
+std::string FindDbKey(const ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+} // namespace
+
+TEST(CPU_TuningTransfer_NONE, PerfDbKeyDistance)
+{
+    static_assert(miopen::solver::HasPerfDbKeyDistance<ProblemDescription>{});
+
+    const auto distance = [](const ProblemDescription& a, const ProblemDescription& b) {
+        return ProblemDescription::PerfDbKeyDistance(Key(a), Key(b));
+    };
+
+    const auto problem = MakeProblem(16, 56);
+    EXPECT_DOUBLE_EQ(distance(problem, problem), 0.0);
+    EXPECT_DOUBLE_EQ(distance(problem, MakeProblem(32, 56)), 1.0);
+    EXPECT_DOUBLE_EQ(distance(problem, MakeProblem(4, 112)), 4.0);
+
+    // The channels, the filter and the layout have to match.
+    EXPECT_LT(distance(problem, MakeProblem(16, 56, 32)), 0.0);
+    EXPECT_LT(distance(problem, MakeProblem(16, 56, 16, 1)), 0.0);
+    EXPECT_LT(distance(problem, MakeProblem(16, 56, 16, 3, miopenTensorNHWC)), 0.0);
+    EXPECT_LT(ProblemDescription::PerfDbKeyDistance(Key(problem), "16x56x3"), 0.0);
+
+    // The PerfDb keys have no output sizes, so a different image size counts once.
+    EXPECT_DOUBLE_EQ(ProblemDescription::FindDbKeyDistance(FindDbKey(problem),
+                                                           FindDbKey(MakeProblem(32, 112))),
+                     5.0);
+    EXPECT_DOUBLE_EQ(distance(problem, MakeProblem(32, 112)), 3.0);
+}
+
+TEST(CPU_TuningTransfer_NONE, VisitUserPerfDb)
+{
+    const auto dir  = miopen::TmpDir{"tuning_transfer"};
+    const auto path = dir / "user.db.txt";
+    const auto near = Key(MakeProblem(32, 56));
+    const auto far  = Key(MakeProblem(16, 56, 16, 1));
+    {
+        std::ofstream file(path);
+        file << near << "=Solver:1,2,3;Other:4" << std::endl;
+        file << far << "=Solver:5,6,7" << std::endl;
+    }
+
+    auto records = std::map<std::string, std::string>{};
+    miopen::RamDb::GetCached(miopen::DbKinds::PerfDb, path, false)
+        .VisitRecords([&](const std::string& key, const std::string& contents) {
+            records[key] = contents;
+        });
+
+    const auto expected =
+        std::map<std::string, std::string>{{near, "Solver:1,2,3;Other:4"}, {far, "Solver:5,6,7"}};
+    EXPECT_EQ(records, expected);
+}
+
+TEST(CPU_TuningTransfer_NONE, SeedOrder)
+{
+    const auto configs = std::vector<std::string>{
+        "1,1,1", "2,2,2", "4,4,4", "1,1,2", "4,4,2", "2,2,3", "4,2,1", "2,2"};
+    const auto seeds = std::vector<std::string>{"4,4,4", "2,2,2", "8,8,8"};
+
+    // Seeds in their order, then configs one field away from a seed, then the rest.
+    const auto expected = std::vector<std::size_t>{2, 1, 4, 5, 0, 3, 6, 7};
+    EXPECT_EQ(miopen::solver::SeedOrder(configs, seeds), expected);
+
+    const auto unseeded = std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(miopen::solver::SeedOrder(configs, {}), unseeded);
+}
@@ -0,0 +1,212 @@
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+// Ranks kernels by the cumulative compile time recorded in the compile_stats table of one or
+// more user caches, e.g. collected from all machines of a fleet.
+
+std::unique_ptr<sqlite3, int (*)(sqlite3*)> OpenDb(const char* filename, int flags)
+{
+    sqlite3* db = nullptr;
+    if(sqlite3_open_v2(filename, &db, flags, nullptr) != SQLITE_OK)
+    {
+        std::cerr << "Unable to open " << filename << ": " << sqlite3_errmsg(db) << std::endl;
+        sqlite3_close_v2(db);
+        return {nullptr, &sqlite3_close_v2};
+    }
+    return {db, &sqlite3_close_v2};
+}
+
+std::unique_ptr<sqlite3_stmt, int (*)(sqlite3_stmt*)> PrepareStatement(sqlite3* db,
+                                                                       const std::string& sql)
+{
+    sqlite3_stmt* stmt = nullptr;
+    if(sqlite3_prepare_v2(db, sql.c_str(), sql.length(), &stmt, nullptr) != SQLITE_OK ||
+       stmt == nullptr)
+    {
+        std::cerr << "Error while preparing SQL statement: " << sqlite3_errmsg(db) << std::endl;
+        std::cerr << "Statement: {" << sql << "}" << std::endl;
+        return {nullptr, &sqlite3_finalize};
+    }
+    return {stmt, &sqlite3_finalize};
+}
+
+struct Totals
+{
+    int64_t builds      = 0;
+    int64_t total_us    = 0;
+    int64_t max_us      = 0;
+    int64_t source_size = 0;
+    std::set<std::string> options;
+    std::set<std::string> backends;
+    std::set<std::string> archs;
+};
+
+static std::string Text(sqlite3_stmt* stmt, int col)
+{
+    const auto text = sqlite3_column_text(stmt, col);
+    return text == nullptr ? std::string{} : reinterpret_cast<const char*>(text);
+}
+
+static std::string Join(const std::set<std::string>& values)
+{
+    std::string out;
+    for(const auto& value : values)
+        out.append(out.empty() ? "" : ",").append(value);
+    return out;
+}
+
+static bool Collect(const std::string& filename,
+                    const std::string& group_by,
+                    const std::string& arch,
+                    std::map<std::string, Totals>& totals)
+{
+    const auto db = OpenDb(filename.c_str(), SQLITE_OPEN_READONLY);
+    if(db == nullptr)
+        return false;
+
+    const auto stmt = PrepareStatement(db.get(),
+                                       "SELECT kernel_name, kernel_args, backend, arch, "
+                                       "source_size, duration_us FROM compile_stats");
+    if(stmt == nullptr)
+        return false;
+
+    for(int step_result = sqlite3_step(stmt.get()); step_result != SQLITE_DONE;
+        step_result     = sqlite3_step(stmt.get()))
+    {
+        if(step_result == SQLITE_BUSY)
+        {
+            sqlite3_sleep(10);
+            continue;
+        }
+
+        if(step_result != SQLITE_ROW)
+        {
+            std::cerr << filename << ": " << sqlite3_errmsg(db.get()) << std::endl;
+            return false;
+        }
+
+        const auto kernel_name    = Text(stmt.get(), 0);
+        const auto kernel_args    = Text(stmt.get(), 1);
+        const auto backend        = Text(stmt.get(), 2);
+        const auto build_arch     = Text(stmt.get(), 3);
+        const int64_t duration_us = sqlite3_column_int64(stmt.get(), 5);
+
+        if(!arch.empty() && build_arch.rfind(arch, 0) != 0)
+            continue;
+
+        const auto key = group_by == "options" ? kernel_name + " " + kernel_args
+                         : group_by == "backend" ? backend
+                         : group_by == "arch"    ? build_arch
+                                                 : kernel_name;
+
+        auto& total = totals[key];
+        total.builds += 1;
+        total.total_us += duration_us;
+        total.max_us = std::max(total.max_us, duration_us);
+        total.source_size += sqlite3_column_int64(stmt.get(), 4);
+        total.options.insert(kernel_args);
+        total.backends.insert(backend);
+        total.archs.insert(build_arch);
+    }
+
+    return true;
+}
+
+static void Usage(const char* name)
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << name
+              << " [--top N] [--by kernel|options|backend|arch] [--arch ARCH] db_path..."
+              << std::endl;
+    std::cerr << "db_path - compile_stats.db files from the MIOpen user caches. The builds of all "
+                 "of them are summed up."
+              << std::endl;
+    std::cerr << "--top - number of entries to print, 20 by default, 0 prints all of them."
+              << std::endl;
+    std::cerr << "--by - what to rank: kernels (the default), kernels with their compile "
+                 "options, compiler backends or architectures."
+              << std::endl;
+    std::cerr << "--arch - only count the builds for architectures starting with ARCH."
+              << std::endl;
+}
+
+int main(int argn, char** args)
+{
+    std::size_t top = 20;
+    std::string group_by{"kernel"};
+    std::string arch;
+    std::vector<std::string> files;
+
+    for(int i = 1; i < argn; ++i)
+    {
+        const std::string arg = args[i];
+        if((arg == "--top" || arg == "--by" || arg == "--arch") && i + 1 < argn)
+        {
+            const std::string value = args[++i];
+            if(arg == "--top")
+                top = std::stoul(value);
+            else if(arg == "--by")
+                group_by = value;
+            else
+                arch = value;
+        }
+        else if(arg.rfind("--", 0) == 0)
+        {
+            Usage(args[0]);
+            return 1;
+        }
+        else
+        {
+            files.push_back(arg);
+        }
+    }
+
+    if(files.empty() || (group_by != "kernel" && group_by != "options" &&
+                         group_by != "backend" && group_by != "arch"))
+    {
+        Usage(args[0]);
+        return 1;
+    }
+
+    auto totals = std::map<std::string, Totals>{};
+    for(const auto& file : files)
+    {
+        if(!Collect(file, group_by, arch, totals))
+            return 1;
+    }
+
+    auto ranking = std::vector<std::pair<std::string, Totals>>{totals.begin(), totals.end()};
+    std::sort(ranking.begin(), ranking.end(), [](const auto& l, const auto& r) {
+        return l.second.total_us > r.second.total_us;
+    });
+    if(top != 0 && ranking.size() > top)
+        ranking.resize(top);
+
+    int64_t all_us = 0;
+    for(const auto& entry : totals)
+        all_us += entry.second.total_us;
+
+    std::cout << "total_s\tshare\tbuilds\tavg_ms\tmax_ms\tsource_kb\toptions\tbackends\tarchs\t"
+              << group_by << std::endl;
+    std::cout << std::fixed;
+    for(const auto& [name, total] : ranking)
+    {
+        std::cout << std::setprecision(2) << total.total_us / 1e6 << '\t'
+                  << std::setprecision(1) << (all_us == 0 ? 0.0 : 100.0 * total.total_us / all_us)
+                  << "%\t" << total.builds << '\t' << total.total_us / 1e3 / total.builds << '\t'
+                  << total.max_us / 1e3 << '\t' << total.source_size / 1024.0 / total.builds
+                  << '\t' << total.options.size() << '\t' << Join(total.backends) << '\t'
+                  << Join(total.archs) << '\t' << name << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,401 @@
+#include "db_index.hpp"
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+namespace {
+
+std::vector<std::string_view> Split(std::string_view s, char sep)
+{
+    auto tokens = std::vector<std::string_view>{};
+    for(auto pos = s.find(sep); pos != std::string_view::npos; pos = s.find(sep))
+    {
+        tokens.push_back(s.substr(0, pos));
+        s.remove_prefix(pos + 1);
+    }
+    tokens.push_back(s);
+    return tokens;
+}
+
+bool ToInt(std::string_view s, int64_t& value)
+{
+    const auto res = std::from_chars(s.data(), s.data() + s.size(), value);
+    return res.ec == std::errc{} && res.ptr == s.data() + s.size();
+}
+
+bool ToFloat(std::string_view s, float& value)
+{
+    const auto str = std::string{s};
+    char* end      = nullptr;
+    value          = std::strtof(str.c_str(), &end);
+    return !str.empty() && end == str.c_str() + str.size();
+}
+
+// "HxW" or "DxHxW"
+bool ToDims(std::string_view s, int spatial_dims, int64_t& d, int64_t& h, int64_t& w)
+{
+    const auto dims = Split(s, 'x');
+    if(dims.size() != static_cast<std::size_t>(spatial_dims))
+        return false;
+    if(spatial_dims == 3 && !ToInt(dims[0], d))
+        return false;
+    return ToInt(dims[dims.size() - 2], h) && ToInt(dims.back(), w);
+}
+
+struct Dims
+{
+    int spatial_dims;
+    int64_t d, h, w;
+
+    friend std::ostream& operator<<(std::ostream& stream, const Dims& dims)
+    {
+        if(dims.spatial_dims == 3)
+            stream << dims.d << 'x';
+        return stream << dims.h << 'x' << dims.w;
+    }
+};
+
+// The input of backward problems is dy, so their output is computed as by a transposed
+// convolution. The result is ambiguous for strides > 1, the common case is assumed.
+int64_t OutSize(const std::string& direction,
+                int64_t in,
+                int64_t fil,
+                int64_t pad,
+                int64_t stride,
+                int64_t dil)
+{
+    if(direction == "F")
+        return (in + 2 * pad - dil * (fil - 1) - 1) / stride + 1;
+    return (in - 1) * stride - 2 * pad + dil * (fil - 1) + 1;
+}
+
+} // namespace
+
+std::optional<Problem> Problem::Parse(std::string_view key)
+{
+    const auto tokens = Split(key, '-');
+    if(tokens.size() < 15)
+        return std::nullopt;
+
+    auto p           = Problem{};
+    p.spatial_dims   = tokens[3].find('x') != std::string_view::npos ? 2 : 3;
+    const auto is_3d = p.spatial_dims == 3;
+    auto i           = std::size_t{0};
+    auto ok          = ToInt(tokens[i++], p.in_c);
+    if(is_3d)
+        ok = ok && ToInt(tokens[i++], p.in_d);
+    ok = ok && ToInt(tokens[i++], p.in_h) && ToInt(tokens[i++], p.in_w);
+    ok = ok && ToDims(tokens[i++], p.spatial_dims, p.fil_d, p.fil_h, p.fil_w);
+    ok = ok && ToInt(tokens[i++], p.out_c);
+    if(is_3d)
+        ok = ok && ToInt(tokens[i++], p.out_d);
+    ok = ok && ToInt(tokens[i++], p.out_h) && ToInt(tokens[i++], p.out_w);
+    ok = ok && ToInt(tokens[i++], p.batch);
+    ok = ok && ToDims(tokens[i++], p.spatial_dims, p.pad_d, p.pad_h, p.pad_w);
+    ok = ok && ToDims(tokens[i++], p.spatial_dims, p.stride_d, p.stride_h, p.stride_w);
+    ok = ok && ToDims(tokens[i++], p.spatial_dims, p.dil_d, p.dil_h, p.dil_w);
+    ok = ok && i < tokens.size() && ToInt(tokens[i++], p.bias);
+    if(!ok)
+        return std::nullopt;
+
+    // Layout(s), data type and direction with the optional part
+    const auto rest = tokens.size() - i;
+    if(rest != 3 && rest != 5)
+        return std::nullopt;
+    p.layout = std::string{tokens[i++]};
+    if(rest == 5)
+    {
+        p.layout.append("-").append(tokens[i]).append("-").append(tokens[i + 1]);
+        i += 2;
+    }
+    p.data_type = std::string{tokens[i++]};
+
+    auto last = tokens[i];
+    if(last.empty() || (last[0] != 'F' && last[0] != 'B' && last[0] != 'W'))
+        return std::nullopt;
+    p.direction = std::string{last.substr(0, 1)};
+    last.remove_prefix(1);
+    if(last.substr(0, 2) == "_g")
+    {
+        last.remove_prefix(2);
+        const auto end = std::min(last.find('_'), last.size());
+        if(!ToInt(last.substr(0, end), p.group_count))
+            return std::nullopt;
+        last.remove_prefix(end);
+    }
+    p.suffix = std::string{last};
+    return p;
+}
+
+std::string Problem::Key() const
+{
+    const auto sep = '-';
+    std::ostringstream ss;
+    ss << in_c << sep;
+    if(spatial_dims == 3)
+        ss << in_d << sep;
+    ss << in_h << sep << in_w << sep << Dims{spatial_dims, fil_d, fil_h, fil_w} << sep << out_c
+       << sep;
+    if(spatial_dims == 3)
+        ss << out_d << sep;
+    ss << out_h << sep << out_w << sep << batch << sep << Dims{spatial_dims, pad_d, pad_h, pad_w}
+       << sep << Dims{spatial_dims, stride_d, stride_h, stride_w} << sep
+       << Dims{spatial_dims, dil_d, dil_h, dil_w} << sep << bias << sep << layout << sep
+       << data_type << sep << direction;
+    if(group_count != 1)
+        ss << "_g" << group_count;
+    ss << suffix;
+    return ss.str();
+}
+
+std::string Problem::MatchKey() const
+{
+    const auto sep = '-';
+    std::ostringstream ss;
+    ss << in_c << sep;
+    if(spatial_dims == 3)
+        ss << in_d << sep;
+    ss << in_h << sep << in_w << sep << Dims{spatial_dims, fil_d, fil_h, fil_w} << sep << out_c
+       << sep << batch << sep << Dims{spatial_dims, pad_d, pad_h, pad_w} << sep
+       << Dims{spatial_dims, stride_d, stride_h, stride_w} << sep
+       << Dims{spatial_dims, dil_d, dil_h, dil_w} << sep << bias << sep
+       << layout.substr(0, layout.find('-')) << sep << data_type << sep << direction;
+    if(group_count != 1)
+        ss << "_g" << group_count;
+    ss << suffix;
+    return ss.str();
+}
+
+std::string Problem::Family() const
+{
+    const auto sep = '-';
+    std::ostringstream ss;
+    ss << Dims{spatial_dims, fil_d, fil_h, fil_w} << sep << Dims{spatial_dims, pad_d, pad_h, pad_w}
+       << sep << Dims{spatial_dims, stride_d, stride_h, stride_w} << sep
+       << Dims{spatial_dims, dil_d, dil_h, dil_w} << sep << 'g' << group_count << sep << layout
+       << sep << data_type << sep << direction << suffix;
+    return ss.str();
+}
+
+std::optional<float> Entry::Time(const std::string& solver) const
+{
+    const auto it = times.find(solver);
+    if(it == times.end() || it->second.empty())
+        return std::nullopt;
+    auto values    = it->second;
+    const auto mid = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), mid, values.end());
+    return *mid;
+}
+
+std::optional<std::pair<std::string, float>> Entry::Best() const
+{
+    auto best = std::optional<std::pair<std::string, float>>{};
+    for(const auto& solver : times)
+    {
+        const auto time = Time(solver.first);
+        if(time && (!best || *time < best->second))
+            best = std::make_pair(solver.first, *time);
+    }
+    return best;
+}
+
+bool DbIndex::Load(const std::string& filename)
+{
+    auto header = std::string(16, '\0');
+    {
+        auto file = std::ifstream{filename, std::ios::binary};
+        if(!file)
+        {
+            std::cerr << "Unable to open " << filename << std::endl;
+            return false;
+        }
+        file.read(&header[0], header.size());
+    }
+
+    touched.clear();
+    const auto is_sqlite = std::memcmp(header.data(), "SQLite format 3", 16) == 0;
+    const auto ok        = is_sqlite ? LoadSQLite(filename) : LoadText(filename);
+    for(const auto& key : touched)
+        ++entries.at(key).files;
+    return ok;
+}
+
+const Entry* DbIndex::Find(const Problem& problem) const
+{
+    const auto it = entries.find(problem.MatchKey());
+    return it == entries.end() ? nullptr : &it->second;
+}
+
+std::map<std::string, std::vector<const Entry*>> DbIndex::Families() const
+{
+    auto families = std::map<std::string, std::vector<const Entry*>>{};
+    for(const auto& entry : entries)
+        families[entry.second.problem.Family()].push_back(&entry.second);
+    return families;
+}
+
+Entry& DbIndex::Get(const Problem& problem)
+{
+    const auto key = problem.MatchKey();
+    touched.insert(key);
+    auto& entry = entries[key];
+    if(entry.problem.layout.empty())
+        entry.problem = problem;
+    return entry;
+}
+
+// Record format: KEY=ID:VALUES;ID:VALUES
+//   Find-DB:     ID is the solver, VALUES are time,workspace,algorithm
+//   old Find-DB: ID is the algorithm, VALUES are solver,time,workspace,algorithm,kcache_key
+//   PerfDb:      ID is the solver, VALUES are the perf config
+bool DbIndex::LoadText(const std::string& filename)
+{
+    auto file = std::ifstream{filename};
+    auto line = std::string{};
+    while(std::getline(file, line))
+    {
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        const auto eq = line.find('=');
+        if(eq == std::string::npos)
+            continue;
+
+        const auto problem = Problem::Parse(std::string_view{line}.substr(0, eq));
+        if(!problem)
+        {
+            ++skipped;
+            continue;
+        }
+
+        auto& entry = Get(*problem);
+        // Text records hold the exact output sizes and layouts.
+        entry.problem = *problem;
+
+        for(const auto& pair : Split(std::string_view{line}.substr(eq + 1), ';'))
+        {
+            const auto colon = pair.find(':');
+            if(colon == std::string_view::npos)
+                continue;
+
+            const auto id     = std::string{pair.substr(0, colon)};
+            const auto values = Split(pair.substr(colon + 1), ',');
+            const auto is_algo = [&](std::size_t i) {
+                return values.size() > i && values[i].substr(0, 6) == "miopen";
+            };
+
+            auto time = 0.0f;
+            if(values.size() == 3 && is_algo(2) && ToFloat(values[0], time))
+                entry.times[id].push_back(time);
+            else if(values.size() >= 4 && is_algo(3) && ToFloat(values[1], time))
+                entry.times[std::string{values[0]}].push_back(time);
+            else
+                entry.tuned.insert(id);
+        }
+    }
+    return true;
+}
+
+bool DbIndex::LoadSQLite(const std::string& filename)
+{
+    sqlite3* db_ptr = nullptr;
+    const auto rc   = sqlite3_open_v2(filename.c_str(), &db_ptr, SQLITE_OPEN_READONLY, nullptr);
+    const auto db   = std::unique_ptr<sqlite3, int (*)(sqlite3*)>{db_ptr, &sqlite3_close_v2};
+    if(rc != SQLITE_OK)
+    {
+        std::cerr << "Unable to open " << filename << ": " << sqlite3_errmsg(db.get())
+                  << std::endl;
+        return false;
+    }
+
+    const auto query = std::string{
+        "SELECT solver, spatial_dim, in_channels, in_d, in_h, in_w, fil_d, fil_h, fil_w, "
+        "out_channels, batchsize, pad_d, pad_h, pad_w, conv_stride_d, conv_stride_h, "
+        "conv_stride_w, dilation_d, dilation_h, dilation_w, bias, group_count, layout, "
+        "data_type, direction FROM perf_db INNER JOIN config ON perf_db.config = config.id"};
+    sqlite3_stmt* stmt_ptr = nullptr;
+    if(sqlite3_prepare_v2(db.get(), query.c_str(), query.size(), &stmt_ptr, nullptr) !=
+       SQLITE_OK)
+    {
+        std::cerr << filename << " is not a PerfDb: " << sqlite3_errmsg(db.get()) << std::endl;
+        return false;
+    }
+    const auto stmt = std::unique_ptr<sqlite3_stmt, int (*)(sqlite3_stmt*)>{stmt_ptr,
+                                                                           &sqlite3_finalize};
+
+    for(int step_result = sqlite3_step(stmt.get()); step_result != SQLITE_DONE;
+        step_result     = sqlite3_step(stmt.get()))
+    {
+        if(step_result == SQLITE_BUSY)
+        {
+            sqlite3_sleep(10);
+            continue;
+        }
+
+        if(step_result != SQLITE_ROW)
+        {
+            std::cerr << filename << ": " << sqlite3_errmsg(db.get()) << std::endl;
+            return false;
+        }
+
+        auto col      = 0;
+        const auto i  = [&]() { return sqlite3_column_int64(stmt.get(), col++); };
+        const auto s  = [&]() {
+            const auto text = sqlite3_column_text(stmt.get(), col++);
+            return text == nullptr ? std::string{} : reinterpret_cast<const char*>(text);
+        };
+        const auto solver = s();
+
+        auto p         = Problem{};
+        p.spatial_dims = static_cast<int>(i());
+        p.in_c         = i();
+        p.in_d         = i();
+        p.in_h         = i();
+        p.in_w         = i();
+        p.fil_d        = i();
+        p.fil_h        = i();
+        p.fil_w        = i();
+        p.out_c        = i();
+        p.batch        = i();
+        p.pad_d        = i();
+        p.pad_h        = i();
+        p.pad_w        = i();
+        p.stride_d     = i();
+        p.stride_h     = i();
+        p.stride_w     = i();
+        p.dil_d        = i();
+        p.dil_h        = i();
+        p.dil_w        = i();
+        p.bias         = i();
+        p.group_count  = i();
+        p.layout       = s();
+        p.data_type    = s();
+        p.direction    = s();
+
+        if(p.spatial_dims != 3)
+        {
+            p.in_d = p.fil_d = p.stride_d = p.dil_d = 1;
+            p.pad_d                                 = 0;
+        }
+        if(p.stride_d <= 0 || p.stride_h <= 0 || p.stride_w <= 0)
+        {
+            ++skipped;
+            continue;
+        }
+        p.out_d = OutSize(p.direction, p.in_d, p.fil_d, p.pad_d, p.stride_d, p.dil_d);
+        p.out_h = OutSize(p.direction, p.in_h, p.fil_h, p.pad_h, p.stride_h, p.dil_h);
+        p.out_w = OutSize(p.direction, p.in_w, p.fil_w, p.pad_w, p.stride_w, p.dil_w);
+
+        Get(p).tuned.insert(solver);
+    }
+    return true;
+}
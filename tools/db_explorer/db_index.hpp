@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// Convolution problem as encoded in the Find-DB and PerfDb keys,
+/// see conv::ProblemDescription::Serialize():
+/// C-[D-]H-W-Filter-K-[oD-]oH-oW-N-Pad-Stride-Dilation-Bias-Layout(s)-Type-Direction[_gN...]
+struct Problem
+{
+    int spatial_dims = 2;
+    int64_t in_c = 0, in_d = 1, in_h = 0, in_w = 0;
+    int64_t fil_d = 1, fil_h = 0, fil_w = 0;
+    int64_t out_c = 0, out_d = 1, out_h = 0, out_w = 0;
+    int64_t batch = 0;
+    int64_t pad_d = 0, pad_h = 0, pad_w = 0;
+    int64_t stride_d = 1, stride_h = 1, stride_w = 1;
+    int64_t dil_d = 1, dil_h = 1, dil_w = 1;
+    int64_t bias        = 0;
+    int64_t group_count = 1;
+    std::string layout; // one layout, or in-weights-out layouts separated by '-'
+    std::string data_type;
+    std::string direction; // F, B or W
+    std::string suffix;    // optional key part other than the group count, e.g. "_ciFP8"
+
+    static std::optional<Problem> Parse(std::string_view key);
+
+    std::string Key() const;
+    /// Key() without the output spatial sizes, which the SQLite PerfDb does not store.
+    std::string MatchKey() const;
+    /// Everything but the tensor sizes: filter, pad, stride, dilation, group, layout, type and
+    /// direction.
+    std::string Family() const;
+};
+
+/// Everything the loaded databases hold for one problem.
+struct Entry
+{
+    Problem problem;
+    std::map<std::string, std::vector<float>> times; // Find-DB times by solver
+    std::set<std::string> tuned;                     // solvers having a PerfDb record
+    std::size_t files = 0;                           // number of files having a record
+
+    /// Median of the times recorded for the solver, if any.
+    std::optional<float> Time(const std::string& solver) const;
+    /// The fastest solver and its time, if any Find-DB record has been loaded.
+    std::optional<std::pair<std::string, float>> Best() const;
+};
+
+/// Find-DB and PerfDb records of any number of files, indexed by problem.
+class DbIndex
+{
+public:
+    /// Loads a text Find-DB or PerfDb, or a SQLite PerfDb. Returns false if the file cannot be
+    /// read, records of other primitives are skipped.
+    bool Load(const std::string& filename);
+
+    const std::map<std::string, Entry>& Entries() const { return entries; }
+    const Entry* Find(const Problem& problem) const;
+    /// Entries grouped by Problem::Family().
+    std::map<std::string, std::vector<const Entry*>> Families() const;
+
+    std::size_t Skipped() const { return skipped; }
+
+private:
+    bool LoadText(const std::string& filename);
+    bool LoadSQLite(const std::string& filename);
+    Entry& Get(const Problem& problem);
+
+    std::map<std::string, Entry> entries; // by Problem::MatchKey()
+    std::set<std::string> touched;        // entries having a record in the current file
+    std::size_t skipped = 0;
+};
@@ -0,0 +1,429 @@
+#include "db_index.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Answers questions about the solvers recorded in Find-DB and PerfDb files, e.g. collected from
+// all machines of a fleet, and exports them as training data for TunaNet.
+
+namespace {
+
+struct Options
+{
+    std::size_t top  = 20;
+    double threshold = 5.0;
+    std::vector<std::string> system;
+    std::string metadata;
+    std::string output;
+    std::vector<std::string> files;
+};
+
+void Usage(const char* name)
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << name << " best [--top N] db_path..." << std::endl;
+    std::cerr << "    The solver winning most problems of each shape family, i.e. of the problems "
+                 "differing only in tensor sizes, and its geometric mean slowdown against the "
+                 "best solver of each problem."
+              << std::endl;
+    std::cerr << name << " regress [--top N] [--threshold PERCENT] old_path new_path" << std::endl;
+    std::cerr << "    Problems whose best time got worse by more than PERCENT (5 by default) "
+                 "between two versions of a Find-DB."
+              << std::endl;
+    std::cerr << name << " coverage [--top N] --system system_path... db_path..." << std::endl;
+    std::cerr << "    Problems of the recorded databases which have no Find-DB record, and tuned "
+                 "solvers which have no PerfDb record, in the system databases."
+              << std::endl;
+    std::cerr << name << " export --metadata metadata.tn.model [--output path] db_path..."
+              << std::endl;
+    std::cerr << "    The best solver of each problem with its features in the order and "
+                 "encoding of the TunaNet model, as CSV."
+              << std::endl;
+    std::cerr << "db_path - text Find-DB or PerfDb, or SQLite PerfDb. Records of all of them are "
+                 "merged, the median of the times recorded for a solver is used."
+              << std::endl;
+    std::cerr << "--top - number of entries to print, 20 by default, 0 prints all of them."
+              << std::endl;
+}
+
+bool LoadAll(DbIndex& index, const std::vector<std::string>& files)
+{
+    for(const auto& file : files)
+    {
+        if(!index.Load(file))
+            return false;
+    }
+    if(index.Skipped() != 0)
+        std::cerr << index.Skipped() << " records of other primitives skipped" << std::endl;
+    return true;
+}
+
+template <class Row, class Less>
+void SortAndLimit(std::vector<Row>& rows, std::size_t top, Less less)
+{
+    std::sort(rows.begin(), rows.end(), less);
+    if(top != 0 && rows.size() > top)
+        rows.resize(top);
+}
+
+int Best(const DbIndex& index, const Options& options)
+{
+    struct Row
+    {
+        std::string family;
+        std::size_t problems = 0;
+        std::string solver;
+        std::size_t wins     = 0;
+        std::size_t measured = 0;
+        double slowdown      = 1.0;
+    };
+
+    auto rows = std::vector<Row>{};
+    for(const auto& [family, entries] : index.Families())
+    {
+        auto row   = Row{};
+        row.family = family;
+        auto wins  = std::map<std::string, std::size_t>{};
+        for(const auto* entry : entries)
+        {
+            if(const auto best = entry->Best())
+            {
+                ++row.problems;
+                ++wins[best->first];
+            }
+        }
+        if(row.problems == 0)
+            continue;
+
+        const auto top = std::max_element(wins.begin(), wins.end(), [](auto& l, auto& r) {
+            return l.second < r.second;
+        });
+        row.solver = top->first;
+        row.wins   = top->second;
+
+        auto log_sum = 0.0;
+        for(const auto* entry : entries)
+        {
+            const auto best = entry->Best();
+            const auto time = entry->Time(row.solver);
+            if(!best || !time || best->second <= 0.0f)
+                continue;
+            ++row.measured;
+            log_sum += std::log(*time / best->second);
+        }
+        if(row.measured != 0)
+            row.slowdown = std::exp(log_sum / row.measured);
+        rows.push_back(row);
+    }
+
+    SortAndLimit(rows, options.top, [](auto& l, auto& r) { return l.problems > r.problems; });
+
+    std::cout << "problems\tsolver\twins\tshare\tmeasured\tslowdown\tfamily" << std::endl;
+    std::cout << std::fixed;
+    for(const auto& row : rows)
+    {
+        std::cout << row.problems << '\t' << row.solver << '\t' << row.wins << '\t'
+                  << std::setprecision(1) << 100.0 * row.wins / row.problems << "%\t"
+                  << row.measured << '\t' << std::setprecision(3) << row.slowdown << '\t'
+                  << row.family << std::endl;
+    }
+    return 0;
+}
+
+int Regress(const DbIndex& old_db, const DbIndex& new_db, const Options& options)
+{
+    struct Row
+    {
+        std::string key;
+        std::pair<std::string, float> old_best;
+        std::pair<std::string, float> new_best;
+        double ratio;
+    };
+
+    const auto limit = 1.0 + options.threshold / 100.0;
+    auto rows        = std::vector<Row>{};
+    auto compared    = std::size_t{0};
+    auto improved    = std::size_t{0};
+    auto lost        = std::size_t{0};
+    auto log_sum     = 0.0;
+
+    for(const auto& [key, entry] : old_db.Entries())
+    {
+        const auto old_best = entry.Best();
+        if(!old_best || old_best->second <= 0.0f)
+            continue;
+        const auto* other   = new_db.Find(entry.problem);
+        const auto new_best = other != nullptr ? other->Best() : std::nullopt;
+        if(!new_best || new_best->second <= 0.0f)
+        {
+            ++lost;
+            continue;
+        }
+
+        const auto ratio = static_cast<double>(new_best->second) / old_best->second;
+        ++compared;
+        log_sum += std::log(ratio);
+        if(ratio > limit)
+            rows.push_back({entry.problem.Key(), *old_best, *new_best, ratio});
+        else if(ratio * limit < 1.0)
+            ++improved;
+    }
+
+    std::cout << "# " << compared << " problems compared, " << rows.size() << " regressed, "
+              << improved << " improved, " << lost << " without a record in the new version"
+              << std::endl;
+    if(compared != 0)
+        std::cout << "# geometric mean of new/old best times: " << std::exp(log_sum / compared)
+                  << std::endl;
+
+    SortAndLimit(rows, options.top, [](auto& l, auto& r) { return l.ratio > r.ratio; });
+
+    std::cout << "ratio\told_time\told_solver\tnew_time\tnew_solver\tkey" << std::endl;
+    for(const auto& row : rows)
+    {
+        std::cout << row.ratio << '\t' << row.old_best.second << '\t' << row.old_best.first
+                  << '\t' << row.new_best.second << '\t' << row.new_best.first << '\t' << row.key
+                  << std::endl;
+    }
+    return 0;
+}
+
+int Coverage(const DbIndex& system, const DbIndex& recorded, const Options& options)
+{
+    struct Row
+    {
+        std::size_t files;
+        std::string kind;
+        std::string solver;
+        std::string key;
+    };
+
+    auto rows         = std::vector<Row>{};
+    auto problems     = std::size_t{0};
+    auto missing_find = std::size_t{0};
+    auto missing_perf = std::size_t{0};
+
+    for(const auto& [key, entry] : recorded.Entries())
+    {
+        const auto* sys = system.Find(entry.problem);
+        const auto best = entry.Best();
+        if(best)
+            ++problems;
+
+        if(best && (sys == nullptr || sys->times.empty()))
+        {
+            ++missing_find;
+            rows.push_back({entry.files, "find", best->first, entry.problem.Key()});
+        }
+        for(const auto& solver : entry.tuned)
+        {
+            if(sys != nullptr && sys->tuned.count(solver) != 0)
+                continue;
+            ++missing_perf;
+            rows.push_back({entry.files, "perf", solver, entry.problem.Key()});
+        }
+    }
+
+    std::cout << "# " << missing_find << " of " << problems
+              << " measured problems have no Find-DB record, " << missing_perf
+              << " tuned solvers have no PerfDb record in the system databases" << std::endl;
+
+    SortAndLimit(rows, options.top, [](auto& l, auto& r) {
+        return l.files != r.files ? l.files > r.files : l.key < r.key;
+    });
+
+    std::cout << "files\tkind\tsolver\tkey" << std::endl;
+    for(const auto& row : rows)
+        std::cout << row.files << '\t' << row.kind << '\t' << row.solver << '\t' << row.key
+                  << std::endl;
+    return 0;
+}
+
+// Mirrors the ToFeatures() of the models in src/conv/heuristics/ai_heuristics.cpp. Backward
+// problems are described by x and y, as the "in" tensor of their keys is dy.
+std::map<std::string, int64_t> GetFeatures(const Problem& p)
+{
+    const auto fwd = p.direction == "F";
+    const auto x_c = fwd ? p.in_c : p.out_c;
+    const auto x_d = fwd ? p.in_d : p.out_d;
+    const auto x_h = fwd ? p.in_h : p.out_h;
+    const auto x_w = fwd ? p.in_w : p.out_w;
+    const auto y_c = fwd ? p.out_c : p.in_c;
+    const auto y_d = fwd ? p.out_d : p.in_d;
+    const auto y_h = fwd ? p.out_h : p.in_h;
+    const auto y_w = fwd ? p.out_w : p.in_w;
+
+    return {{"InChannels", x_c},      {"Inp_0", x_c},
+            {"InDepth", x_d},
+            {"InHeight", x_h},        {"Inp_2", x_h},
+            {"InWidth", x_w},         {"Inp_3", x_w},
+            {"OutChannels", y_c},     {"Out_0", y_c},
+            {"OutDepth", y_d},
+            {"OutHeight", y_h},       {"Out_2", y_h},
+            {"OutWidth", y_w},        {"Out_3", y_w},
+            {"FilterDim0", p.fil_d},
+            {"FilterDim1", p.fil_h},  {"Fil_1", p.fil_h},
+            {"FilterDim2", p.fil_w},  {"Fil_2", p.fil_w},
+            {"Padding0", 1}, // TunaNet was trained on a dataset of 2D problems where PadD and
+            {"Stride0", 1},  // StrideD were set to 1
+            {"Padding1", p.pad_h},    {"Pad_1", p.pad_h},
+            {"Padding2", p.pad_w},    {"Pad_2", p.pad_w},
+            {"Stride1", p.stride_h},  {"Str_1", p.stride_h},
+            {"Stride2", p.stride_w},  {"Str_2", p.stride_w},
+            {"Dilation1", p.dil_h},   {"Dil_1", p.dil_h},
+            {"Dilation2", p.dil_w},   {"Dil_2", p.dil_w},
+            {"BatchSize", p.batch},
+            {"GroupSize", p.group_count}};
+}
+
+int Export(const DbIndex& index, const Options& options)
+{
+    auto metadata_file = std::ifstream{options.metadata};
+    if(!metadata_file)
+    {
+        std::cerr << "Unable to open " << options.metadata << std::endl;
+        return 1;
+    }
+    const auto metadata  = nlohmann::json::parse(metadata_file);
+    const auto features  = metadata["conv_params_used_as_features"].get<std::vector<std::string>>();
+    const auto& encoding = metadata["encodings"];
+
+    auto output_file = std::ofstream{};
+    if(!options.output.empty())
+    {
+        output_file.open(options.output);
+        if(!output_file)
+        {
+            std::cerr << "Unable to open " << options.output << std::endl;
+            return 1;
+        }
+    }
+    auto& out = options.output.empty() ? std::cout : output_file;
+
+    for(const auto& name : features)
+        out << name << ',';
+    out << "solver,solver_id,time,key" << std::endl;
+
+    auto exported    = std::size_t{0};
+    auto unsupported = std::size_t{0};
+    auto unknown     = std::size_t{0};
+
+    for(const auto& [key, entry] : index.Entries())
+    {
+        const auto best = entry.Best();
+        if(!best)
+            continue;
+
+        const auto& p = entry.problem;
+        // TunaNet models support 2D problems with the layouts and types they encode
+        if(p.spatial_dims != 2 || !p.suffix.empty() || !encoding["Layout"].contains(p.layout) ||
+           !encoding["Precision"].contains(p.data_type) ||
+           !encoding["Direction"].contains(p.direction))
+        {
+            ++unsupported;
+            continue;
+        }
+        if(!encoding["solver"].contains(best->first))
+        {
+            ++unknown;
+            continue;
+        }
+
+        auto values         = GetFeatures(p);
+        values["Layout"]    = encoding["Layout"][p.layout].get<int64_t>();
+        values["Precision"] = encoding["Precision"][p.data_type].get<int64_t>();
+        values["Direction"] = encoding["Direction"][p.direction].get<int64_t>();
+
+        for(const auto& name : features)
+        {
+            const auto value = values.find(name);
+            if(value == values.end())
+            {
+                std::cerr << "Unknown feature " << name << " in " << options.metadata
+                          << std::endl;
+                return 1;
+            }
+            out << value->second << ',';
+        }
+        out << best->first << ',' << encoding["solver"][best->first].get<int64_t>() << ','
+            << best->second << ',' << p.Key() << std::endl;
+        ++exported;
+    }
+
+    std::cerr << exported << " problems exported, " << unsupported
+              << " not supported by the model, " << unknown
+              << " solved best by a solver unknown to the model" << std::endl;
+    return 0;
+}
+
+} // namespace
+
+int main(int argn, char** args)
+{
+    const auto command = argn > 1 ? std::string{args[1]} : std::string{};
+    auto options       = Options{};
+    auto bad_option    = false;
+
+    for(int i = 2; i < argn; ++i)
+    {
+        const std::string arg = args[i];
+        const auto has_value  = i + 1 < argn;
+        if(arg == "--top" && has_value)
+            options.top = std::stoul(args[++i]);
+        else if(arg == "--threshold" && has_value)
+            options.threshold = std::stod(args[++i]);
+        else if(arg == "--system" && has_value)
+            options.system.emplace_back(args[++i]);
+        else if(arg == "--metadata" && has_value)
+            options.metadata = args[++i];
+        else if(arg == "--output" && has_value)
+            options.output = args[++i];
+        else if(arg.rfind("--", 0) == 0)
+            bad_option = true;
+        else
+            options.files.push_back(arg);
+    }
+
+    const auto valid = !bad_option && !options.files.empty() &&
+                       (command == "best" ||
+                        (command == "regress" && options.files.size() == 2) ||
+                        (command == "coverage" && !options.system.empty()) ||
+                        (command == "export" && !options.metadata.empty()));
+    if(!valid)
+    {
+        Usage(args[0]);
+        return 1;
+    }
+
+    if(command == "regress")
+    {
+        auto old_db = DbIndex{};
+        auto new_db = DbIndex{};
+        if(!old_db.Load(options.files[0]) || !new_db.Load(options.files[1]))
+            return 1;
+        return Regress(old_db, new_db, options);
+    }
+
+    auto index = DbIndex{};
+    if(!LoadAll(index, options.files))
+        return 1;
+
+    if(command == "coverage")
+    {
+        auto system = DbIndex{};
+        if(!LoadAll(system, options.system))
+            return 1;
+        return Coverage(system, index, options);
+    }
+    if(command == "export")
+        return Export(index, options);
+    return Best(index, options);
+}
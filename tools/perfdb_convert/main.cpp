@@ -0,0 +1,99 @@
+#include <miopen/packed_values.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace serialize = miopen::solver::serialize;
+
+// Schema version 0 was written by early versions of this tool, MIOpen does not read it.
+static bool PackValues(std::string_view values, std::string& packed)
+{
+    auto version = std::uint64_t{};
+    if(!serialize::GetSchemaVersion(values, version))
+        return serialize::PackText(values, packed);
+    auto text = std::string{};
+    return version == 0 && serialize::UnpackToText(values, text) &&
+           serialize::PackText(text, packed);
+}
+
+// Converts VALUES of a single "ID:VALUES" pair. VALUES which cannot be converted exactly,
+// e.g. the ones holding strings or floating point numbers, are left as they are.
+static std::string ConvertPair(std::string_view pair, bool to_packed)
+{
+    const auto colon = pair.find(':');
+    if(colon == std::string_view::npos)
+        return std::string{pair};
+
+    const auto values = pair.substr(colon + 1);
+    auto converted    = std::string{};
+    const auto ok     = to_packed ? PackValues(values, converted)
+                                  : serialize::UnpackToText(values, converted);
+    if(!ok)
+        return std::string{pair};
+    return std::string{pair.substr(0, colon + 1)} + converted;
+}
+
+// Record format: KEY=ID:VALUES;ID:VALUES
+static std::string ConvertLine(const std::string& line, bool to_packed)
+{
+    const auto eq = line.find('=');
+    if(eq == std::string::npos)
+        return line;
+
+    auto out = line.substr(0, eq + 1);
+    for(std::size_t begin = eq + 1; begin <= line.size();)
+    {
+        auto end = line.find(';', begin);
+        if(end == std::string::npos)
+            end = line.size();
+        if(begin != eq + 1)
+            out += ';';
+        out += ConvertPair(std::string_view{line}.substr(begin, end - begin), to_packed);
+        begin = end + 1;
+    }
+    return out;
+}
+
+int main(int argn, char** args)
+{
+    const auto mode = argn == 4 ? std::string{args[1]} : std::string{};
+    if(mode != "--to-packed" && mode != "--to-text")
+    {
+        std::cerr << "Usage:" << std::endl;
+        std::cerr << args[0] << " --to-packed|--to-text input_path output_path" << std::endl;
+        std::cerr << "Converts VALUES of a text perf db between the comma-separated and the "
+                     "packed formats. The conversion is lossless, VALUES which cannot be "
+                     "packed exactly are kept as text."
+                  << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(args[2]);
+    if(!in)
+    {
+        std::cerr << "Unable to open " << args[2] << std::endl;
+        return 1;
+    }
+
+    std::ofstream out(args[3]);
+    if(!out)
+    {
+        std::cerr << "Unable to open " << args[3] << std::endl;
+        return 1;
+    }
+
+    const auto to_packed = mode == "--to-packed";
+    std::string line;
+    while(std::getline(in, line))
+        out << ConvertLine(line, to_packed) << '\n';
+
+    if(!out)
+    {
+        std::cerr << "Unable to write " << args[3] << std::endl;
+        return 1;
+    }
+    return 0;
+}